@@ -22,8 +22,10 @@
 #include <sstream>
 
 #include "addon/addon.hpp"
+#include "addon/addon_md5_cache.hpp"
 #include "addon/md5.hpp"
 #include "gui/dialog.hpp"
+#include "physfs/mapped_file.hpp"
 #include "physfs/util.hpp"
 #include "supertux/globals.hpp"
 #include "supertux/menu/addon_menu.hpp"
@@ -44,32 +46,12 @@ static const char* ADDON_REPOSITORY_URL = "https://raw.githubusercontent.com/Sup
 
 MD5 md5_from_file(const std::string& filename)
 {
-  // TODO: This does not work as expected for some files -- IFileStream seems to not always behave like an ifstream.
-  //IFileStream ifs(installed_physfs_filename);
-  //std::string md5 = MD5(ifs).hex_digest();
+  // Throws a std::runtime_error, if the file can't be opened.
+  MappedFile file(filename);
 
   MD5 md5;
-
-  auto file = PHYSFS_openRead(filename.c_str());
-  if (!file)
-  {
-    std::ostringstream out;
-    out << "PHYSFS_openRead() failed: " << physfsutil::get_last_error();
-    throw std::runtime_error(out.str());
-  }
-  else
-  {
-    while (true)
-    {
-      unsigned char buffer[1024];
-      PHYSFS_sint64 len = PHYSFS_readBytes(file, buffer, sizeof(buffer));
-      if (len <= 0) break;
-      md5.update(buffer, static_cast<unsigned int>(len));
-    }
-    PHYSFS_close(file);
-
-    return md5;
-  }
+  md5.update(reinterpret_cast<const uint8_t*>(file.get_data()), file.get_size());
+  return md5;
 }
 
 MD5 md5_from_archive(const std::string& filename)
@@ -152,7 +134,13 @@ AddonManager::AddonManager(const std::string& addon_directory,
   m_repository_addons(),
   m_initialized(false),
   m_has_been_updated(false),
-  m_transfer_statuses(new TransferStatusList)
+  m_transfer_statuses(new TransferStatusList),
+  m_md5_cache(new AddonMD5Cache),
+  m_md5_results(),
+  m_md5_mutex(),
+  m_md5_thread(),
+  m_md5_done(0),
+  m_md5_total(0)
 {
   if (!PHYSFS_mkdir(m_addon_directory.c_str()))
   {
@@ -217,6 +205,8 @@ AddonManager::AddonManager(const std::string& addon_directory,
 
 AddonManager::~AddonManager()
 {
+  finish_md5_updates();
+
   // Sync enabled/disabled add-ons into the config for saving.
   m_addon_config.clear();
   for (const auto& [id, addon] : m_installed_addons)
@@ -302,6 +292,8 @@ AddonManager::check_online()
 TransferStatusListPtr
 AddonManager::request_install_addon(const AddonId& addon_id)
 {
+  finish_md5_updates();
+
   // Remove add-on if it already exists.
   auto it = m_installed_addons.find(addon_id);
   if (it != m_installed_addons.end())
@@ -354,6 +346,7 @@ AddonManager::request_install_addon(const AddonId& addon_id)
           }
 
           add_installed_archive(install_filename, md5.hex_digest());
+          cache_md5(install_filename, md5.hex_digest());
 
           // Attempt to enable the add-on.
           try
@@ -404,6 +397,8 @@ AddonManager::request_install_addon_dependencies(const AddonId& addon_id)
 void
 AddonManager::install_addon(const AddonId& addon_id)
 {
+  finish_md5_updates();
+
   { // remove addon if it already exists.
     auto it = m_installed_addons.find(addon_id);
     if (it != m_installed_addons.end())
@@ -447,6 +442,7 @@ AddonManager::install_addon(const AddonId& addon_id)
     else
     {
       add_installed_archive(install_filename, md5.hex_digest());
+      cache_md5(install_filename, md5.hex_digest());
     }
   }
 }
@@ -454,6 +450,8 @@ AddonManager::install_addon(const AddonId& addon_id)
 void
 AddonManager::install_addon_from_local_file(const std::string& filename)
 {
+  finish_md5_updates();
+
   const std::string& source_filename = FileSystem::basename(filename);
   if(!StringUtil::has_suffix(source_filename, ".zip"))
     return;
@@ -465,11 +463,14 @@ AddonManager::install_addon_from_local_file(const std::string& filename)
   FileSystem::copy(filename, target_filename);
   MD5 target_md5 = md5_from_file(physfs_target_filename);
   add_installed_archive(physfs_target_filename, target_md5.hex_digest(), true);
+  cache_md5(physfs_target_filename, target_md5.hex_digest());
 }
 
 void
 AddonManager::uninstall_addon(const AddonId& addon_id)
 {
+  finish_md5_updates();
+
   log_debug << "Uninstalling add-on " << addon_id << std::endl;
   auto& addon = get_installed_addon(addon_id);
   if (addon.is_enabled())
@@ -869,13 +870,136 @@ AddonManager::add_installed_addons()
 {
   auto archives = scan_for_archives();
 
+  m_md5_cache->load();
+
+  std::vector<MD5Job> jobs;
   for (const auto& archive : archives)
   {
-    MD5 md5 = md5_from_archive(archive);
-    add_installed_archive(archive, md5.hex_digest());
+    PHYSFS_Stat stat;
+    const char* realdir = PHYSFS_getRealDir(archive.c_str());
+    if (physfsutil::is_directory(archive) || !realdir || !PHYSFS_stat(archive.c_str(), &stat))
+    {
+      MD5 md5 = md5_from_archive(archive);
+      add_installed_archive(archive, md5.hex_digest());
+      continue;
+    }
+
+    const auto md5 = m_md5_cache->get(archive, stat.filesize, stat.modtime);
+    if (md5)
+    {
+      add_installed_archive(archive, *md5);
+    }
+    else
+    {
+      // The checksum is only needed for checking for updates, so the
+      // add-on can be used before it is known.
+      add_installed_archive(archive, "");
+      jobs.push_back({ archive, FileSystem::join(realdir, archive), stat.filesize, stat.modtime, std::string() });
+    }
+  }
+
+  if (jobs.empty())
+  {
+    m_md5_cache->save();
+  }
+  else
+  {
+    log_info << "Computing checksums of " << jobs.size() << " of " << archives.size()
+             << " add-on archives in the background" << std::endl;
+    m_md5_total = jobs.size();
+#ifdef __EMSCRIPTEN__
+    // Threads are not available in the browser build.
+    compute_md5s(std::move(jobs));
+#else
+    m_md5_thread = std::thread(&AddonManager::compute_md5s, this, std::move(jobs));
+#endif
+  }
+}
+
+void
+AddonManager::compute_md5s(std::vector<MD5Job> jobs)
+{
+  for (auto& job : jobs)
+  {
+    try
+    {
+      job.md5 = md5_from_file(job.archive).hex_digest();
+    }
+    catch (const std::exception& err)
+    {
+      log_warning << "Couldn't compute checksum of " << job.archive << ": " << err.what() << std::endl;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_md5_mutex);
+      m_md5_results.push_back(std::move(job));
+    }
+    m_md5_done += 1;
+  }
+}
+
+void
+AddonManager::apply_md5_results()
+{
+  std::vector<MD5Job> results;
+  {
+    std::lock_guard<std::mutex> lock(m_md5_mutex);
+    results.swap(m_md5_results);
+  }
+
+  for (const auto& job : results)
+  {
+    if (job.md5.empty())
+      continue;
+
+    for (auto& [id, addon] : m_installed_addons)
+    {
+      if (addon->get_install_filename() == job.os_path)
+        addon->set_install_filename(job.os_path, job.md5);
+    }
+    m_md5_cache->set(job.archive, job.size, job.mtime, job.md5);
   }
 }
 
+float
+AddonManager::get_md5_progress() const
+{
+  if (m_md5_total == 0)
+    return 1.0f;
+
+  return static_cast<float>(m_md5_done) / static_cast<float>(m_md5_total);
+}
+
+void
+AddonManager::finish_md5_updates()
+{
+  if (m_md5_thread.joinable())
+  {
+    if (m_md5_done < m_md5_total)
+      log_info << "Waiting for add-on checksums, " << static_cast<int>(get_md5_progress() * 100.0f) << "% done" << std::endl;
+
+    m_md5_thread.join();
+  }
+
+  if (m_md5_total == 0)
+    return;
+
+  apply_md5_results();
+  m_md5_cache->save();
+
+  log_info << "Computed checksums of " << m_md5_total << " add-on archives" << std::endl;
+  m_md5_done = 0;
+  m_md5_total = 0;
+}
+
+void
+AddonManager::cache_md5(const std::string& archive, const std::string& md5)
+{
+  PHYSFS_Stat stat;
+  if (PHYSFS_stat(archive.c_str(), &stat))
+    m_md5_cache->set(archive, stat.filesize, stat.modtime, md5);
+}
+
 AddonManager::AddonMap
 AddonManager::parse_addon_infos(const std::string& filename) const
 {
@@ -937,6 +1061,8 @@ AddonManager::check_for_langpack_updates()
   if (language == "en")
     return;
 
+  finish_md5_updates();
+
   try
   {
     check_online();
@@ -18,9 +18,13 @@
 #ifndef HEADER_SUPERTUX_ADDON_ADDON_MANAGER_HPP
 #define HEADER_SUPERTUX_ADDON_ADDON_MANAGER_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <stdint.h>
 #include <string>
 #include <map>
+#include <thread>
 #include <vector>
 
 #include "addon/downloader.hpp"
@@ -29,6 +33,7 @@
 
 class Addon;
 class AddonDependencyManager;
+class AddonMD5Cache;
 
 typedef std::string AddonId;
 
@@ -38,6 +43,17 @@ class AddonManager final : public Currenton<AddonManager>
 public:
   using AddonMap = std::map<AddonId, std::unique_ptr<Addon> >;
 
+private:
+  /** An installed archive, whose checksum has to be computed */
+  struct MD5Job
+  {
+    std::string archive;
+    std::string os_path;
+    int64_t size;
+    int64_t mtime;
+    std::string md5;
+  };
+
 private:
   Downloader m_downloader;
   const std::string m_addon_directory;
@@ -54,6 +70,15 @@ private:
 
   TransferStatusListPtr m_transfer_statuses;
 
+  std::unique_ptr<AddonMD5Cache> m_md5_cache;
+
+  /** Checksums computed in the background, not assigned to add-ons yet */
+  std::vector<MD5Job> m_md5_results;
+  std::mutex m_md5_mutex;
+  std::thread m_md5_thread;
+  std::atomic<size_t> m_md5_done;
+  size_t m_md5_total;
+
 public:
   AddonManager(const std::string& addon_directory,
                std::vector<Config::Addon>& addon_config);
@@ -97,6 +122,17 @@ public:
   void update();
   void check_for_langpack_updates();
 
+  /** Returns the fraction of installed archives, whose checksums
+      have been computed, in the range [0, 1]. */
+  float get_md5_progress() const;
+
+  /** Returns true, while checksums are still being computed in the background. */
+  bool is_computing_md5s() const { return m_md5_done < m_md5_total; }
+
+  /** Waits for the checksums computed in the background and assigns them
+      to their add-ons. Has to be called before comparing checksums. */
+  void finish_md5_updates();
+
 #ifdef EMSCRIPTEN
   void onDownloadProgress(int id, int loaded, int total);
   void onDownloadFinished(int id);
@@ -109,6 +145,9 @@ private:
 
   std::vector<std::string> scan_for_archives() const;
   void add_installed_addons();
+  void compute_md5s(std::vector<MD5Job> jobs);
+  void apply_md5_results();
+  void cache_md5(const std::string& archive, const std::string& md5);
   AddonMap parse_addon_infos(const std::string& filename) const;
 
   /** add \a archive, given as physfs path, to the list of installed
@@ -0,0 +1,191 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "addon/addon_md5_cache.hpp"
+
+#include <physfs.h>
+#include <stdexcept>
+#include <string.h>
+
+#include "physfs/ifile_stream.hpp"
+#include "physfs/util.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "util/log.hpp"
+
+namespace {
+
+const char* CACHE_DIRECTORY = "cache";
+const char* CACHE_FILENAME = "cache/addon_md5.cache";
+const char CACHE_FILE_MAGIC[4] = { 'S', 'T', 'M', 'D' };
+const uint32_t CACHE_FILE_VERSION = 1;
+
+/** Length of a checksum as hex digest */
+const size_t MD5_LENGTH = 32;
+
+template<typename T>
+void read_value(std::istream& in, T& value)
+{
+  if (!in.read(reinterpret_cast<char*>(&value), sizeof(value)))
+    throw std::runtime_error("Unexpected end of file");
+}
+
+template<typename T>
+void write_value(std::ostream& out, const T& value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string read_string(std::istream& in, size_t size)
+{
+  std::string result(size, '\0');
+  if (!in.read(&result[0], static_cast<std::streamsize>(size)))
+    throw std::runtime_error("Unexpected end of file");
+  return result;
+}
+
+} // namespace
+
+AddonMD5Cache::AddonMD5Cache() :
+  m_entries(),
+  m_modified(false)
+{
+}
+
+void
+AddonMD5Cache::load()
+{
+  m_entries.clear();
+  m_modified = false;
+
+  if (!PHYSFS_exists(CACHE_FILENAME))
+    return;
+
+  try
+  {
+    IFileStream in(CACHE_FILENAME);
+
+    char magic[sizeof(CACHE_FILE_MAGIC)];
+    uint32_t version = 0;
+    uint32_t count = 0;
+    in.read(magic, sizeof(magic));
+    read_value(in, version);
+    if (memcmp(magic, CACHE_FILE_MAGIC, sizeof(magic)) != 0 || version != CACHE_FILE_VERSION)
+      throw std::runtime_error("Unknown file format");
+
+    read_value(in, count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      uint32_t path_size = 0;
+      read_value(in, path_size);
+      const std::string archive = read_string(in, path_size);
+
+      Entry entry{ 0, 0, std::string(), false };
+      read_value(in, entry.size);
+      read_value(in, entry.mtime);
+      entry.md5 = read_string(in, MD5_LENGTH);
+
+      m_entries[archive] = std::move(entry);
+    }
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't read add-on checksum cache: " << err.what() << std::endl;
+    m_entries.clear();
+    m_modified = true;
+  }
+}
+
+void
+AddonMD5Cache::save()
+{
+  for (auto it = m_entries.begin(); it != m_entries.end();)
+  {
+    if (it->second.used)
+    {
+      ++it;
+    }
+    else
+    {
+      it = m_entries.erase(it);
+      m_modified = true;
+    }
+  }
+
+  if (!m_modified || (g_config && !g_config->write_caches))
+    return;
+
+  if (!PHYSFS_mkdir(CACHE_DIRECTORY))
+  {
+    log_warning << "Couldn't write add-on checksum cache: Couldn't create cache directory" << std::endl;
+    return;
+  }
+
+  // The cache is written to a temporary file first, so a failed write
+  // doesn't leave a truncated cache behind.
+  if (physfsutil::write_file_replacing(CACHE_FILENAME, std::string(CACHE_FILENAME) + ".part",
+        [this](std::ostream& out) {
+          out.write(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+          write_value(out, CACHE_FILE_VERSION);
+          write_value(out, static_cast<uint32_t>(m_entries.size()));
+          for (const auto& [archive, entry] : m_entries)
+          {
+            write_value(out, static_cast<uint32_t>(archive.size()));
+            out.write(archive.data(), static_cast<std::streamsize>(archive.size()));
+            write_value(out, entry.size);
+            write_value(out, entry.mtime);
+            out.write(entry.md5.data(), static_cast<std::streamsize>(MD5_LENGTH));
+          }
+        }))
+  {
+    m_modified = false;
+  }
+  else
+  {
+    log_warning << "Couldn't write add-on checksum cache" << std::endl;
+  }
+}
+
+std::optional<std::string>
+AddonMD5Cache::get(const std::string& archive, int64_t size, int64_t mtime)
+{
+  auto it = m_entries.find(archive);
+  if (it == m_entries.end() || it->second.size != size || it->second.mtime != mtime)
+    return std::nullopt;
+
+  it->second.used = true;
+  return it->second.md5;
+}
+
+void
+AddonMD5Cache::set(const std::string& archive, int64_t size, int64_t mtime, const std::string& md5)
+{
+  if (md5.size() != MD5_LENGTH)
+    return;
+
+  Entry& entry = m_entries[archive];
+  if (entry.size != size || entry.mtime != mtime || entry.md5 != md5)
+  {
+    entry.size = size;
+    entry.mtime = mtime;
+    entry.md5 = md5;
+    m_modified = true;
+  }
+  entry.used = true;
+}
+
+/* EOF */
@@ -0,0 +1,70 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_ADDON_ADDON_MD5_CACHE_HPP
+#define HEADER_SUPERTUX_ADDON_ADDON_MD5_CACHE_HPP
+
+#include <optional>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+/**
+ * Keeps the MD5 checksums of installed add-on archives between runs,
+   keyed by their path, size and modification time, so archives which
+   haven't changed don't have to be hashed again on every start.
+
+   The checksums are stored in a binary file in the user directory.
+ */
+class AddonMD5Cache final
+{
+private:
+  struct Entry
+  {
+    int64_t size;
+    int64_t mtime;
+    std::string md5;
+    bool used;
+  };
+
+public:
+  AddonMD5Cache();
+
+  void load();
+
+  /** Writes the cache file, if anything has changed since it was loaded.
+      Entries, which haven't been used since, are dropped, as their
+      archives have been removed. */
+  void save();
+
+  /** Returns the checksum of the archive, if its size and modification
+      time are still the same as when it was stored. */
+  std::optional<std::string> get(const std::string& archive, int64_t size, int64_t mtime);
+  void set(const std::string& archive, int64_t size, int64_t mtime, const std::string& md5);
+
+private:
+  std::unordered_map<std::string, Entry> m_entries;
+  bool m_modified;
+
+private:
+  AddonMD5Cache(const AddonMD5Cache&) = delete;
+  AddonMD5Cache& operator=(const AddonMD5Cache&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -44,7 +44,16 @@
 #include "addon/md5.hpp"
 
 #include <assert.h>
+#include <cstring>
 #include <stdexcept>
+#include <vector>
+
+namespace {
+
+/** Size of the blocks read from files and streams */
+const size_t BLOCK_SIZE = 65536;
+
+} // namespace
 
 MD5::MD5() :
   buffer(),
@@ -54,27 +63,27 @@ MD5::MD5() :
   init();
 }
 
-void MD5::update (uint8_t* input, uint32_t input_length) {
+void MD5::update (const uint8_t* input, size_t input_length) {
 
-  uint32_t input_index, buffer_index;
-  uint32_t buffer_space; // how much space is left in buffer
+  size_t input_index, buffer_index;
+  size_t buffer_space; // how much space is left in buffer
 
   if (finalized) throw std::runtime_error("MD5::update: Can't update a finalized digest!");
 
   // Compute number of bytes mod 64
-  buffer_index = static_cast<unsigned int>((count[0] >> 3) & 0x3F);
+  buffer_index = static_cast<size_t>((count[0] >> 3) & 0x3F);
 
   // Update number of bits
-  if ( (count[0] += (static_cast<uint32_t>(input_length) << 3))<(static_cast<uint32_t>(input_length) << 3) ) count[1]++;
-
-  count[1] += (static_cast<uint32_t>(input_length) >> 29);
+  const uint64_t bits = ((static_cast<uint64_t>(count[1]) << 32) | count[0]) + (static_cast<uint64_t>(input_length) << 3);
+  count[0] = static_cast<uint32_t>(bits);
+  count[1] = static_cast<uint32_t>(bits >> 32);
 
   buffer_space = 64 - buffer_index; // how much space is left in buffer
 
   // Transform as many times as possible.
   if (input_length >= buffer_space) { // ie. we have enough to fill the buffer
     // fill the rest of the buffer and transform
-    memcpy (buffer + buffer_index, input, buffer_space);
+    memcpy (buffer + buffer_index, input, static_cast<uint32_t>(buffer_space));
     transform (buffer);
 
     // now, transform each 64-byte piece of the input, bypassing the buffer
@@ -87,35 +96,35 @@ void MD5::update (uint8_t* input, uint32_t input_length) {
     input_index=0; // so we can buffer the whole input
 
   // and here we do the buffering:
-  memcpy(buffer+buffer_index, input+input_index, input_length-input_index);
+  memcpy(buffer+buffer_index, input+input_index, static_cast<uint32_t>(input_length-input_index));
 }
 
 void MD5::update(FILE *file) {
-  uint8_t buffer_[1024];
+  std::vector<uint8_t> buffer_(BLOCK_SIZE);
   size_t len;
 
-  while ((len = fread(buffer_, 1, 1024, file))) update(buffer_, static_cast<int>(len));
+  while ((len = fread(buffer_.data(), 1, buffer_.size(), file))) update(buffer_.data(), len);
 
   fclose (file);
 }
 
 void MD5::update(std::istream& stream) {
-  uint8_t buffer_[1024];
+  std::vector<uint8_t> buffer_(BLOCK_SIZE);
 
   while (stream.good()) {
-    stream.read(reinterpret_cast<char*>(buffer_), 1024); // note that return value of read is unusable.
-    size_t len = stream.gcount();
-    update(buffer_, static_cast<unsigned int>(len));
+    stream.read(reinterpret_cast<char*>(buffer_.data()), buffer_.size()); // note that return value of read is unusable.
+    size_t len = static_cast<size_t>(stream.gcount());
+    update(buffer_.data(), len);
   }
 }
 
 void MD5::update(std::ifstream& stream) {
-  uint8_t buffer_[1024];
+  std::vector<uint8_t> buffer_(BLOCK_SIZE);
 
   while (stream.good()) {
-    stream.read(reinterpret_cast<char*>(buffer_), 1024); // note that return value of read is unusable.
-    size_t len = stream.gcount();
-    update(buffer_, static_cast<unsigned int>(len));
+    stream.read(reinterpret_cast<char*>(buffer_.data()), buffer_.size()); // note that return value of read is unusable.
+    size_t len = static_cast<size_t>(stream.gcount());
+    update(buffer_.data(), len);
   }
 }
 
@@ -242,7 +251,7 @@ void MD5::finalize() {
 #define S43 15
 #define S44 21
 
-void MD5::transform (uint8_t block[64]) {
+void MD5::transform (const uint8_t block[64]) {
   uint32_t a = state[0], b = state[1], c = state[2], d = state[3], x[16];
 
   decode (x, block, 64);
@@ -341,26 +350,25 @@ void MD5::encode (uint8_t* output, uint32_t* input, uint32_t len) {
   }
 }
 
-void MD5::decode (uint32_t* output, uint8_t* input, uint32_t len) {
+void MD5::decode (uint32_t* output, const uint8_t* input, uint32_t len) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  // The input is already in the byte order of the host.
+  std::memcpy(output, input, len);
+#else
   unsigned int i, j;
 
   for (i = 0, j = 0; j < len; i++, j += 4) {
     output[i] = (static_cast<uint32_t>(input[j])) | ((static_cast<uint32_t>(input[j+1])) << 8) | ((static_cast<uint32_t>(input[j+2])) << 16) | ((static_cast<uint32_t>(input[j+3])) << 24);
   }
+#endif
 }
 
-// Note: Replace "for loop" with standard memcpy if possible.
-void MD5::memcpy (uint8_t* output, uint8_t* input, uint32_t len) {
-  unsigned int i;
-
-  for (i = 0; i < len; i++) output[i] = input[i];
+void MD5::memcpy (uint8_t* output, const uint8_t* input, uint32_t len) {
+  std::memcpy(output, input, len);
 }
 
-// Note: Replace "for loop" with standard memset if possible.
 void MD5::memset (uint8_t* output, uint8_t value, uint32_t len) {
-  unsigned int i;
-
-  for (i = 0; i < len; i++) output[i] = value;
+  std::memset(output, value, len);
 }
 
 inline unsigned int MD5::rotate_left(uint32_t x, uint32_t n) {
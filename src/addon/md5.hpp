@@ -45,6 +45,7 @@
 #define HEADER_SUPERTUX_ADDON_MD5_HPP
 
 #include <fstream>
+#include <stddef.h>
 #include <stdint.h>
 
 class MD5
@@ -56,7 +57,7 @@ public:
   MD5(FILE *file); /**< digest file, close, finalize */
   MD5(std::ifstream& stream); /**< digest stream, close, finalize */
 
-  void update(uint8_t* input, unsigned int input_length); /**< MD5 block update operation. Continues an MD5 message-digest operation, processing another message block, and updating the context. */
+  void update(const uint8_t* input, size_t input_length); /**< MD5 block update operation. Continues an MD5 message-digest operation, processing another message block, and updating the context. */
   void update(std::istream& stream);
   void update(FILE *file);
   void update(std::ifstream& stream);
@@ -74,11 +75,11 @@ private:
 
   void init(); /**< called by all constructors */
   void finalize(); /**< MD5 finalization. Ends an MD5 message-digest operation, writing the the message digest and zeroizing the context. */
-  void transform(uint8_t* buffer); /**< MD5 basic transformation. Transforms state based on block. Does the real update work.  Note that length is implied to be 64. */
+  void transform(const uint8_t* buffer); /**< MD5 basic transformation. Transforms state based on block. Does the real update work.  Note that length is implied to be 64. */
 
   static void encode(uint8_t* dest, uint32_t* src, uint32_t length); /**< Encodes input (uint32_t) into output (uint8_t). Assumes len is a multiple of 4. */
-  static void decode(uint32_t* dest, uint8_t* src, uint32_t length); /**< Decodes input (uint8_t) into output (uint32_t). Assumes len is a multiple of 4. */
-  static void memcpy(uint8_t* dest, uint8_t* src, uint32_t length);
+  static void decode(uint32_t* dest, const uint8_t* src, uint32_t length); /**< Decodes input (uint8_t) into output (uint32_t). Assumes len is a multiple of 4. */
+  static void memcpy(uint8_t* dest, const uint8_t* src, uint32_t length);
   static void memset(uint8_t* start, uint8_t val, uint32_t length);
 
   static inline uint32_t rotate_left(uint32_t x, uint32_t n);
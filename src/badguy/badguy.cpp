@@ -44,6 +44,14 @@ static const float BURN_TIME = 1;
 static const float X_OFFSCREEN_DISTANCE = 1280;
 static const float Y_OFFSCREEN_DISTANCE = 800;
 
+static const ActionId ACTION_DEFAULT("default");
+static const ActionId ACTION_GEAR("gear");
+static const ActionId ACTION_ICED("iced");
+static const ActionId ACTION_MELTING("melting");
+static const ActionId ACTION_GROUND_MELTING("ground-melting");
+static const ActionId ACTION_INSIDE_MELTING("inside-melting");
+static const ActionId ACTION_BURNING("burning");
+
 BadGuy::BadGuy(const Vector& pos, const std::string& sprite_name, int layer,
                const std::string& light_sprite_name, const std::string& ice_sprite_name) :
   BadGuy(pos, Direction::LEFT, sprite_name, layer, light_sprite_name)
@@ -283,7 +291,7 @@ BadGuy::update(float dt_sec)
       if (m_frozen && is_portable())
         m_freezesprite->set_action(get_overlay_size(), 1);
       else
-        m_freezesprite->set_action("default", 1);
+        m_freezesprite->set_action(ACTION_DEFAULT, 1);
         
       active_update(dt_sec);
       break;
@@ -336,7 +344,7 @@ BadGuy::update(float dt_sec)
       m_is_active_flag = false;
       m_col.set_movement(m_physic.get_movement(dt_sec));
       if ( on_ground() && m_sprite->animation_done() ) {
-        set_action("gear", m_dir, 1);
+        set_action(ACTION_GEAR, m_dir, 1);
         set_state(STATE_GEAR);
       }
       int pa = graphicsRandom.rand(0,3);
@@ -896,16 +904,16 @@ BadGuy::grab(MovingObject& object, const Vector& pos, Direction dir_)
   if (m_frozen)
   {
     m_unfreeze_timer.stop();
-    if (m_sprite->has_action("iced-left"))
+    if (m_sprite->has_action(ACTION_ICED, Direction::LEFT))
     {
-      set_action("iced", m_dir, 1);
+      set_action(ACTION_ICED, m_dir, 1);
       // When the sprite doesn't have sepaigrate actions for left and right, it tries to use an universal one.
     }
     else
     {
-      if (m_sprite->has_action("iced"))
+      if (m_sprite->has_action(ACTION_ICED))
       {
-        set_action("iced", 1);
+        set_action(ACTION_ICED, 1);
       }
       // When no iced action exists, default to shading badguy blue.
       else
@@ -985,13 +993,13 @@ BadGuy::freeze()
 
   set_pos(Vector(get_bbox().get_left(), get_bbox().get_bottom() - freezesize_y));
 
-  if (m_sprite->has_action("iced-left"))
-    set_action("iced", m_dir, 1);
+  if (m_sprite->has_action(ACTION_ICED, Direction::LEFT))
+    set_action(ACTION_ICED, m_dir, 1);
   // When the sprite doesn't have separate actions for left and right, it tries to use an universal one.
   else
   {
-    if (m_sprite->has_action("iced"))
-      set_action("iced", 1);
+    if (m_sprite->has_action(ACTION_ICED))
+      set_action(ACTION_ICED, 1);
     // When no iced action exists, default to shading badguy blue.
     else
     {
@@ -1069,32 +1077,32 @@ BadGuy::ignite()
   m_sprite->stop_animation();
   m_ignited = true;
 
-  if (m_sprite->has_action("melting-left")) {
+  if (m_sprite->has_action(ACTION_MELTING, Direction::LEFT)) {
 
     // Melt it!
-    if (m_sprite->has_action("ground-melting-left") && on_ground()) {
-      set_action("ground-melting", m_dir, 1);
+    if (m_sprite->has_action(ACTION_GROUND_MELTING, Direction::LEFT) && on_ground()) {
+      set_action(ACTION_GROUND_MELTING, m_dir, 1);
       SoundManager::current()->play("sounds/splash.ogg", get_pos());
       set_state(STATE_GROUND_MELTING);
     } else {
-      set_action("melting", m_dir, 1);
+      set_action(ACTION_MELTING, m_dir, 1);
       SoundManager::current()->play("sounds/sizzle.ogg", get_pos());
       set_state(STATE_MELTING);
     }
 
     run_dead_script();
 
-  } else if (m_sprite->has_action("burning-left")) {
+  } else if (m_sprite->has_action(ACTION_BURNING, Direction::LEFT)) {
     // Burn it!
     m_glowing = true;
     SoundManager::current()->play("sounds/fire.ogg", get_pos());
-    set_action("burning", m_dir, 1);
+    set_action(ACTION_BURNING, m_dir, 1);
     set_state(STATE_BURNING);
     run_dead_script();
-  } else if (m_sprite->has_action("inside-melting-left")) {
+  } else if (m_sprite->has_action(ACTION_INSIDE_MELTING, Direction::LEFT)) {
     // melt it inside!
     SoundManager::current()->play("sounds/splash.ogg", get_pos());
-    set_action("inside-melting", m_dir, 1);
+    set_action(ACTION_INSIDE_MELTING, m_dir, 1);
     set_state(STATE_INSIDE_MELTING);
     run_dead_script();
   } else {
@@ -24,6 +24,11 @@
 static const float JUMPSPEED = -450;
 static const float BSNOWBALL_WALKSPEED = 80;
 
+static const ActionId ACTION_DIRECTION("");
+static const ActionId ACTION_SQUISHED("squished");
+static const ActionId ACTION_DOWN("down", ActionId::Format::DIRECTION_NAME);
+static const ActionId ACTION_UP("up", ActionId::Format::DIRECTION_NAME);
+
 BouncingSnowball::BouncingSnowball(const ReaderMapping& reader) :
   BadGuy(reader, "images/creatures/bouncing_snowball/bouncing_snowball.sprite"),
   m_x_speed()
@@ -44,7 +49,7 @@ void
 BouncingSnowball::initialize()
 {
   m_physic.set_velocity_x(m_dir == Direction::LEFT ? -m_x_speed : m_x_speed);
-  set_action(m_dir);
+  set_action(ACTION_DIRECTION, m_dir);
 }
 
 void
@@ -56,7 +61,7 @@ BouncingSnowball::active_update(float dt_sec)
 
   if ((m_sprite->get_action() == "left-up" || m_sprite->get_action() == "right-up") && m_sprite->animation_done())
   {
-    set_action(m_dir);
+    set_action(ACTION_DIRECTION, m_dir);
   }
   Rectf lookbelow = get_bbox();
   lookbelow.set_bottom(get_bbox().get_bottom() + 48);
@@ -66,11 +71,11 @@ BouncingSnowball::active_update(float dt_sec)
   bool groundBelow = !Sector::get().is_free_of_statics(lookbelow);
   if (groundBelow && (m_physic.get_velocity_y() >= 64.0f))
   {
-    set_action(m_dir, "down");
+    set_action(ACTION_DOWN, m_dir);
   }
   if (!groundBelow && (m_sprite->get_action() == "left-down" || m_sprite->get_action() == "right-down"))
   {
-    set_action(m_dir);
+    set_action(ACTION_DIRECTION, m_dir);
   }
 
   // Left-right faux collision
@@ -81,7 +86,7 @@ BouncingSnowball::active_update(float dt_sec)
   if (!Sector::get().is_free_of_statics(side_look_box))
   {
     m_dir = m_dir == Direction::LEFT ? Direction::RIGHT : Direction::LEFT;
-    set_action(m_dir);
+    set_action(ACTION_DIRECTION, m_dir);
     m_physic.set_velocity_x(-m_physic.get_velocity_x());
   }
 }
@@ -119,7 +124,7 @@ BouncingSnowball::collision_squished(GameObject& object)
   if (m_frozen)
     return BadGuy::collision_squished(object);
 
-  set_action("squished", m_dir);
+  set_action(ACTION_SQUISHED, m_dir);
   kill_squished(object);
   return true;
 }
@@ -140,7 +145,7 @@ BouncingSnowball::collision_solid(const CollisionHit& hit)
     if (get_state() == STATE_ACTIVE) {
       float bounce_speed = -m_physic.get_velocity_y()*0.8f;
       m_physic.set_velocity_y(std::min(JUMPSPEED, bounce_speed));
-	    set_action(m_dir, "up", /* loops = */ 1);
+	    set_action(ACTION_UP, m_dir, /* loops = */ 1);
     } else {
       m_physic.set_velocity_y(0);
     }
@@ -170,7 +175,7 @@ void
 BouncingSnowball::after_editor_set()
 {
   BadGuy::after_editor_set();
-  set_action(m_dir);
+  set_action(ACTION_DIRECTION, m_dir);
 }
 
 /* EOF */
@@ -27,6 +27,9 @@ namespace {
 const float PUFF_INTERVAL_MIN = 4.0f; /**< Spawn new puff of smoke at most that often. */
 const float PUFF_INTERVAL_MAX = 8.0f; /**< Spawn new puff of smoke at least that often. */
 const float GLOBAL_SPEED_MULT = 0.8f; /**< The overall movement speed/rate. */
+
+const ActionId ACTION_DIRECTION("");
+const ActionId ACTION_SQUISHED("squished");
 }
 
 FlyingSnowBall::FlyingSnowBall(const ReaderMapping& reader) :
@@ -40,7 +43,7 @@ FlyingSnowBall::FlyingSnowBall(const ReaderMapping& reader) :
 void
 FlyingSnowBall::initialize()
 {
-  set_action(m_dir);
+  set_action(ACTION_DIRECTION, m_dir);
 }
 
 void
@@ -52,7 +55,7 @@ FlyingSnowBall::activate()
 bool
 FlyingSnowBall::collision_squished(GameObject& object)
 {
-  set_action("squished", m_dir);
+  set_action(ACTION_SQUISHED, m_dir);
   m_physic.enable_gravity(true);
   m_physic.set_acceleration_y(0);
   m_physic.set_velocity_y(0);
@@ -89,7 +92,7 @@ FlyingSnowBall::active_update(float dt_sec)
   auto player = get_nearest_player();
   if (player) {
     m_dir = (player->get_pos().x > get_pos().x) ? Direction::RIGHT : Direction::LEFT;
-    set_action(m_dir);
+    set_action(ACTION_DIRECTION, m_dir);
   }
 
   // Spawn smoke puffs.
@@ -89,25 +89,26 @@ GoldBomb::active_update(float dt_sec)
   // Look for any of these in safe distance:
   // Player, ticking Haywire, ticking Bomb or ticking GoldBomb
   MovingObject* obj = nullptr;
-  std::vector<MovingObject*> objs = Sector::get().get_nearby_objects(get_bbox().get_middle(), SAFE_DIST);
-  for (MovingObject* currobj : objs)
-  {
-    obj = currobj;
-
-    auto player = dynamic_cast<Player*>(obj);
-    if (player && !player->get_ghost_mode())
-      break;
+  Sector::get().for_each_nearby_object(get_bbox().get_middle(), SAFE_DIST,
+    [&obj](MovingObject& currobj)
+    {
+      if (obj)
+        return;
 
-    auto haywire = dynamic_cast<Haywire*>(obj);
-    if (haywire && haywire->is_exploding())
-      break;
+      auto player = dynamic_cast<Player*>(&currobj);
+      if (player && !player->get_ghost_mode())
+        obj = &currobj;
 
-    auto bomb = dynamic_cast<MrBomb*>(obj);
-    if (bomb && bomb->is_ticking())
-      break;
+      auto haywire = dynamic_cast<Haywire*>(&currobj);
+      if (haywire && haywire->is_exploding())
+        obj = &currobj;
 
-    obj = nullptr;
-  }
+      auto bomb = dynamic_cast<MrBomb*>(&currobj);
+      if (bomb && bomb->is_ticking())
+        obj = &currobj;
+    },
+    // Static obstacles and decoration can never be a threat.
+    COLGROUP_MASK_ALL & ~(colgroup_mask(COLGROUP_STATIC) | colgroup_mask(COLGROUP_MOVING_ONLY_STATIC)));
 
   if (!obj)
   {
@@ -35,6 +35,13 @@ const float NORMAL_WALK_SPEED = 80.0f;
 const float EXPLODING_WALK_SPEED = 250.0f;
 const float SKID_TIME = 0.3f;
 
+const ActionId ACTION_LEFT("left");
+const ActionId ACTION_RIGHT("right");
+const ActionId ACTION_ACTIVE_LEFT("active-left");
+const ActionId ACTION_ACTIVE_RIGHT("active-right");
+const ActionId ACTION_TICKING_LEFT("ticking-left");
+const ActionId ACTION_TICKING_RIGHT("ticking-right");
+
 } // namespace
 
 Haywire::Haywire(const ReaderMapping& reader) :
@@ -184,13 +191,13 @@ Haywire::active_update(float dt_sec)
         set_action("ticking", m_last_player_direction, /* loops = */ -1);
         m_exploding_sprite->set_action("run", /* loops = */ -1);
       }
-      walk_left_action = "ticking-left";
-      walk_right_action = "ticking-right";
+      walk_left_action = ACTION_TICKING_LEFT;
+      walk_right_action = ACTION_TICKING_RIGHT;
     }
     else {
       set_action("active", m_dir, /* loops = */ 1);
-      walk_left_action = "active-left";
-      walk_right_action = "active-right";
+      walk_left_action = ACTION_ACTIVE_LEFT;
+      walk_right_action = ACTION_ACTIVE_RIGHT;
     }
 
     float target_velocity = 0.f;
@@ -303,8 +310,8 @@ Haywire::start_exploding()
 void
 Haywire::stop_exploding()
 {
-  walk_left_action = "left";
-  walk_right_action = "right";
+  walk_left_action = ACTION_LEFT;
+  walk_right_action = ACTION_RIGHT;
   set_walk_speed(NORMAL_WALK_SPEED);
   set_ledge_behavior(LedgeBehavior::SMART);
   time_until_explosion = 0.0f;
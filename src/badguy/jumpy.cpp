@@ -25,6 +25,11 @@ static const float JUMPYSPEED =- 600;
 static const float JUMPY_MID_TOLERANCE = 4;
 static const float JUMPY_LOW_TOLERANCE = 2;
 
+static const ActionId ACTION_EDITOR("editor");
+static const ActionId ACTION_MIDDLE("middle", ActionId::Format::DIRECTION_NAME);
+static const ActionId ACTION_DOWN("down", ActionId::Format::DIRECTION_NAME);
+static const ActionId ACTION_UP("up", ActionId::Format::DIRECTION_NAME);
+
 Jumpy::Jumpy(const ReaderMapping& reader) :
   BadGuy(reader, "images/creatures/jumpy/snowjumpy.sprite"),
   pos_groundhit(0.0f, 0.0f),
@@ -32,7 +37,7 @@ Jumpy::Jumpy(const ReaderMapping& reader) :
 {
   parse_type(reader);
 
-  set_action(m_dir, "middle");
+  set_action(ACTION_MIDDLE, m_dir);
   // TODO: Create a suitable sound for this...
   // SoundManager::current()->preload("sounds/skid.wav");
 }
@@ -115,7 +120,7 @@ Jumpy::active_update(float dt_sec)
 
   if (!groundhit_pos_set)
   {
-    set_action("editor", m_dir);
+    set_action(ACTION_EDITOR, m_dir);
     return;
   }
 
@@ -123,17 +128,17 @@ Jumpy::active_update(float dt_sec)
   {
     // Jumpy is below its groundhit position,
     // ground tile probably doesn't exist anymore
-    set_action(m_dir, "down");
+    set_action(ACTION_DOWN, m_dir);
     return;
   }
 
   if ( get_pos().y < (pos_groundhit.y - JUMPY_MID_TOLERANCE ) )
-    set_action(m_dir, "up");
+    set_action(ACTION_UP, m_dir);
   else if ( get_pos().y >= (pos_groundhit.y - JUMPY_MID_TOLERANCE) &&
             get_pos().y < (pos_groundhit.y - JUMPY_LOW_TOLERANCE) )
-    set_action(m_dir, "middle");
+    set_action(ACTION_MIDDLE, m_dir);
   else
-    set_action(m_dir, "down");
+    set_action(ACTION_DOWN, m_dir);
 }
 
 void
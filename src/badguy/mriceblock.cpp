@@ -30,6 +30,10 @@ namespace {
   const float KICKSPEED = 500;
   const int MAXSQUISHES = 10;
   const float NOKICK_TIME = 0.1f;
+
+  const ActionId ACTION_DIRECTION("");
+  const ActionId ACTION_FLAT("flat");
+  const ActionId ACTION_WAKING("waking");
 }
 
 MrIceBlock::MrIceBlock(const ReaderMapping& reader, const std::string& sprite_name) :
@@ -166,7 +170,7 @@ MrIceBlock::collision_solid(const CollisionHit& hit)
       SoundManager::current()->play("sounds/iceblock_bump.wav", get_pos());
       m_physic.set_velocity_x(-m_physic.get_velocity_x() * .975f);
     }
-    set_action("flat", m_dir, /* loops = */ -1);
+    set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
     if (fabsf(m_physic.get_velocity_x()) < walk_speed * 1.5f)
       set_state(ICESTATE_NORMAL);
     break;
@@ -317,18 +321,18 @@ MrIceBlock::set_state(IceState state_)
 
   switch (state_) {
   case ICESTATE_NORMAL:
-    set_action(m_dir, /* loops = */ -1);
+    set_action(ACTION_DIRECTION, m_dir, /* loops = */ -1);
     WalkingBadguy::initialize();
     break;
   case ICESTATE_FLAT:
-    set_action("flat", m_dir, /* loops = */ -1);
+    set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
     flat_timer.start(4);
     break;
   case ICESTATE_KICKED:
     SoundManager::current()->play("sounds/kick.wav", get_pos());
 
     m_physic.set_velocity_x(m_dir == Direction::LEFT ? -KICKSPEED : KICKSPEED);
-    set_action("flat", m_dir, /* loops = */ -1);
+    set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
     // We should slide above 1 block holes now.
     m_col.m_bbox.set_size(34, 31.8f);
     break;
@@ -337,7 +341,7 @@ MrIceBlock::set_state(IceState state_)
     break;
   case ICESTATE_WAKING:
     flat_timer.stop();
-    set_action("waking", m_dir, /* loops = */ 1);
+    set_action(ACTION_WAKING, m_dir, /* loops = */ 1);
     break;
   default:
     assert(false);
@@ -357,7 +361,7 @@ MrIceBlock::grab(MovingObject& object, const Vector& pos, Direction dir_)
   Portable::grab(object, pos, dir_);
   m_col.set_movement(pos - get_pos());
   m_dir = dir_;
-  set_action("flat", m_dir, /* loops = */ -1);
+  set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
   set_state(ICESTATE_GRABBED);
   set_colgroup_active(COLGROUP_DISABLED);
 }
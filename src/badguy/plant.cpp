@@ -22,6 +22,11 @@
 static const float PLANT_SPEED = 80;
 static const float WAKE_TIME = .5;
 
+static const ActionId ACTION_DIRECTION("");
+static const ActionId ACTION_SLEEPING("sleeping");
+static const ActionId ACTION_WAKING("waking");
+static const ActionId ACTION_SLEEPING_BURNING("sleeping-burning");
+
 Plant::Plant(const ReaderMapping& reader) :
   BadGuy(reader, "images/creatures/plant/plant.sprite"),
   timer(),
@@ -37,7 +42,7 @@ Plant::initialize()
 
   state = PLANT_SLEEPING;
   m_physic.set_velocity_x(0);
-  set_action("sleeping", m_dir);
+  set_action(ACTION_SLEEPING, m_dir);
 }
 
 void
@@ -47,7 +52,7 @@ Plant::collision_solid(const CollisionHit& hit)
     m_physic.set_velocity_y(0);
   } else if (hit.left || hit.right) {
     m_dir = m_dir == Direction::LEFT ? Direction::RIGHT : Direction::LEFT;
-    set_action(m_dir);
+    set_action(ACTION_DIRECTION, m_dir);
     m_physic.set_velocity_x(-m_physic.get_velocity_x());
   }
 }
@@ -59,7 +64,7 @@ Plant::collision_badguy(BadGuy& , const CollisionHit& hit)
 
   if (hit.left || hit.right) {
     m_dir = m_dir == Direction::LEFT ? Direction::RIGHT : Direction::LEFT;
-    set_action(m_dir);
+    set_action(ACTION_DIRECTION, m_dir);
     m_physic.set_velocity_x(-m_physic.get_velocity_x());
   }
 
@@ -83,7 +88,7 @@ Plant::active_update(float dt_sec) {
 
       if (inReach_left && inReach_right && inReach_top && inReach_bottom) {
         // wake up
-        set_action("waking", m_dir);
+        set_action(ACTION_WAKING, m_dir);
         if (!timer.started()) timer.start(WAKE_TIME);
         state = PLANT_WAKING;
       }
@@ -93,7 +98,7 @@ Plant::active_update(float dt_sec) {
   if (state == PLANT_WAKING) {
     if (timer.check()) {
       // Start walking.
-      set_action(m_dir);
+      set_action(ACTION_DIRECTION, m_dir);
       m_physic.set_velocity_x(m_dir == Direction::LEFT ? -PLANT_SPEED : PLANT_SPEED);
       state = PLANT_WALKING;
     }
@@ -105,8 +110,8 @@ void
 Plant::ignite()
 {
   BadGuy::ignite();
-  if (state == PLANT_SLEEPING && m_sprite->has_action("sleeping-burning-left")) {
-    set_action("sleeping-burning", m_dir, 1);
+  if (state == PLANT_SLEEPING && m_sprite->has_action(ACTION_SLEEPING_BURNING, Direction::LEFT)) {
+    set_action(ACTION_SLEEPING_BURNING, m_dir, 1);
   }
 }
 /* EOF */
@@ -34,6 +34,12 @@ const float SNAIL_KICK_SPEED_Y = -500; /**< Y-velocity gained when kicked. */
 const float SNAIL_GUARD_DELAY = 5.f; /**< Time in-between corrupted snail guard states (seconds). */
 const float SNAIL_GUARD_TIME = 3.f; /**< Duration of corrupted snail guard states (seconds). */
 
+const ActionId ACTION_SHAKE("shake");
+const ActionId ACTION_FLAT("flat");
+const ActionId ACTION_WAKING("waking");
+const ActionId ACTION_GUARD("guard");
+const ActionId ACTION_RETRACT("retract");
+
 } // namespace
 
 Snail::Snail(const ReaderMapping& reader) :
@@ -101,7 +107,7 @@ Snail::be_guard()
   if (m_type != Type::CORRUPTED) return;
 
   state = STATE_GUARD_SHAKE;
-  set_action("shake", m_dir, /* loops = */ 1);
+  set_action(ACTION_SHAKE, m_dir, /* loops = */ 1);
   m_physic.set_velocity_x(0);
 }
 
@@ -109,7 +115,7 @@ void
 Snail::be_flat()
 {
   state = STATE_FLAT;
-  set_action("flat", m_dir, /* loops = */ -1);
+  set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
 
   m_physic.set_velocity(0, 0);
 
@@ -120,7 +126,7 @@ void
 Snail::be_grabbed()
 {
   state = STATE_GRABBED;
-  set_action("flat", m_dir, /* loops = */ -1);
+  set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
 }
 
 void
@@ -130,7 +136,7 @@ Snail::be_kicked(bool upwards)
     state = STATE_KICKED_DELAY;
   else
     state = STATE_KICKED;
-  set_action("flat", m_dir, /* loops = */ -1);
+  set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
 
   m_physic.set_velocity(m_dir == Direction::LEFT ? -SNAIL_KICK_SPEED : SNAIL_KICK_SPEED, 0);
 
@@ -143,7 +149,7 @@ void
 Snail::wake_up()
 {
   state = STATE_WAKING;
-  set_action("waking", m_dir, /* loops = */ 1);
+  set_action(ACTION_WAKING, m_dir, /* loops = */ 1);
 }
 
 bool
@@ -177,7 +183,7 @@ Snail::active_update(float dt_sec)
       if (m_sprite->animation_done())
       {
         state = STATE_GUARD;
-        set_action("guard", m_dir);
+        set_action(ACTION_GUARD, m_dir);
         SoundManager::current()->play("sounds/dartfire.wav", get_pos()); // TODO: Specific sounds for snail guard state.
         m_guard_end_timer.start(SNAIL_GUARD_TIME);
       }
@@ -187,7 +193,7 @@ Snail::active_update(float dt_sec)
       if (m_guard_end_timer.check())
       {
         state = STATE_GUARD_RETRACT;
-        set_action("retract", m_dir, /* loops = */ 1);
+        set_action(ACTION_RETRACT, m_dir, /* loops = */ 1);
         SoundManager::current()->play("sounds/dartfire.wav", get_pos()); // TODO: Specific sounds for snail guard state.
       }
       break;
@@ -258,7 +264,7 @@ Snail::collision_solid(const CollisionHit& hit)
 
         if ( ( m_dir == Direction::LEFT && hit.left ) || ( m_dir == Direction::RIGHT && hit.right) ){
           m_dir = (m_dir == Direction::LEFT) ? Direction::RIGHT : Direction::LEFT;
-          set_action("flat", m_dir, /* loops = */ -1);
+          set_action(ACTION_FLAT, m_dir, /* loops = */ -1);
 
           m_physic.set_velocity(-m_physic.get_velocity_x(), -std::abs(m_physic.get_velocity_x()));
         }
@@ -393,7 +399,7 @@ Snail::grab(MovingObject& object, const Vector& pos, Direction dir_)
   m_dir = dir_;
   if (!m_frozen)
   {
-    set_action("flat", dir_, /* loops = */ -1);
+    set_action(ACTION_FLAT, dir_, /* loops = */ -1);
     be_grabbed();
     flat_timer.stop();
   }
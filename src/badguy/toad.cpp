@@ -25,6 +25,10 @@ const float VERTICAL_SPEED = -450;   /**< Vertical speed when jumping. */
 const float HORIZONTAL_SPEED = 320; /**< Horizontal speed when jumping. */
 const float TOAD_RECOVER_TIME = 0.5; /**< Time to stand still before starting a (new) jump. */
 static const std::string HOP_SOUND = "sounds/hop.ogg";
+
+const ActionId ACTION_JUMPING("jumping");
+const ActionId ACTION_IDLE("idle");
+const ActionId ACTION_SQUISHED("squished");
 }
 
 Toad::Toad(const ReaderMapping& reader) :
@@ -40,7 +44,7 @@ Toad::initialize()
 {
   // The initial state is JUMPING, because we might start airborne.
   state = JUMPING;
-  set_action("jumping", m_dir);
+  set_action(ACTION_JUMPING, m_dir);
 }
 
 void
@@ -49,12 +53,12 @@ Toad::set_state(ToadState newState)
   if (newState == IDLE) {
     m_physic.set_velocity(0, 0);
     if (!m_frozen)
-      set_action("idle", m_dir);
+      set_action(ACTION_IDLE, m_dir);
 
     recover_timer.start(TOAD_RECOVER_TIME);
   } else
     if (newState == JUMPING) {
-      set_action("jumping", m_dir);
+      set_action(ACTION_JUMPING, m_dir);
       m_physic.set_velocity(m_dir == Direction::LEFT ? -HORIZONTAL_SPEED : HORIZONTAL_SPEED, VERTICAL_SPEED);
       SoundManager::current()->play( HOP_SOUND, get_pos());
     } else
@@ -63,7 +67,7 @@ Toad::set_state(ToadState newState)
         // Face the player.
         if (player && (player->get_bbox().get_right() < m_col.m_bbox.get_left()) && (m_dir == Direction::RIGHT)) m_dir = Direction::LEFT;
         if (player && (player->get_bbox().get_left() > m_col.m_bbox.get_right()) && (m_dir == Direction::LEFT)) m_dir = Direction::RIGHT;
-        set_action("idle", m_dir);
+        set_action(ACTION_IDLE, m_dir);
       }
 
   state = newState;
@@ -74,7 +78,7 @@ Toad::collision_squished(GameObject& object)
 {
   if (m_frozen)
     return BadGuy::collision_squished(object);
-  set_action("squished", m_dir);
+  set_action(ACTION_SQUISHED, m_dir);
   kill_squished(object);
   return true;
 }
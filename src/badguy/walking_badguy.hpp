@@ -86,8 +86,8 @@ protected:
   static const int s_normal_max_drop_height = 600;
 
 protected:
-  std::string walk_left_action;
-  std::string walk_right_action;
+  ActionId walk_left_action;
+  ActionId walk_right_action;
   float walk_speed;
   int max_drop_height; /**< Maximum height of drop before we will turn around, or -1 to just drop from any ledge */
   Timer turn_around_timer;
@@ -23,6 +23,14 @@
 #include "object/player.hpp"
 #include "sprite/sprite.hpp"
 
+namespace {
+
+const ActionId ACTION_DIRECTION("");
+const ActionId ACTION_SQUISHED("squished");
+const ActionId ACTION_DIVE("dive");
+
+} // namespace
+
 Zeekling::Zeekling(const ReaderMapping& reader) :
   BadGuy(reader, "images/creatures/zeekling/zeekling.sprite"),
   speed(gameRandom.randf(130.0f, 171.0f)),
@@ -39,7 +47,7 @@ void
 Zeekling::initialize()
 {
   m_physic.set_velocity_x(m_dir == Direction::LEFT ? -speed : speed);
-  set_action(m_dir);
+  set_action(ACTION_DIRECTION, m_dir);
 }
 
 bool
@@ -48,7 +56,7 @@ Zeekling::collision_squished(GameObject& object)
   if (m_frozen)
     return BadGuy::collision_squished(object);
 
-  set_action("squished", m_dir);
+  set_action(ACTION_SQUISHED, m_dir);
   kill_squished(object);
   return true;
 }
@@ -58,18 +66,18 @@ Zeekling::onBumpHorizontal()
 {
   if (state == FLYING) {
     m_dir = (m_dir == Direction::LEFT ? Direction::RIGHT : Direction::LEFT);
-    set_action(m_dir);
+    set_action(ACTION_DIRECTION, m_dir);
     m_physic.set_velocity_x(m_dir == Direction::LEFT ? -speed : speed);
   } else
     if (state == DIVING) {
       m_dir = (m_dir == Direction::LEFT ? Direction::RIGHT : Direction::LEFT);
       state = FLYING;
-      set_action(m_dir);
+      set_action(ACTION_DIRECTION, m_dir);
       m_physic.set_velocity(m_dir == Direction::LEFT ? -speed : speed, 0);
     } else
       if (state == CLIMBING) {
         m_dir = (m_dir == Direction::LEFT ? Direction::RIGHT : Direction::LEFT);
-        set_action(m_dir);
+        set_action(ACTION_DIRECTION, m_dir);
         m_physic.set_velocity_x(m_dir == Direction::LEFT ? -speed : speed);
       } else {
         assert(false);
@@ -90,7 +98,7 @@ Zeekling::onBumpVertical()
     if (state == DIVING) {
       state = CLIMBING;
       m_physic.set_velocity_y(-speed);
-      set_action(m_dir);
+      set_action(ACTION_DIRECTION, m_dir);
     } else
       if (state == CLIMBING) {
         state = FLYING;
@@ -179,7 +187,7 @@ Zeekling::active_update(float dt_sec) {
     if (should_we_dive()) {
       state = DIVING;
       m_physic.set_velocity_y(2*fabsf(m_physic.get_velocity_x()));
-      set_action("dive", m_dir);
+      set_action(ACTION_DIVE, m_dir);
     }
     BadGuy::active_update(dt_sec);
     return;
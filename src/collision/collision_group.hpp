@@ -18,6 +18,8 @@
 #ifndef HEADER_SUPERTUX_COLLISION_COLLISION_GROUP_HPP
 #define HEADER_SUPERTUX_COLLISION_COLLISION_GROUP_HPP
 
+#include <stdint.h>
+
 enum CollisionGroup {
   /** Objects in DISABLED group are not tested for collisions */
   COLGROUP_DISABLED = 0,
@@ -62,6 +64,21 @@ enum CollisionGroup {
   COLGROUP_TOUCHABLE
 };
 
+/** Returns the bit representing the given group in collision group masks,
+    used to filter spatial queries. */
+constexpr uint32_t colgroup_mask(CollisionGroup group)
+{
+  return 1u << static_cast<uint32_t>(group);
+}
+
+/** Mask matching all collision groups. */
+const uint32_t COLGROUP_MASK_ALL = colgroup_mask(COLGROUP_DISABLED) |
+                                   colgroup_mask(COLGROUP_MOVING_STATIC) |
+                                   colgroup_mask(COLGROUP_MOVING) |
+                                   colgroup_mask(COLGROUP_MOVING_ONLY_STATIC) |
+                                   colgroup_mask(COLGROUP_STATIC) |
+                                   colgroup_mask(COLGROUP_TOUCHABLE);
+
 #endif
 
 /* EOF */
@@ -17,7 +17,10 @@
 #ifndef HEADER_SUPERTUX_COLLISION_COLLISION_LISTENER_HPP
 #define HEADER_SUPERTUX_COLLISION_COLLISION_LISTENER_HPP
 
-class CollisionHit;
+#include <stdint.h>
+
+#include "collision/collision_hit.hpp"
+
 class GameObject;
 
 class CollisionListener
@@ -30,7 +30,8 @@ CollisionObject::CollisionObject(CollisionGroup group, CollisionListener& listen
   m_unisolid(false),
   m_pressure(),
   m_objects_hit_bottom(),
-  m_ground_movement_manager(nullptr)
+  m_ground_movement_manager(nullptr),
+  m_spatial_index(nullptr)
 {
 }
 
@@ -24,6 +24,7 @@
 
 #include "collision/collision_group.hpp"
 #include "collision/collision_hit.hpp"
+#include "collision/collision_spatial_index.hpp"
 #include "math/rectf.hpp"
 
 class CollisionListener;
@@ -33,6 +34,7 @@ class GameObject;
 class CollisionObject
 {
   friend class CollisionSystem;
+  friend class CollisionSpatialIndex;
 
 public:
   CollisionObject(CollisionGroup group, CollisionListener& parent);
@@ -91,6 +93,7 @@ public:
   {
     m_dest.move(pos - get_pos());
     m_bbox.set_pos(pos);
+    invalidate_spatial_index();
   }
 
   Vector get_pos() const
@@ -118,6 +121,7 @@ public:
   {
     m_dest.set_width(w);
     m_bbox.set_width(w);
+    invalidate_spatial_index();
   }
 
   /** sets the moving object's bbox to a specific size. Be careful
@@ -127,6 +131,15 @@ public:
   {
     m_dest.set_size(w, h);
     m_bbox.set_size(w, h);
+    invalidate_spatial_index();
+  }
+
+  /** Has to be called after changing m_bbox directly, so that spatial
+      queries don't miss the object at its new position. */
+  void invalidate_spatial_index()
+  {
+    if (m_spatial_index)
+      m_spatial_index->invalidate();
   }
 
   CollisionGroup get_group() const
@@ -180,6 +193,9 @@ private:
 
   std::shared_ptr<CollisionGroundMovementManager> m_ground_movement_manager;
 
+  /** The spatial index this object is attached to, if any */
+  CollisionSpatialIndex* m_spatial_index;
+
 private:
   CollisionObject(const CollisionObject&) = delete;
   CollisionObject& operator=(const CollisionObject&) = delete;
@@ -0,0 +1,171 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/collision_spatial_index.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "collision/collision_object.hpp"
+
+namespace {
+
+const float DEFAULT_CELL_SIZE = 128.0f;
+
+/** Upper limit for the amount of cells in the grid. If the objects are
+    spread wider, the cell size is increased instead. */
+const int MAX_CELLS = 1 << 16;
+
+/** Objects covering more cells than this are not put into the grid. */
+const int MAX_CELLS_PER_OBJECT = 64;
+
+} // namespace
+
+CollisionSpatialIndex::CollisionSpatialIndex() :
+  m_valid(false),
+  m_cell_size(DEFAULT_CELL_SIZE),
+  m_origin(0.0f, 0.0f),
+  m_columns(0),
+  m_rows(0),
+  m_cell_start(),
+  m_cell_fill(),
+  m_object_entries(),
+  m_entries(),
+  m_large_objects()
+{
+}
+
+void
+CollisionSpatialIndex::attach(CollisionObject& object)
+{
+  object.m_spatial_index = this;
+  m_valid = false;
+}
+
+void
+CollisionSpatialIndex::detach(CollisionObject& object)
+{
+  if (object.m_spatial_index == this)
+    object.m_spatial_index = nullptr;
+  m_valid = false;
+}
+
+void
+CollisionSpatialIndex::rebuild(const std::vector<CollisionObject*>& objects)
+{
+  m_valid = true;
+  m_object_entries.clear();
+  m_large_objects.clear();
+  m_columns = 0;
+  m_rows = 0;
+
+  // Determine the area covered by the objects.
+  float min_x = std::numeric_limits<float>::max();
+  float min_y = std::numeric_limits<float>::max();
+  float max_x = std::numeric_limits<float>::lowest();
+  float max_y = std::numeric_limits<float>::lowest();
+  for (const auto* object : objects)
+  {
+    const Rectf& bbox = object->get_bbox();
+    if (!std::isfinite(bbox.get_left()) || !std::isfinite(bbox.get_top()) ||
+        !std::isfinite(bbox.get_right()) || !std::isfinite(bbox.get_bottom()))
+      continue;
+
+    min_x = std::min(min_x, bbox.get_left());
+    min_y = std::min(min_y, bbox.get_top());
+    max_x = std::max(max_x, bbox.get_right());
+    max_y = std::max(max_y, bbox.get_bottom());
+  }
+
+  if (min_x > max_x || min_y > max_y)
+  {
+    // No objects with a valid bounding box, report everything as a candidate.
+    m_large_objects = objects;
+    return;
+  }
+
+  m_origin = Vector(min_x, min_y);
+  m_cell_size = DEFAULT_CELL_SIZE;
+  while (true)
+  {
+    m_columns = static_cast<int>((max_x - min_x) / m_cell_size) + 1;
+    m_rows = static_cast<int>((max_y - min_y) / m_cell_size) + 1;
+    if (static_cast<long long>(m_columns) * m_rows <= MAX_CELLS)
+      break;
+
+    m_cell_size *= 2.0f;
+  }
+
+  const int cell_count = m_columns * m_rows;
+  m_cell_start.assign(cell_count + 1, 0);
+
+  // First pass: count the entries in each cell.
+  for (auto* object : objects)
+  {
+    const Rectf& bbox = object->get_bbox();
+    if (!std::isfinite(bbox.get_left()) || !std::isfinite(bbox.get_top()) ||
+        !std::isfinite(bbox.get_right()) || !std::isfinite(bbox.get_bottom()))
+    {
+      m_large_objects.push_back(object);
+      continue;
+    }
+
+    const Rect cells = get_cells(bbox);
+    if ((cells.get_width() + 1) * (cells.get_height() + 1) > MAX_CELLS_PER_OBJECT)
+    {
+      m_large_objects.push_back(object);
+      continue;
+    }
+
+    for (int y = cells.top; y <= cells.bottom; ++y)
+      for (int x = cells.left; x <= cells.right; ++x)
+        m_cell_start[y * m_columns + x + 1] += 1;
+
+    m_object_entries.push_back({ object, cells });
+  }
+
+  for (int i = 0; i < cell_count; ++i)
+    m_cell_start[i + 1] += m_cell_start[i];
+
+  // Second pass: fill in the entries, ordered by cell.
+  m_entries.resize(m_cell_start[cell_count]);
+  m_cell_fill.assign(m_cell_start.begin(), m_cell_start.end() - 1);
+
+  for (const auto& entry : m_object_entries)
+    for (int y = entry.cells.top; y <= entry.cells.bottom; ++y)
+      for (int x = entry.cells.left; x <= entry.cells.right; ++x)
+        m_entries[m_cell_fill[y * m_columns + x]++] = entry;
+}
+
+Rect
+CollisionSpatialIndex::get_cells(const Rectf& rect) const
+{
+  const auto to_cell = [this](float value, float origin, int count) {
+    const float cell = std::floor((value - origin) / m_cell_size);
+    if (!(cell > 0.0f)) // Also catches NaN.
+      return 0;
+    if (cell >= static_cast<float>(count - 1))
+      return count - 1;
+    return static_cast<int>(cell);
+  };
+
+  return Rect(to_cell(rect.get_left(), m_origin.x, m_columns),
+              to_cell(rect.get_top(), m_origin.y, m_rows),
+              to_cell(rect.get_right(), m_origin.x, m_columns),
+              to_cell(rect.get_bottom(), m_origin.y, m_rows));
+}
+
+/* EOF */
@@ -0,0 +1,136 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_COLLISION_COLLISION_SPATIAL_INDEX_HPP
+#define HEADER_SUPERTUX_COLLISION_COLLISION_SPATIAL_INDEX_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "math/rectf.hpp"
+
+class CollisionObject;
+
+/**
+ * A uniform grid over the bounding boxes of collision objects.
+
+   The grid is a snapshot: it is rebuilt from the current bounding boxes
+   by rebuild() and does not follow objects as they move afterwards.
+   Objects attached to the index invalidate it, when they are moved or
+   resized outside of collision detection (e.g. by set_pos()), so that
+   its owner knows to rebuild it before the next query. Queries only
+   return candidates, which the caller has to test against the actual
+   bounding box. Cells are stored in a single flat array, so rebuilding
+   and querying do not allocate once the internal buffers have grown to
+   the size of the sector.
+ */
+class CollisionSpatialIndex final
+{
+private:
+  struct Entry
+  {
+    CollisionObject* object;
+
+    /** Cell range covered by the object (inclusive). */
+    Rect cells;
+  };
+
+public:
+  CollisionSpatialIndex();
+
+  /** Rebuild the grid from the current bounding boxes of the given objects. */
+  void rebuild(const std::vector<CollisionObject*>& objects);
+
+  /** Lets the object invalidate the index, whenever its bounding box is
+      changed outside of collision detection. */
+  void attach(CollisionObject& object);
+  void detach(CollisionObject& object);
+
+  /** Returns false, if the index has to be rebuilt before it is queried. */
+  bool is_valid() const { return m_valid; }
+  void invalidate() { m_valid = false; }
+
+  /** Calls func(CollisionObject&) exactly once for each object, whose
+      indexed cells overlap the cells covered by the given rectangle. */
+  template<typename F>
+  void for_each_candidate(const Rectf& rect, F&& func) const
+  {
+    for (CollisionObject* object : m_large_objects)
+      func(*object);
+
+    if (m_columns == 0 || m_rows == 0)
+      return;
+
+    const Rect cells = get_cells(rect);
+    for (int y = cells.top; y <= cells.bottom; ++y)
+    {
+      for (int x = cells.left; x <= cells.right; ++x)
+      {
+        const int cell = y * m_columns + x;
+        for (int i = m_cell_start[cell]; i < m_cell_start[cell + 1]; ++i)
+        {
+          const Entry& entry = m_entries[i];
+
+          // Objects spanning multiple cells are only reported in the
+          // first cell they share with the queried range.
+          if (x != std::max(entry.cells.left, cells.left) ||
+              y != std::max(entry.cells.top, cells.top))
+            continue;
+
+          func(*entry.object);
+        }
+      }
+    }
+  }
+
+  float get_cell_size() const { return m_cell_size; }
+
+private:
+  /** Returns the (inclusive) range of cells covered by the rectangle,
+      clamped to the grid. */
+  Rect get_cells(const Rectf& rect) const;
+
+private:
+  bool m_valid;
+  float m_cell_size;
+  Vector m_origin;
+  int m_columns;
+  int m_rows;
+
+  /** Index of the first entry of each cell in m_entries, with one
+      trailing element marking the end of the last cell. */
+  std::vector<int> m_cell_start;
+  std::vector<int> m_cell_fill;
+
+  /** One entry per indexed object, used while rebuilding. */
+  std::vector<Entry> m_object_entries;
+
+  /** Entries of all cells, ordered by cell. */
+  std::vector<Entry> m_entries;
+
+  /** Objects covering too many cells to be worth indexing. They are
+      reported as candidates for every query. */
+  std::vector<CollisionObject*> m_large_objects;
+
+private:
+  CollisionSpatialIndex(const CollisionSpatialIndex&) = delete;
+  CollisionSpatialIndex& operator=(const CollisionSpatialIndex&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -26,6 +26,7 @@
 #include "object/tilemap.hpp"
 #include "supertux/constants.hpp"
 #include "supertux/sector.hpp"
+#include "supertux/solid_tile_bitmap.hpp"
 #include "supertux/tile.hpp"
 #include "video/color.hpp"
 #include "video/drawing_context.hpp"
@@ -40,6 +41,7 @@ static const float FORGIVENESS = 256.f; // 16.f * 16.f - half a tile by half a t
 CollisionSystem::CollisionSystem(Sector& sector) :
   m_sector(sector),
   m_objects(),
+  m_spatial_index(),
   m_ground_movement_manager(new CollisionGroundMovementManager)
 {
 }
@@ -49,6 +51,7 @@ CollisionSystem::add(CollisionObject* object)
 {
   object->set_ground_movement_manager(m_ground_movement_manager);
   m_objects.push_back(object);
+  m_spatial_index.attach(*object);
 }
 
 void
@@ -57,6 +60,7 @@ CollisionSystem::remove(CollisionObject* object)
   m_objects.erase(
     std::find(m_objects.begin(), m_objects.end(),
               object));
+  m_spatial_index.detach(*object);
 
   // FIXME: This is a patch. A better way of fixing this is coming.
   for (auto* collision_object : m_objects) {
@@ -230,8 +234,15 @@ CollisionSystem::collision_tilemap(collision::Constraints* constraints,
   const float y1 = dest.get_top();
   const float y2 = dest.get_bottom();
 
+  // Tilemaps merged into the bitmap can be skipped, if it has no tiles in the rectangle.
+  const SolidTileBitmap& bitmap = m_sector.get_solid_tile_bitmap();
+  const bool bitmap_free = bitmap.is_free(Rectf(x1, y1, x2, y2));
+
   for (auto* solids : m_sector.get_solid_tilemaps())
   {
+    if (bitmap_free && bitmap.contains(*solids))
+      continue;
+
     // Test with all tiles in this rectangle.
     const Rect test_tiles = solids->get_tiles_overlapping(Rectf(x1, y1, x2, y2));
 
@@ -241,32 +252,32 @@ CollisionSystem::collision_tilemap(collision::Constraints* constraints,
     {
       for (int y = test_tiles.top; y < test_tiles.bottom; ++y)
       {
-        const Tile& tile = solids->get_tile(x, y);
+        const TileMap::CollisionTile& tile = solids->get_collision_tile(x, y);
 
         // Skip non-solid tiles.
-        if (tile.is_solid())
+        if (tile.attributes & Tile::SOLID)
         {
           Rectf tile_bbox = solids->get_tile_bbox(x, y);
           bool is_relatively_solid = true;
 
-          /* If the tile is a unisolid tile, the "is_solid()" function above
-          * didn't do a thorough check. Calculate the position and (relative)
+          /* If the tile is a unisolid tile, the SOLID attribute check above
+          * isn't thorough. Calculate the position and (relative)
           * movement of the object and determine whether or not the tile is
           * solid with regard to those parameters. */
-          if (tile.is_unisolid ())
+          if (tile.attributes & Tile::UNISOLID)
           {
             Vector relative_movement = movement
               - solids->get_movement(/* actual = */ true);
 
-            if (!tile.is_solid (tile_bbox, object.get_bbox(), relative_movement))
+            if (!solids->get_tile(x, y).is_solid(tile_bbox, object.get_bbox(), relative_movement))
               is_relatively_solid = false;
           }
 
           if (is_relatively_solid)
           {
-            if (tile.is_slope ()) { // Slope tile.
+            if (tile.attributes & Tile::SLOPE) { // Slope tile.
               AATriangle triangle;
-              int slope_data = tile.get_data();
+              int slope_data = tile.data;
               if (solids->get_flip() & VERTICAL_FLIP)
                 slope_data = AATriangle::vertical_flip(slope_data);
               triangle = AATriangle(tile_bbox, slope_data);
@@ -297,9 +308,15 @@ CollisionSystem::collision_tile_attributes(const Rectf& dest, const Vector& mov)
   const float x2 = dest.get_right();
   const float y2 = dest.get_bottom();
 
+  const SolidTileBitmap& bitmap = m_sector.get_solid_tile_bitmap();
+  const bool bitmap_free = bitmap.is_free(Rectf(x1, y1, x2, y2 + SHIFT_DELTA));
+
   uint32_t result = 0;
   for (auto& solids: m_sector.get_solid_tilemaps())
   {
+    if (bitmap_free && bitmap.contains(*solids))
+      continue;
+
     // Test with all tiles in this rectangle.
     const Rect test_tiles = solids->get_tiles_overlapping(Rectf(x1, y1, x2, y2));
 
@@ -309,16 +326,20 @@ CollisionSystem::collision_tile_attributes(const Rectf& dest, const Vector& mov)
     for (int x = test_tiles.left; x < test_tiles.right; ++x) {
       int y;
       for (y = test_tiles.top; y < test_tiles.bottom; ++y) {
-        const Tile& tile = solids->get_tile(x, y);
+        const uint32_t attributes = solids->get_collision_tile(x, y).attributes;
+        if (!attributes)
+          continue;
 
-        if ( tile.is_collisionful( solids->get_tile_bbox(x, y), dest, mov) ) {
-          result |= tile.get_attributes();
+        if ( solids->get_tile(x, y).is_collisionful( solids->get_tile_bbox(x, y), dest, mov) ) {
+          result |= attributes;
         }
       }
       for (; y < test_tiles_ice.bottom; ++y) {
-        const Tile& tile = solids->get_tile(x, y);
-        if ( tile.is_collisionful( solids->get_tile_bbox(x, y), dest, mov) ) {
-          result |= (tile.get_attributes() & Tile::ICE);
+        if (!(solids->get_collision_tile(x, y).attributes & Tile::ICE))
+          continue;
+
+        if ( solids->get_tile(x, y).is_collisionful( solids->get_tile_bbox(x, y), dest, mov) ) {
+          result |= Tile::ICE;
         }
       }
     }
@@ -671,6 +692,7 @@ CollisionSystem::update()
     object->m_bbox = object->m_dest;
     object->m_movement = Vector(0, 0);
   }
+  m_spatial_index.invalidate();
 }
 
 bool
@@ -678,22 +700,28 @@ CollisionSystem::is_free_of_tiles(const Rectf& rect, const bool ignoreUnisolid,
 {
   using namespace collision;
 
+  const SolidTileBitmap& bitmap = m_sector.get_solid_tile_bitmap();
+  const bool bitmap_free = bitmap.is_free(rect);
+
   for (const auto& solids : m_sector.get_solid_tilemaps()) {
+    if (bitmap_free && bitmap.contains(*solids))
+      continue;
+
     // Test with all tiles in this rectangle.
     const Rect test_tiles = solids->get_tiles_overlapping(rect);
 
     for (int x = test_tiles.left; x < test_tiles.right; ++x) {
       for (int y = test_tiles.top; y < test_tiles.bottom; ++y) {
-        const Tile& tile = solids->get_tile(x, y);
+        const TileMap::CollisionTile& tile = solids->get_collision_tile(x, y);
 
-        if (!(tile.get_attributes() & tiletype))
+        if (!(tile.attributes & tiletype))
           continue;
-        if (tile.is_unisolid () && ignoreUnisolid)
+        if ((tile.attributes & Tile::UNISOLID) && ignoreUnisolid)
           continue;
-        if (tile.is_slope ()) {
+        if (tile.attributes & Tile::SLOPE) {
           AATriangle triangle;
           const Rectf tbbox = solids->get_tile_bbox(x, y);
-          triangle = AATriangle(tbbox, tile.get_data());
+          triangle = AATriangle(tbbox, tile.data);
           Constraints constraints;
           if (!collision::rectangle_aatriangle(&constraints, rect, triangle))
             continue;
@@ -714,15 +742,15 @@ CollisionSystem::is_free_of_statics(const Rectf& rect, const CollisionObject* ig
 
   if (!is_free_of_tiles(rect, ignoreUnisolid)) return false;
 
-  for (const auto& object : m_objects) {
-    if (object == ignore_object) continue;
-    if (!object->is_valid()) continue;
-    if (object->get_group() == COLGROUP_STATIC) {
-      if (rect.overlaps(object->get_bbox())) return false;
-    }
-  }
+  bool is_free = true;
+  for_each_overlapping_object(rect,
+    [ignore_object, &is_free](CollisionObject& object) {
+      if (&object != ignore_object && object.is_valid())
+        is_free = false;
+    },
+    colgroup_mask(COLGROUP_STATIC));
 
-  return true;
+  return is_free;
 }
 
 bool
@@ -732,17 +760,15 @@ CollisionSystem::is_free_of_movingstatics(const Rectf& rect, const CollisionObje
 
   if (!is_free_of_tiles(rect)) return false;
 
-  for (const auto& object : m_objects) {
-    if (object == ignore_object) continue;
-    if (!object->is_valid()) continue;
-    if ((object->get_group() == COLGROUP_MOVING)
-        || (object->get_group() == COLGROUP_MOVING_STATIC)
-        || (object->get_group() == COLGROUP_STATIC)) {
-      if (rect.overlaps(object->get_bbox())) return false;
-    }
-  }
+  bool is_free = true;
+  for_each_overlapping_object(rect,
+    [ignore_object, &is_free](CollisionObject& object) {
+      if (&object != ignore_object && object.is_valid())
+        is_free = false;
+    },
+    colgroup_mask(COLGROUP_MOVING) | colgroup_mask(COLGROUP_MOVING_STATIC) | colgroup_mask(COLGROUP_STATIC));
 
-  return true;
+  return is_free;
 }
 
 bool
@@ -750,15 +776,15 @@ CollisionSystem::is_free_of_specifically_movingstatics(const Rectf& rect, const
 {
   using namespace collision;
 
-  for (const auto& object : m_objects) {
-    if (object == ignore_object) continue;
-    if (!object->is_valid()) continue;
-    if ((object->get_group() == COLGROUP_MOVING_STATIC)
-        && (rect.overlaps(object->get_bbox())))
-      return false;
-  }
+  bool is_free = true;
+  for_each_overlapping_object(rect,
+    [ignore_object, &is_free](CollisionObject& object) {
+      if (&object != ignore_object && object.is_valid())
+        is_free = false;
+    },
+    colgroup_mask(COLGROUP_MOVING_STATIC));
 
-  return true;
+  return is_free;
 }
 
 CollisionSystem::RaycastResult
@@ -833,18 +859,4 @@ CollisionSystem::free_line_of_sight(const Vector& line_start, const Vector& line
   return !get_first_line_intersection(line_start, line_end, ignore_objects, ignore_object).is_valid;
 }
 
-std::vector<CollisionObject*>
-CollisionSystem::get_nearby_objects (const Vector& center, float max_distance) const
-{
-  std::vector<CollisionObject*> ret;
-
-  for (const auto& object : m_objects) {
-    float distance = object->get_bbox().distance(center);
-    if (distance <= max_distance)
-      ret.push_back(object);
-  }
-
-  return ret;
-}
-
 /* EOF */
@@ -24,10 +24,11 @@
 #include <stdint.h>
 
 #include "collision/collision.hpp"
+#include "collision/collision_object.hpp"
+#include "collision/collision_spatial_index.hpp"
 #include "supertux/tile.hpp"
 #include "math/fwd.hpp"
 
-class CollisionObject;
 class CollisionGroundMovementManager;
 class DrawingContext;
 class Rectf;
@@ -74,9 +75,53 @@ public:
                                             const CollisionObject* ignore_object) const;
   bool free_line_of_sight(const Vector& line_start, const Vector& line_end, bool ignore_objects, const CollisionObject* ignore_object) const;
 
-  std::vector<CollisionObject*> get_nearby_objects(const Vector& center, float max_distance) const;
+  /** Calls visitor(CollisionObject&) for every object, whose bounding box
+      center is within max_distance of the given point. Only objects in one
+      of the groups in group_mask (see colgroup_mask()) are visited.
+      Does not allocate, apart from occasionally rebuilding the spatial index. */
+  template<typename F>
+  void for_each_nearby_object(const Vector& center, float max_distance, F&& visitor,
+                              uint32_t group_mask = COLGROUP_MASK_ALL) const
+  {
+    const Rectf area(center.x - max_distance, center.y - max_distance,
+                     center.x + max_distance, center.y + max_distance);
+    for_each_candidate(area, group_mask,
+      [&center, max_distance, &visitor](CollisionObject& object) {
+        if (object.get_bbox().distance(center) <= max_distance)
+          visitor(object);
+      });
+  }
+
+  /** Calls visitor(CollisionObject&) for every object in one of the groups
+      in group_mask, whose bounding box overlaps the given rectangle. */
+  template<typename F>
+  void for_each_overlapping_object(const Rectf& rect, F&& visitor,
+                                   uint32_t group_mask = COLGROUP_MASK_ALL) const
+  {
+    for_each_candidate(rect, group_mask,
+      [&rect, &visitor](CollisionObject& object) {
+        if (rect.overlaps(object.get_bbox()))
+          visitor(object);
+      });
+  }
 
 private:
+  /** Calls func(CollisionObject&) for every object in one of the groups in
+      group_mask, which might overlap the given rectangle. */
+  template<typename F>
+  void for_each_candidate(const Rectf& rect, uint32_t group_mask, F&& func) const
+  {
+    // The index is invalidated by adding, removing and moving objects.
+    if (!m_spatial_index.is_valid())
+      m_spatial_index.rebuild(m_objects);
+
+    m_spatial_index.for_each_candidate(rect,
+      [group_mask, &func](CollisionObject& object) {
+        if (group_mask & colgroup_mask(object.get_group()))
+          func(object);
+      });
+  }
+
   /** Does collision detection of an object against all other static
       objects (and the tilemap) in the level. Collision response is
       done for the first hit in time. (other hits get ignored, the
@@ -107,6 +152,10 @@ private:
 
   std::vector<CollisionObject*>  m_objects;
 
+  /** Spatial index over m_objects, rebuilt lazily after objects were
+      added, removed or moved by the collision detection. */
+  mutable CollisionSpatialIndex m_spatial_index;
+
   std::shared_ptr<CollisionGroundMovementManager> m_ground_movement_manager;
 
 private:
@@ -0,0 +1,100 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "editor/autosave_writer.hpp"
+
+#include <physfs.h>
+#include <sstream>
+
+#include "physfs/util.hpp"
+#include "supertux/level.hpp"
+#include "util/file_system.hpp"
+#include "util/log.hpp"
+
+AutosaveWriter::AutosaveWriter() :
+  m_thread(),
+  m_saving(false)
+{
+}
+
+AutosaveWriter::~AutosaveWriter()
+{
+  wait();
+}
+
+bool
+AutosaveWriter::save(Level& level, const std::string& filename)
+{
+  if (m_saving)
+    return false;
+
+  wait();
+
+  const std::string dirname = FileSystem::dirname(filename);
+  if (!PHYSFS_exists(dirname.c_str()) && !PHYSFS_mkdir(dirname.c_str()))
+  {
+    std::ostringstream msg;
+    msg << "Couldn't create directory for level '"
+        << dirname << "': " << physfsutil::get_last_error();
+    throw std::runtime_error(msg.str());
+  }
+
+  std::string data;
+  std::vector<Writer::DeferredTiles> deferred_tiles;
+  level.save(data, deferred_tiles);
+
+#ifdef __EMSCRIPTEN__
+  // Threads are not available in the browser build.
+  write(filename, data, deferred_tiles);
+#else
+  m_saving = true;
+  m_thread = std::thread([this, filename, data = std::move(data),
+                          deferred_tiles = std::move(deferred_tiles)] {
+      write(filename, data, deferred_tiles);
+      m_saving = false;
+    });
+#endif
+  return true;
+}
+
+void
+AutosaveWriter::wait()
+{
+  if (m_thread.joinable())
+    m_thread.join();
+}
+
+void
+AutosaveWriter::write(const std::string& filename, const std::string& data,
+                      const std::vector<Writer::DeferredTiles>& deferred_tiles)
+{
+  // The autosave only replaces the previous one, once it has been
+  // written completely.
+  if (physfsutil::write_file_replacing(filename, filename + ".part",
+        [&data, &deferred_tiles](std::ostream& out) {
+          Writer::write_deferred(out, data, deferred_tiles);
+        }))
+  {
+    log_info << "Level saved as " << filename << ". [Autosave]" << std::endl;
+  }
+  else
+  {
+    log_warning << "Couldn't autosave " << filename << ", keeping the previous one" << std::endl;
+  }
+}
+
+/* EOF */
@@ -0,0 +1,69 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_EDITOR_AUTOSAVE_WRITER_HPP
+#define HEADER_SUPERTUX_EDITOR_AUTOSAVE_WRITER_HPP
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "util/writer.hpp"
+
+class Level;
+
+/**
+ * Writes editor autosaves on a separate thread.
+
+   The level is saved into memory on the main thread, with the tile
+   arrays of its tilemaps only copied. Formatting the tiles, which is
+   most of the work, and writing the file are done on the thread, so
+   editing can go on in the meantime. The autosave is written next to
+   its file and then renamed over it, so it is never left incomplete.
+ */
+class AutosaveWriter final
+{
+public:
+  AutosaveWriter();
+  ~AutosaveWriter();
+
+  /** Starts writing an autosave of the level into the given file.
+      Returns false, if the previous autosave is still being written. */
+  bool save(Level& level, const std::string& filename);
+
+  bool is_saving() const { return m_saving; }
+
+  /** Waits until the current autosave has been written. */
+  void wait();
+
+private:
+  static void write(const std::string& filename, const std::string& data,
+                    const std::vector<Writer::DeferredTiles>& deferred_tiles);
+
+private:
+  std::thread m_thread;
+  std::atomic<bool> m_saving;
+
+private:
+  AutosaveWriter(const AutosaveWriter&) = delete;
+  AutosaveWriter& operator=(const AutosaveWriter&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -32,9 +32,14 @@
 
 #include "audio/sound_manager.hpp"
 #include "control/input_manager.hpp"
+#include "editor/autosave_writer.hpp"
 #include "editor/button_widget.hpp"
 #include "editor/layer_icon.hpp"
+#include "editor/level_loader.hpp"
+#include "editor/minimap_widget.hpp"
+#include "editor/object_index.hpp"
 #include "editor/object_info.hpp"
+#include "editor/object_search_menu.hpp"
 #include "editor/particle_editor.hpp"
 #include "editor/resize_marker.hpp"
 #include "editor/tile_selection.hpp"
@@ -59,6 +64,7 @@
 #include "supertux/level.hpp"
 #include "supertux/level_parser.hpp"
 #include "supertux/menu/menu_storage.hpp"
+#include "supertux/resources.hpp"
 #include "supertux/savegame.hpp"
 #include "supertux/screen_fade.hpp"
 #include "supertux/screen_manager.hpp"
@@ -79,6 +85,7 @@ static const float CAMERA_MIN_ZOOM = 0.5f;
 static const float CAMERA_MAX_ZOOM = 3.0f;
 static const float CAMERA_ZOOM_SENSITIVITY = 0.05f;
 static const float CAMERA_ZOOM_FOCUS_PROGRESSION = 8.f;
+static const float LEVEL_LOADING_TIME_PER_FRAME = 0.008f;
 
 bool Editor::s_resaving_in_progress = false;
 
@@ -122,9 +129,15 @@ Editor::Editor() :
   m_overlay_widget(),
   m_toolbox_widget(),
   m_layers_widget(),
+  m_minimap_widget(),
+  m_object_index(std::make_unique<EditorObjectIndex>()),
+  m_search_results(),
+  m_search_result(),
   m_enabled(false),
   m_bgr_surface(Surface::from_file("images/engine/menu/bg_editor.png")),
   m_time_since_last_save(0.f),
+  m_autosave_writer(std::make_unique<AutosaveWriter>()),
+  m_level_loader(),
   m_scroll_speed(32.0f),
   m_new_scale(0.f),
   m_ctrl_pressed(false),
@@ -132,14 +145,17 @@ Editor::Editor() :
 {
   auto toolbox_widget = std::make_unique<EditorToolboxWidget>(*this);
   auto layers_widget = std::make_unique<EditorLayersWidget>(*this);
+  auto minimap_widget = std::make_unique<EditorMinimapWidget>(*this);
   auto overlay_widget = std::make_unique<EditorOverlayWidget>(*this);
 
   m_toolbox_widget = toolbox_widget.get();
   m_layers_widget = layers_widget.get();
+  m_minimap_widget = minimap_widget.get();
   m_overlay_widget = overlay_widget.get();
 
   m_widgets.push_back(std::move(toolbox_widget));
   m_widgets.push_back(std::move(layers_widget));
+  m_widgets.push_back(std::move(minimap_widget));
   m_widgets.push_back(std::move(overlay_widget));
 }
 
@@ -190,20 +206,43 @@ Editor::draw(Compositor& compositor)
     context.color().draw_filled_rect(context.get_rect(),
                                      Color(0.0f, 0.0f, 0.0f),
                                      0.0f, std::numeric_limits<int>::min());
+
+    if (m_autosave_writer->is_saving())
+    {
+      context.color().draw_text(Resources::normal_font, _("Autosaving..."),
+                                Vector(context.get_width() - 144.f, 16.f),
+                                ALIGN_RIGHT, LAYER_GUI, Color::WHITE);
+    }
   } else {
     context.color().draw_surface_scaled(m_bgr_surface,
                                         context.get_rect(),
                                         -100);
   }
 
+  if (m_level_loader)
+  {
+    const float progress = m_level_loader->get_progress();
+    const std::string text = m_level_loader->is_level_created() ?
+      fmt::format(fmt::runtime(_("Loading objects... {}%")), static_cast<int>(progress * 100.f)) :
+      _("Loading level...");
+    context.color().draw_text(Resources::normal_font, text,
+                              Vector(context.get_width() / 2.f, 16.f),
+                              ALIGN_CENTER, LAYER_GUI, Color::WHITE);
+
+    const Rectf bar(Vector(context.get_width() / 2.f - 100.f, 44.f), Sizef(200.f, 6.f));
+    context.color().draw_filled_rect(bar, Color(0.0f, 0.0f, 0.0f, 0.6f), 3.0f, LAYER_GUI);
+    context.color().draw_filled_rect(Rectf(bar.p1(), Sizef(bar.get_width() * progress, bar.get_height())),
+                                     Color::WHITE, 3.0f, LAYER_GUI);
+  }
+
   MouseCursor::current()->draw(context);
 }
 
 void
 Editor::update(float dt_sec, const Controller& controller)
 {
-  // Auto-save (interval).
-  if (m_level) {
+  // Auto-save (interval), once the level has been fully loaded.
+  if (m_level && !m_level_loader) {
     m_time_since_last_save += dt_sec;
     if (m_time_since_last_save >= static_cast<float>(std::max(
         g_config->editor_autosave_frequency, 1)) * 60.f) {
@@ -217,7 +256,10 @@ Editor::update(float dt_sec, const Controller& controller)
       m_autosave_levelfile = FileSystem::join(directory, backup_filename);
       try
       {
-        m_level->save(m_autosave_levelfile);
+        // The level is serialized and written in the background. If the
+        // previous autosave is still being written, skip this one.
+        if (!m_autosave_writer->save(*m_level, m_autosave_levelfile))
+          log_info << "Previous autosave still in progress, skipping." << std::endl;
       }
       catch(const std::exception& e)
       {
@@ -246,7 +288,8 @@ Editor::update(float dt_sec, const Controller& controller)
     m_reactivate_request = false;
   }
 
-  if (m_save_request) {
+  // Saving and testing wait until the level has been fully loaded.
+  if (m_save_request && !m_level_loader) {
     save_level(m_save_request_filename, m_save_request_switch);
     m_enabled = true;
     m_save_request = false;
@@ -254,7 +297,7 @@ Editor::update(float dt_sec, const Controller& controller)
     m_save_request_switch = false;
   }
 
-  if (m_test_request) {
+  if (m_test_request && !m_level_loader) {
     m_test_request = false;
     MouseCursor::current()->set_icon(nullptr);
     test_level(m_test_pos);
@@ -276,6 +319,10 @@ Editor::update(float dt_sec, const Controller& controller)
     return;
   }
 
+  if (m_level_loader) {
+    update_level_loader();
+  }
+
   // Update other components.
   if (m_levelloaded && !m_leveltested) {
     BIND_SECTOR(*m_sector);
@@ -300,6 +347,8 @@ Editor::update(float dt_sec, const Controller& controller)
 void
 Editor::remove_autosave_file()
 {
+  m_autosave_writer->wait();
+
   // Clear the auto-save file.
   if (!m_autosave_levelfile.empty())
   {
@@ -370,6 +419,7 @@ Editor::test_level(const std::optional<std::pair<std::string, Vector>>& test_pos
   }
 
   m_autosave_levelfile = FileSystem::join(directory, backup_filename);
+  m_autosave_writer->wait();
   m_level->save(m_autosave_levelfile);
   m_time_since_last_save = 0.f;
   m_leveltested = true;
@@ -419,6 +469,79 @@ Editor::scroll(const Vector& velocity)
   keep_camera_in_bounds();
 }
 
+void
+Editor::center_camera(const Vector& position)
+{
+  if (!m_levelloaded) return;
+
+  Camera& camera = m_sector->get_camera();
+  const Vector view_size(static_cast<float>(SCREEN_WIDTH - 128), static_cast<float>(SCREEN_HEIGHT - 32));
+  camera.set_translation(position - view_size / camera.get_current_scale() / 2.f);
+  keep_camera_in_bounds();
+}
+
+Rectf
+Editor::get_visible_area() const
+{
+  const Camera& camera = m_sector->get_camera();
+  const Sizef view_size(static_cast<float>(SCREEN_WIDTH - 128), static_cast<float>(SCREEN_HEIGHT - 32));
+  return Rectf(camera.get_translation(), view_size / camera.get_current_scale());
+}
+
+void
+Editor::open_object_search()
+{
+  m_ctrl_pressed = false;
+  m_overlay_widget->delete_markers();
+  m_deactivate_request = true;
+  MenuManager::instance().push_menu(std::make_unique<ObjectSearchMenu>());
+}
+
+void
+Editor::set_search_results(const std::vector<UID>& results, std::optional<size_t> current)
+{
+  m_search_results = results;
+  m_search_result = current;
+
+  if (m_search_result)
+    if (auto* object = m_sector->get_object_by_uid<GameObject>(m_search_results[*m_search_result]))
+      focus_object(*object);
+}
+
+void
+Editor::jump_to_search_result(int direction)
+{
+  // Skip results, which have been removed since.
+  for (size_t i = 0; i < m_search_results.size(); ++i)
+  {
+    const size_t count = m_search_results.size();
+    if (!m_search_result)
+      m_search_result = direction > 0 ? 0 : count - 1;
+    else
+      m_search_result = (*m_search_result + count + direction) % count;
+
+    if (auto* object = m_sector->get_object_by_uid<GameObject>(m_search_results[*m_search_result]))
+    {
+      focus_object(*object);
+      return;
+    }
+  }
+}
+
+void
+Editor::focus_object(GameObject& object)
+{
+  if (auto* moving_object = dynamic_cast<MovingObject*>(&object))
+  {
+    center_camera(moving_object->get_bbox().get_middle());
+    m_overlay_widget->highlight_object(*moving_object);
+  }
+  else if (auto* tilemap = dynamic_cast<TileMap*>(&object))
+  {
+    m_layers_widget->set_selected_tilemap(tilemap);
+  }
+}
+
 void
 Editor::keep_camera_in_bounds()
 {
@@ -485,7 +608,8 @@ Editor::load_sector(const std::string& name)
   }
 
   sector->set_undo_stack_size(g_config->editor_undo_stack_size);
-  sector->toggle_undo_tracking(g_config->editor_undo_tracking);
+  // Undo tracking is enabled, once the level has been fully loaded.
+  sector->toggle_undo_tracking(g_config->editor_undo_tracking && !m_level_loader);
 
   set_sector(sector);
 }
@@ -506,6 +630,10 @@ Editor::set_sector(Sector* sector)
   }
 
   m_layers_widget->refresh();
+  m_minimap_widget->set_sector(m_sector);
+  m_object_index->set_sector(m_sector);
+  m_search_results.clear();
+  m_search_result = std::nullopt;
 }
 
 void
@@ -515,6 +643,10 @@ Editor::delete_current_sector()
     log_fatal << "Deleting the last sector is not allowed." << std::endl;
   }
 
+  // The minimap and object index have to stop listening to the sector before it's destroyed.
+  m_minimap_widget->set_sector(nullptr);
+  m_object_index->set_sector(nullptr);
+
   for (auto i = m_level->m_sectors.begin(); i != m_level->m_sectors.end(); ++i) {
     if ( i->get() == get_sector() ) {
       m_level->m_sectors.erase(i);
@@ -545,6 +677,8 @@ Editor::set_level(std::unique_ptr<Level> level, bool reset)
   }
 
   // Reload level.
+  m_minimap_widget->set_sector(nullptr);
+  m_object_index->set_sector(nullptr);
   m_level = nullptr;
   m_levelloaded = true;
 
@@ -587,15 +721,28 @@ Editor::set_level(std::unique_ptr<Level> level, bool reset)
 void
 Editor::reload_level()
 {
-  ReaderMapping::s_translations_enabled = false;
-  set_level(LevelParser::from_file(m_world ?
-                                   FileSystem::join(m_world->get_basedir(), m_levelfile) : m_levelfile,
-                                   StringUtil::has_suffix(m_levelfile, ".stwm"),
-                                   true));
-  ReaderMapping::s_translations_enabled = true;
+  const std::string filename = m_world ?
+    FileSystem::join(m_world->get_basedir(), m_levelfile) : m_levelfile;
+  const bool worldmap = StringUtil::has_suffix(m_levelfile, ".stwm");
 
-  retoggle_undo_tracking();
-  undo_stack_cleanup();
+  // Drop a level, which is still being loaded.
+  m_level_loader.reset();
+
+  if (g_config->editor_progressive_loading)
+  {
+    // The level is set in update_level_loader(), once its file has been parsed.
+    m_reload_request = false;
+    m_level_loader = std::make_unique<EditorLevelLoader>(filename, worldmap);
+  }
+  else
+  {
+    ReaderMapping::s_translations_enabled = false;
+    set_level(LevelParser::from_file(filename, worldmap, true));
+    ReaderMapping::s_translations_enabled = true;
+
+    retoggle_undo_tracking();
+    undo_stack_cleanup();
+  }
 
   // Autosave files : Once the level is loaded, make sure
   // to use the regular file.
@@ -604,6 +751,49 @@ Editor::reload_level()
                                           get_autosave_from_levelname(m_levelfile));
 }
 
+void
+Editor::update_level_loader()
+{
+  if (!m_level_loader->is_level_created())
+  {
+    if (!m_level_loader->is_parsed())
+      return;
+
+    std::unique_ptr<Level> level;
+    try
+    {
+      level = m_level_loader->create_level();
+    }
+    catch (...)
+    {
+      m_level_loader.reset();
+      throw;
+    }
+
+    // Show the sectors right away, the remaining objects are loaded on the next frames.
+    set_level(std::move(level));
+    return;
+  }
+
+  const bool finished = m_level_loader->load_objects(LEVEL_LOADING_TIME_PER_FRAME,
+    [this](Sector& sector, GameObject& object) {
+      if (&sector != m_sector)
+        return;
+
+      // Objects of other sectors are set up once their sector is set.
+      BIND_SECTOR(sector);
+      object.after_editor_set();
+      m_layers_widget->add_layer(&object);
+    });
+  if (!finished)
+    return;
+
+  m_level_loader.reset();
+
+  retoggle_undo_tracking();
+  undo_stack_cleanup();
+}
+
 void
 Editor::quit_editor()
 {
@@ -614,6 +804,7 @@ Editor::quit_editor()
     remove_autosave_file();
 
     // Quit level editor.
+    m_level_loader.reset();
     m_world = nullptr;
     m_levelfile = "";
     m_levelloaded = false;
@@ -871,15 +1062,22 @@ Editor::event(const SDL_Event& ev)
         Compositor::s_render_lighting = !Compositor::s_render_lighting;
         return;
       }
+      else if (ev.key.keysym.sym == SDLK_F3)
+      {
+        jump_to_search_result((ev.key.keysym.mod & KMOD_SHIFT) ? -1 : 1);
+        return;
+      }
       else if (m_ctrl_pressed)
       {
         switch (ev.key.keysym.sym)
         {
           case SDLK_t:
-            test_level(std::nullopt);
+            if (!m_level_loader)
+              test_level(std::nullopt);
             break;
           case SDLK_s:
-            save_level();
+            if (!m_level_loader)
+              save_level();
             break;
           case SDLK_z:
             undo();
@@ -887,6 +1085,9 @@ Editor::event(const SDL_Event& ev)
           case SDLK_y:
             redo();
             break;
+          case SDLK_f:
+            open_object_search();
+            return;
           case SDLK_PLUS: // Zoom in
           case SDLK_KP_PLUS:
             m_new_scale = m_sector->get_camera().get_current_scale() + CAMERA_ZOOM_SENSITIVITY;
@@ -923,6 +1124,10 @@ Editor::event(const SDL_Event& ev)
         scroll({ static_cast<float>(ev.wheel.x * -32), static_cast<float>(ev.wheel.y * -32) });
     }
 
+    // Objects can't be edited until the level has been fully loaded.
+    if (m_level_loader)
+      return;
+
     BIND_SECTOR(*m_sector);
     for (const auto& widget : m_widgets)
       if (widget->event(ev))
@@ -1062,9 +1267,9 @@ Editor::retoggle_undo_tracking()
     m_redo_widget = nullptr;
   }
 
-  // Toggle undo tracking for all sectors.
+  // Toggle undo tracking for all sectors, once the level has been fully loaded.
   for (const auto& sector : m_level->m_sectors)
-    sector->toggle_undo_tracking(g_config->editor_undo_tracking);
+    sector->toggle_undo_tracking(g_config->editor_undo_tracking && !m_level_loader);
 }
 
 void
@@ -1094,6 +1299,18 @@ Editor::redo()
   post_undo_redo_actions();
 }
 
+size_t
+Editor::get_undo_stack_memory() const
+{
+  size_t memory = 0;
+  if (m_level)
+  {
+    for (const auto& sector : m_level->m_sectors)
+      memory += sector->get_undo_stack_memory();
+  }
+  return memory;
+}
+
 void
 Editor::post_undo_redo_actions()
 {
@@ -1169,26 +1386,28 @@ Editor::pack_addon()
   Partio::ZipFileWriter zip(output_file_path);
   PHYSFS_enumerate(get_world()->get_basedir().c_str(), foreach_recurse, &zip);
 
-  std::stringstream ss;
-  Writer info(ss);
-
-  info.start_list("supertux-addoninfo");
+  std::string info_data;
   {
-    info.write("id", id);
-    info.write("version", version);
+    Writer info(info_data);
 
-    if (get_world()->is_levelset())
-      info.write("type", "levelset");
-    else if (get_world()->is_worldmap())
-      info.write("type", "worldmap");
+    info.start_list("supertux-addoninfo");
+    {
+      info.write("id", id);
+      info.write("version", version);
+
+      if (get_world()->is_levelset())
+        info.write("type", "levelset");
+      else if (get_world()->is_worldmap())
+        info.write("type", "worldmap");
 
-    info.write("title", get_world()->get_title());
-    info.write("author", get_level()->get_author());
-    info.write("license", get_level()->get_license());
+      info.write("title", get_world()->get_title());
+      info.write("author", get_level()->get_author());
+      info.write("license", get_level()->get_license());
+    }
+    info.end_list("supertux-addoninfo");
   }
-  info.end_list("supertux-addoninfo");
 
-  *zip.Add_File(id + ".nfo") << ss.rdbuf();
+  *zip.Add_File(id + ".nfo") << info_data;
 }
 
 /* EOF */
@@ -36,7 +36,11 @@
 #include "util/string_util.hpp"
 #include "video/surface_ptr.hpp"
 
+class AutosaveWriter;
 class ButtonWidget;
+class EditorLevelLoader;
+class EditorMinimapWidget;
+class EditorObjectIndex;
 class GameObject;
 class Level;
 class ObjectGroup;
@@ -147,8 +151,26 @@ public:
 
   void scroll(const Vector& velocity);
 
+  /** Moves the camera, so the given position in the sector is
+      in the center of the editing area. */
+  void center_camera(const Vector& position);
+
+  /** Returns the area of the sector, which is currently visible. */
+  Rectf get_visible_area() const;
+
+  EditorObjectIndex& get_object_index() const { return *m_object_index; }
+  void open_object_search();
+
+  /** Sets the objects to go through with F3 and Shift+F3,
+      and jumps to the given one, if any. */
+  void set_search_results(const std::vector<UID>& results, std::optional<size_t> current);
+  void jump_to_search_result(int direction);
+
   bool is_level_loaded() const { return m_levelloaded; }
 
+  /** Returns true, while a level is being loaded progressively. */
+  bool is_loading_level() const { return m_level_loader != nullptr; }
+
   void edit_path(PathGameObject* path, GameObject* new_marked_object) {
     m_overlay_widget->edit_path(path, new_marked_object);
   }
@@ -165,12 +187,16 @@ public:
   void undo();
   void redo();
 
+  /** Returns the memory used by the undo stacks of all sectors, in bytes. */
+  size_t get_undo_stack_memory() const;
+
   void pack_addon();
 
 private:
   void set_sector(Sector* sector);
   void set_level(std::unique_ptr<Level> level, bool reset = true);
   void reload_level();
+  void update_level_loader();
   void quit_editor();
   /**
    * @param filename    If non-empty, save to this file instead.
@@ -186,6 +212,9 @@ private:
 
   void post_undo_redo_actions();
 
+  /** Moves the camera to the object and selects it. */
+  void focus_object(GameObject& object);
+
 protected:
   std::unique_ptr<Level> m_level;
   std::unique_ptr<World> m_world;
@@ -224,11 +253,19 @@ private:
   EditorOverlayWidget* m_overlay_widget;
   EditorToolboxWidget* m_toolbox_widget;
   EditorLayersWidget* m_layers_widget;
+  EditorMinimapWidget* m_minimap_widget;
+
+  std::unique_ptr<EditorObjectIndex> m_object_index;
+  std::vector<UID> m_search_results;
+  std::optional<size_t> m_search_result;
 
   bool m_enabled;
   SurfacePtr m_bgr_surface;
 
   float m_time_since_last_save;
+  std::unique_ptr<AutosaveWriter> m_autosave_writer;
+
+  std::unique_ptr<EditorLevelLoader> m_level_loader;
 
   float m_scroll_speed;
   float m_new_scale;
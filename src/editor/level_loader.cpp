@@ -0,0 +1,158 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "editor/level_loader.hpp"
+
+#include <assert.h>
+#include <chrono>
+#include <sstream>
+
+#include "supertux/game_object.hpp"
+#include "supertux/level.hpp"
+#include "supertux/sector.hpp"
+#include "supertux/sector_parser.hpp"
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
+
+EditorLevelLoader::EditorLevelLoader(const std::string& filename, bool worldmap) :
+  m_filename(filename),
+  m_worldmap(worldmap),
+  m_thread(),
+  m_parsed(false),
+  m_document(),
+  m_error(),
+  m_level_created(false),
+  m_objects(),
+  m_sector_idx(0),
+  m_object_idx(0),
+  m_object_count(0),
+  m_loaded_count(0)
+{
+#ifdef __EMSCRIPTEN__
+  // Threads are not available in the browser build.
+  parse();
+#else
+  m_thread = std::thread(&EditorLevelLoader::parse, this);
+#endif
+}
+
+EditorLevelLoader::~EditorLevelLoader()
+{
+  if (m_thread.joinable())
+    m_thread.join();
+}
+
+void
+EditorLevelLoader::parse()
+{
+  // Only the document is parsed here. Constructing objects has to happen
+  // on the main thread, as it uses managers that aren't thread-safe.
+  try
+  {
+    m_document = std::make_unique<ReaderDocument>(ReaderDocument::from_file(m_filename));
+  }
+  catch (...)
+  {
+    m_error = std::current_exception();
+  }
+  m_parsed = true;
+}
+
+std::unique_ptr<Level>
+EditorLevelLoader::create_level()
+{
+  assert(m_parsed && !m_level_created);
+
+  if (m_thread.joinable())
+    m_thread.join();
+
+  std::unique_ptr<Level> level;
+  try
+  {
+    if (m_error)
+      std::rethrow_exception(m_error);
+
+    level = LevelParser::from_document_deferred(*m_document, m_worldmap, true, m_objects);
+  }
+  catch (const std::exception& err)
+  {
+    std::stringstream msg;
+    msg << "Problem when reading level '" << m_filename << "': " << err.what();
+    throw std::runtime_error(msg.str());
+  }
+
+  for (const auto& sector : m_objects)
+    m_object_count += sector.objects.size();
+
+  m_level_created = true;
+  return level;
+}
+
+bool
+EditorLevelLoader::load_objects(float time, const std::function<void (Sector&, GameObject&)>& on_object_added)
+{
+  assert(m_level_created);
+
+  const auto end = std::chrono::steady_clock::now() +
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(time));
+
+  ReaderMapping::s_translations_enabled = false;
+  while (m_sector_idx < m_objects.size())
+  {
+    auto& deferred = m_objects[m_sector_idx];
+
+    // At least one object is constructed on every call, so loading always progresses.
+    std::vector<std::unique_ptr<GameObject>> objects;
+    while (m_object_idx < deferred.objects.size())
+    {
+      auto object = SectorParser::parse_deferred_object(*deferred.sector, deferred.objects[m_object_idx], true);
+      if (object)
+        objects.push_back(std::move(object));
+
+      m_object_idx++;
+      m_loaded_count++;
+      if (std::chrono::steady_clock::now() >= end)
+        break;
+    }
+
+    const bool finished = m_object_idx >= deferred.objects.size();
+    for (auto* object : deferred.sector->add_loaded_objects(std::move(objects), finished))
+      on_object_added(*deferred.sector, *object);
+
+    if (!finished)
+      break;
+
+    m_sector_idx++;
+    m_object_idx = 0;
+    if (std::chrono::steady_clock::now() >= end)
+      break;
+  }
+  ReaderMapping::s_translations_enabled = true;
+
+  return m_sector_idx >= m_objects.size();
+}
+
+float
+EditorLevelLoader::get_progress() const
+{
+  if (m_object_count == 0)
+    return m_level_created ? 1.f : 0.f;
+
+  return static_cast<float>(m_loaded_count) / static_cast<float>(m_object_count);
+}
+
+/* EOF */
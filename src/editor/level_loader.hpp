@@ -0,0 +1,92 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_EDITOR_LEVEL_LOADER_HPP
+#define HEADER_SUPERTUX_EDITOR_LEVEL_LOADER_HPP
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "supertux/level_parser.hpp"
+
+class GameObject;
+class Level;
+class ReaderDocument;
+class Sector;
+
+/**
+ * Loads a level into the editor progressively.
+
+   The level file is parsed on a separate thread. Once that's done, the
+   level is created with only the objects needed to display its sectors,
+   like tilemaps and backgrounds. All other objects are constructed on
+   the main thread afterwards, in batches limited by time, so the editor
+   keeps drawing frames while large levels are being loaded.
+ */
+class EditorLevelLoader final
+{
+public:
+  EditorLevelLoader(const std::string& filename, bool worldmap);
+  ~EditorLevelLoader();
+
+  /** Returns true, once the level file has been parsed. */
+  bool is_parsed() const { return m_parsed; }
+  bool is_level_created() const { return m_level_created; }
+
+  /** Creates the level from the parsed file. Throws, if the file couldn't be parsed. */
+  std::unique_ptr<Level> create_level();
+
+  /** Constructs the remaining objects of the level, for about the given time in seconds.
+      The callback is called for every object added to its sector.
+      Returns true, once all objects have been loaded. */
+  bool load_objects(float time, const std::function<void (Sector&, GameObject&)>& on_object_added);
+
+  /** Returns the share of objects, which have been loaded, from 0 to 1. */
+  float get_progress() const;
+
+private:
+  void parse();
+
+private:
+  const std::string m_filename;
+  const bool m_worldmap;
+
+  std::thread m_thread;
+  std::atomic<bool> m_parsed;
+  std::unique_ptr<ReaderDocument> m_document;
+  std::exception_ptr m_error;
+
+  bool m_level_created;
+  std::vector<LevelParser::DeferredObjects> m_objects;
+  size_t m_sector_idx;
+  size_t m_object_idx;
+  size_t m_object_count;
+  size_t m_loaded_count;
+
+private:
+  EditorLevelLoader(const EditorLevelLoader&) = delete;
+  EditorLevelLoader& operator=(const EditorLevelLoader&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -0,0 +1,380 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "editor/minimap_widget.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "editor/editor.hpp"
+#include "object/camera.hpp"
+#include "object/tilemap.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/sector.hpp"
+#include "supertux/tile_set.hpp"
+#include "video/drawing_context.hpp"
+#include "video/sdl_surface.hpp"
+#include "video/surface.hpp"
+#include "video/texture.hpp"
+#include "video/video_system.hpp"
+#include "video/viewport.hpp"
+
+namespace {
+
+/** Opaque dark grey, shown where there are no tiles, in RGBA byte order */
+const uint32_t BACKGROUND_COLOR = 0xff202020;
+
+/** Maximum size of the image. Larger sectors are scaled down,
+    so that a pixel covers multiple tiles. */
+const int MAX_IMAGE_SIZE = 1024;
+
+/** Maximum size of the widget on the screen */
+const float MAX_WIDTH = 256.0f;
+const float MAX_HEIGHT = 96.0f;
+const float MAX_ZOOM = 4.0f;
+const float MARGIN = 8.0f;
+
+int tile_position(float offset)
+{
+  return static_cast<int>(std::floor(offset / 32.0f));
+}
+
+/** Blends the RGBA color over the opaque destination color,
+    with its alpha multiplied by the given alpha (0-255). */
+uint32_t blend(uint32_t dst, uint32_t src, uint32_t alpha)
+{
+  const uint32_t a = ((src >> 24) * alpha + 127) / 255;
+  if (a == 0)
+    return dst;
+
+  uint32_t result = 0xff000000;
+  for (uint32_t shift = 0; shift < 24; shift += 8)
+  {
+    const uint32_t channel = (((src >> shift) & 0xff) * a + ((dst >> shift) & 0xff) * (255 - a) + 127) / 255;
+    result |= channel << shift;
+  }
+  return result;
+}
+
+} // namespace
+
+EditorMinimapWidget::EditorMinimapWidget(Editor& editor) :
+  m_editor(editor),
+  m_sector(nullptr),
+  m_layers(),
+  m_tiles(),
+  m_scale(1),
+  m_width(0),
+  m_height(0),
+  m_pixels(),
+  m_dirty(true),
+  m_dirty_rect(),
+  m_texture(),
+  m_surface(),
+  m_rect(),
+  m_hovered(false),
+  m_dragging(false)
+{
+}
+
+EditorMinimapWidget::~EditorMinimapWidget()
+{
+  set_sector(nullptr);
+}
+
+void
+EditorMinimapWidget::set_sector(Sector* sector)
+{
+  if (sector == m_sector)
+    return;
+
+  if (m_sector)
+    m_sector->remove_tilemap_listener(this);
+
+  m_sector = sector;
+  m_dirty = true;
+  m_dragging = false;
+
+  if (m_sector)
+    m_sector->add_tilemap_listener(this);
+}
+
+void
+EditorMinimapWidget::tilemap_changed(const TileMap& tilemap)
+{
+  m_dirty = true;
+}
+
+void
+EditorMinimapWidget::tilemap_tile_changed(const TileMap& tilemap, int x, int y)
+{
+  if (m_dirty)
+    return;
+
+  auto it = std::find_if(m_layers.begin(), m_layers.end(),
+                         [&tilemap](const Layer& layer) { return layer.tilemap == &tilemap; });
+  if (it == m_layers.end())
+  {
+    m_dirty = true;
+    return;
+  }
+
+  const int tile_x = it->x + x - m_tiles.left;
+  const int tile_y = it->y + y - m_tiles.top;
+
+  // Only the top-left tile covered by a pixel is shown.
+  if (tile_x % m_scale != 0 || tile_y % m_scale != 0)
+    return;
+
+  const int pixel_x = tile_x / m_scale;
+  const int pixel_y = tile_y / m_scale;
+  m_pixels[pixel_y * m_width + pixel_x] = get_pixel_color(pixel_x, pixel_y);
+
+  if (m_dirty_rect.empty())
+  {
+    m_dirty_rect = Rect(pixel_x, pixel_y, pixel_x + 1, pixel_y + 1);
+  }
+  else
+  {
+    m_dirty_rect = Rect(std::min(m_dirty_rect.left, pixel_x), std::min(m_dirty_rect.top, pixel_y),
+                        std::max(m_dirty_rect.right, pixel_x + 1), std::max(m_dirty_rect.bottom, pixel_y + 1));
+  }
+}
+
+void
+EditorMinimapWidget::rebuild()
+{
+  m_dirty = false;
+  m_dirty_rect = Rect();
+  m_layers.clear();
+
+  int left = std::numeric_limits<int>::max();
+  int top = std::numeric_limits<int>::max();
+  int right = std::numeric_limits<int>::min();
+  int bottom = std::numeric_limits<int>::min();
+  if (m_sector)
+  {
+    for (const auto* tilemap : m_sector->get_all_tilemaps())
+    {
+      const Vector offset = tilemap->get_offset();
+      if (!tilemap->get_tileset() || std::abs(offset.x) >= 1e8f || std::abs(offset.y) >= 1e8f)
+        continue;
+
+      const int x = tile_position(offset.x);
+      const int y = tile_position(offset.y);
+      left = std::min(left, x);
+      top = std::min(top, y);
+      right = std::max(right, x + tilemap->get_width());
+      bottom = std::max(bottom, y + tilemap->get_height());
+
+      m_layers.push_back({ tilemap, &tilemap->get_tileset()->get_average_colors(), x, y });
+    }
+  }
+
+  if (m_layers.empty() || left >= right || top >= bottom)
+  {
+    m_layers.clear();
+    m_width = m_height = 0;
+    m_pixels.clear();
+    m_texture.reset();
+    m_surface.reset();
+    return;
+  }
+
+  std::stable_sort(m_layers.begin(), m_layers.end(),
+                   [](const Layer& lhs, const Layer& rhs) {
+                     return lhs.tilemap->get_layer() < rhs.tilemap->get_layer();
+                   });
+
+  m_tiles = Rect(left, top, right, bottom);
+  m_scale = (std::max(m_tiles.get_width(), m_tiles.get_height()) + MAX_IMAGE_SIZE - 1) / MAX_IMAGE_SIZE;
+  m_width = (m_tiles.get_width() + m_scale - 1) / m_scale;
+  m_height = (m_tiles.get_height() + m_scale - 1) / m_scale;
+
+  m_pixels.resize(static_cast<size_t>(m_width) * m_height);
+  for (int y = 0; y < m_height; ++y)
+    for (int x = 0; x < m_width; ++x)
+      m_pixels[y * m_width + x] = get_pixel_color(x, y);
+
+  if (!m_texture || m_texture->get_image_width() != m_width || m_texture->get_image_height() != m_height)
+  {
+    SDLSurfacePtr image = SDLSurface::create_rgba(m_width, m_height);
+    m_texture = VideoSystem::current()->new_texture(*image);
+    m_surface = Surface::from_texture(m_texture);
+  }
+  m_texture->update(Rect(0, 0, m_width, m_height), m_pixels.data());
+}
+
+uint32_t
+EditorMinimapWidget::get_pixel_color(int x, int y) const
+{
+  const int tile_x = m_tiles.left + x * m_scale;
+  const int tile_y = m_tiles.top + y * m_scale;
+
+  uint32_t color = BACKGROUND_COLOR;
+  for (const auto& layer : m_layers)
+  {
+    const TileMap& tilemap = *layer.tilemap;
+    const int layer_x = tile_x - layer.x;
+    const int layer_y = tile_y - layer.y;
+    if (layer_x < 0 || layer_x >= tilemap.get_width() ||
+        layer_y < 0 || layer_y >= tilemap.get_height())
+      continue;
+
+    const uint32_t id = tilemap.get_tiles()[layer_y * tilemap.get_width() + layer_x];
+    if (id == 0 || id >= layer.colors->size())
+      continue;
+
+    const float alpha = std::max(0.0f, std::min(1.0f, tilemap.get_alpha()));
+    color = blend(color, (*layer.colors)[id], static_cast<uint32_t>(alpha * 255.0f));
+  }
+  return color;
+}
+
+void
+EditorMinimapWidget::update_texture()
+{
+  if (m_dirty)
+  {
+    rebuild();
+    return;
+  }
+
+  if (m_dirty_rect.empty())
+    return;
+
+  std::vector<uint32_t> pixels;
+  pixels.reserve(m_dirty_rect.get_area());
+  for (int y = m_dirty_rect.top; y < m_dirty_rect.bottom; ++y)
+  {
+    const auto row = m_pixels.begin() + y * m_width;
+    pixels.insert(pixels.end(), row + m_dirty_rect.left, row + m_dirty_rect.right);
+  }
+
+  m_texture->update(m_dirty_rect, pixels.data());
+  m_dirty_rect = Rect();
+}
+
+void
+EditorMinimapWidget::update_rect()
+{
+  if (m_width == 0 || m_height == 0)
+  {
+    m_rect = Rectf();
+    return;
+  }
+
+  const float zoom = std::min({ MAX_WIDTH / static_cast<float>(m_width),
+                                MAX_HEIGHT / static_cast<float>(m_height),
+                                MAX_ZOOM });
+  const Sizef size(static_cast<float>(m_width) * zoom, static_cast<float>(m_height) * zoom);
+
+  // Above the layers widget, next to the toolbox.
+  m_rect = Rectf(Vector(static_cast<float>(SCREEN_WIDTH - 128) - MARGIN - size.width,
+                        static_cast<float>(SCREEN_HEIGHT - 32) - MARGIN - size.height),
+                 size);
+}
+
+void
+EditorMinimapWidget::draw(DrawingContext& context)
+{
+  if (!g_config->editor_show_minimap || !m_sector)
+    return;
+
+  update_texture();
+  update_rect();
+  if (!m_surface)
+    return;
+
+  context.color().draw_filled_rect(m_rect.grown(2.0f),
+                                   m_hovered ? g_config->editorhovercolor : g_config->editorcolor,
+                                   0.0f, LAYER_GUI - 10);
+  context.color().draw_surface_scaled(m_surface, m_rect, LAYER_GUI - 9);
+
+  // Outline the part of the sector, which is currently visible.
+  const Camera& camera = m_sector->get_camera();
+  const float scale = camera.get_current_scale();
+  const Vector view_size((context.get_width() - 128.0f) / scale, (context.get_height() - 32.0f) / scale);
+
+  const float zoom = m_rect.get_width() / static_cast<float>(m_width);
+  const auto to_minimap = [this, zoom](const Vector& pos) {
+    const Vector tiles = pos / 32.0f - Vector(static_cast<float>(m_tiles.left), static_cast<float>(m_tiles.top));
+    const Vector pixel = m_rect.p1() + tiles / static_cast<float>(m_scale) * zoom;
+    return Vector(std::max(m_rect.get_left(), std::min(m_rect.get_right(), pixel.x)),
+                  std::max(m_rect.get_top(), std::min(m_rect.get_bottom(), pixel.y)));
+  };
+  const Vector p1 = to_minimap(camera.get_translation());
+  const Vector p2 = to_minimap(camera.get_translation() + view_size);
+
+  context.color().draw_lines({ p1, Vector(p2.x, p1.y),
+                               Vector(p2.x, p1.y), p2,
+                               p2, Vector(p1.x, p2.y),
+                               Vector(p1.x, p2.y), p1 },
+                             Color::WHITE, LAYER_GUI - 8);
+}
+
+bool
+EditorMinimapWidget::on_mouse_button_up(const SDL_MouseButtonEvent& button)
+{
+  if (button.button != SDL_BUTTON_LEFT || !m_dragging)
+    return false;
+
+  m_dragging = false;
+  return true;
+}
+
+bool
+EditorMinimapWidget::on_mouse_button_down(const SDL_MouseButtonEvent& button)
+{
+  if (button.button != SDL_BUTTON_LEFT || !m_hovered)
+    return false;
+
+  m_dragging = true;
+  move_camera(VideoSystem::current()->get_viewport().to_logical(button.x, button.y));
+  return true;
+}
+
+bool
+EditorMinimapWidget::on_mouse_motion(const SDL_MouseMotionEvent& motion)
+{
+  const Vector mouse_pos = VideoSystem::current()->get_viewport().to_logical(motion.x, motion.y);
+  m_hovered = g_config->editor_show_minimap && m_surface && m_rect.contains(mouse_pos);
+
+  if (m_dragging)
+  {
+    move_camera(mouse_pos);
+    return true;
+  }
+
+  return m_hovered;
+}
+
+void
+EditorMinimapWidget::move_camera(const Vector& mouse_pos)
+{
+  if (m_width == 0 || m_rect.empty())
+    return;
+
+  const float zoom = m_rect.get_width() / static_cast<float>(m_width);
+  const Vector tiles = (mouse_pos - m_rect.p1()) / zoom * static_cast<float>(m_scale) +
+                       Vector(static_cast<float>(m_tiles.left), static_cast<float>(m_tiles.top));
+  m_editor.center_camera(tiles * 32.0f);
+}
+
+/* EOF */
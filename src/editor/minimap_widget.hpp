@@ -0,0 +1,116 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_EDITOR_MINIMAP_WIDGET_HPP
+#define HEADER_SUPERTUX_EDITOR_MINIMAP_WIDGET_HPP
+
+#include "editor/widget.hpp"
+#include "supertux/tilemap_listener.hpp"
+
+#include <stdint.h>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "math/rectf.hpp"
+#include "video/surface_ptr.hpp"
+#include "video/texture_ptr.hpp"
+
+class DrawingContext;
+class Editor;
+class Sector;
+
+/** A widget above the layers widget, showing an overview of the tilemaps
+    of the current sector at one pixel per tile. Clicking it moves the
+    editor camera to the clicked position. */
+class EditorMinimapWidget final : public Widget,
+                                  public TileMapListener
+{
+public:
+  EditorMinimapWidget(Editor& editor);
+  ~EditorMinimapWidget() override;
+
+  virtual void draw(DrawingContext& context) override;
+
+  virtual bool on_mouse_button_up(const SDL_MouseButtonEvent& button) override;
+  virtual bool on_mouse_button_down(const SDL_MouseButtonEvent& button) override;
+  virtual bool on_mouse_motion(const SDL_MouseMotionEvent& motion) override;
+
+  virtual void tilemap_changed(const TileMap& tilemap) override;
+  virtual void tilemap_tile_changed(const TileMap& tilemap, int x, int y) override;
+
+  /** Starts showing the given sector. Has to be called with nullptr,
+      before the current sector is destroyed. */
+  void set_sector(Sector* sector);
+
+private:
+  struct Layer
+  {
+    const TileMap* tilemap;
+    const std::vector<uint32_t>* colors;
+
+    /** Position of the tilemap, in tiles */
+    int x;
+    int y;
+  };
+
+private:
+  /** Redraws the whole image, after the tilemaps have changed. */
+  void rebuild();
+
+  /** Composes the color of the given pixel from all tilemaps. */
+  uint32_t get_pixel_color(int x, int y) const;
+
+  /** Uploads the pixels, which have changed since the last call. */
+  void update_texture();
+
+  void update_rect();
+  void move_camera(const Vector& mouse_pos);
+
+private:
+  Editor& m_editor;
+  Sector* m_sector;
+
+  std::vector<Layer> m_layers;
+
+  /** Tiles covered by the image. A pixel covers m_scale x m_scale tiles. */
+  Rect m_tiles;
+  int m_scale;
+
+  int m_width;
+  int m_height;
+  std::vector<uint32_t> m_pixels;
+
+  bool m_dirty;
+  Rect m_dirty_rect;
+
+  TexturePtr m_texture;
+  SurfacePtr m_surface;
+
+  /** Position of the image on the screen */
+  Rectf m_rect;
+
+  bool m_hovered;
+  bool m_dragging;
+
+private:
+  EditorMinimapWidget(const EditorMinimapWidget&) = delete;
+  EditorMinimapWidget& operator=(const EditorMinimapWidget&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -0,0 +1,362 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "editor/object_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+#include "supertux/game_object.hpp"
+#include "supertux/game_object_manager.hpp"
+#include "supertux/moving_object.hpp"
+#include "util/string_util.hpp"
+
+namespace {
+
+const float CELL_SIZE = 512.0f;
+
+/** Objects spanning more cells are not put into the grid. */
+const int MAX_OBJECT_CELLS = 64;
+
+uint64_t cell_key(int x, int y)
+{
+  return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+/** Returns the range of cells overlapping the rectangle, or nothing,
+    if it's too far outside of any reasonable sector. */
+std::optional<Rect> get_cells(const Rectf& rect)
+{
+  const float limit = CELL_SIZE * 1e6f;
+  if (!(std::abs(rect.get_left()) < limit && std::abs(rect.get_top()) < limit &&
+        std::abs(rect.get_right()) < limit && std::abs(rect.get_bottom()) < limit))
+    return std::nullopt;
+
+  return Rect(static_cast<int>(std::floor(rect.get_left() / CELL_SIZE)),
+              static_cast<int>(std::floor(rect.get_top() / CELL_SIZE)),
+              static_cast<int>(std::floor(rect.get_right() / CELL_SIZE)) + 1,
+              static_cast<int>(std::floor(rect.get_bottom() / CELL_SIZE)) + 1);
+}
+
+struct Term
+{
+  std::string text;
+  bool match_class;
+  bool match_name;
+};
+
+std::vector<Term> parse_query(const std::string& query)
+{
+  std::vector<Term> terms;
+
+  std::istringstream stream(StringUtil::tolower(query));
+  std::string word;
+  while (stream >> word)
+  {
+    Term term = { word, true, true };
+    if (StringUtil::starts_with(word, "class:"))
+    {
+      term.text = word.substr(6);
+      term.match_name = false;
+    }
+    else if (StringUtil::starts_with(word, "name:"))
+    {
+      term.text = word.substr(5);
+      term.match_class = false;
+    }
+
+    if (!term.text.empty())
+      terms.push_back(std::move(term));
+  }
+  return terms;
+}
+
+} // namespace
+
+EditorObjectIndex::EditorObjectIndex() :
+  m_sector(nullptr),
+  m_entries(),
+  m_objects_by_class(),
+  m_objects_by_name(),
+  m_grid(),
+  m_large_objects()
+{
+}
+
+EditorObjectIndex::~EditorObjectIndex()
+{
+  set_sector(nullptr);
+}
+
+void
+EditorObjectIndex::set_sector(GameObjectManager* sector)
+{
+  if (m_sector)
+    m_sector->remove_object_listener(this);
+
+  m_entries.clear();
+  m_objects_by_class.clear();
+  m_objects_by_name.clear();
+  m_grid.clear();
+  m_large_objects.clear();
+
+  m_sector = sector;
+  if (!m_sector)
+    return;
+
+  m_sector->add_object_listener(this);
+  for (const auto& object : m_sector->get_objects())
+  {
+    if (object->is_valid())
+      add(*object);
+  }
+}
+
+std::vector<GameObject*>
+EditorObjectIndex::find(const std::string& query, const std::optional<Rectf>& area) const
+{
+  const std::vector<Term> terms = parse_query(query);
+  if (terms.empty() && !area)
+    return {};
+
+  // Gather candidates from the buckets matching the first term, or from the area.
+  std::vector<GameObject*> candidates;
+  if (!terms.empty())
+  {
+    const Term& term = terms.front();
+    if (term.match_class)
+    {
+      for (const auto& [class_name, bucket] : m_objects_by_class)
+      {
+        if (class_name.find(term.text) != std::string::npos ||
+            bucket.display_name.find(term.text) != std::string::npos)
+          candidates.insert(candidates.end(), bucket.objects.begin(), bucket.objects.end());
+      }
+    }
+    if (term.match_name)
+    {
+      for (const auto& [name, objects] : m_objects_by_name)
+      {
+        if (name.find(term.text) != std::string::npos)
+          candidates.insert(candidates.end(), objects.begin(), objects.end());
+      }
+    }
+  }
+  else
+  {
+    collect_in_area(*area, candidates);
+  }
+
+  // An object can be found both by its class and its name, or in multiple cells.
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  const auto matches = [this](const Entry& entry, const Term& term) {
+    if (term.match_class)
+    {
+      if (entry.class_name.find(term.text) != std::string::npos ||
+          m_objects_by_class.at(entry.class_name).display_name.find(term.text) != std::string::npos)
+        return true;
+    }
+    return term.match_name && entry.name.find(term.text) != std::string::npos;
+  };
+
+  struct Result
+  {
+    GameObject* object;
+    std::optional<Vector> pos;
+  };
+  std::vector<Result> results;
+  for (GameObject* object : candidates)
+  {
+    const Entry& entry = m_entries.at(object);
+    if (!std::all_of(terms.begin(), terms.end(), [&](const Term& term) { return matches(entry, term); }))
+      continue;
+
+    const auto* moving_object = dynamic_cast<const MovingObject*>(object);
+    if (area && (!moving_object || !area->overlaps(moving_object->get_bbox())))
+      continue;
+
+    results.push_back({ object, moving_object ? std::optional<Vector>(moving_object->get_pos()) : std::nullopt });
+  }
+
+  std::sort(results.begin(), results.end(),
+            [](const Result& lhs, const Result& rhs) {
+              if (!lhs.pos || !rhs.pos)
+                return !lhs.pos && rhs.pos;
+              if (lhs.pos->x != rhs.pos->x)
+                return lhs.pos->x < rhs.pos->x;
+              return lhs.pos->y < rhs.pos->y;
+            });
+
+  std::vector<GameObject*> objects;
+  objects.reserve(results.size());
+  for (const auto& result : results)
+    objects.push_back(result.object);
+  return objects;
+}
+
+void
+EditorObjectIndex::object_added(GameObject& object)
+{
+  add(object);
+}
+
+void
+EditorObjectIndex::object_removed(GameObject& object)
+{
+  remove(object);
+}
+
+void
+EditorObjectIndex::object_changed(GameObject& object)
+{
+  // The name or position might have changed, so the object is indexed anew.
+  if (m_entries.find(&object) == m_entries.end())
+    return;
+
+  remove(object);
+  add(object);
+}
+
+void
+EditorObjectIndex::add(GameObject& object)
+{
+  // Editor markers and other helper objects are not of interest.
+  if (!object.is_saveable() || m_entries.find(&object) != m_entries.end())
+    return;
+
+  Entry& entry = m_entries[&object];
+  entry.class_name = StringUtil::tolower(object.get_class_name());
+  entry.name = StringUtil::tolower(object.get_name());
+
+  auto class_it = m_objects_by_class.find(entry.class_name);
+  if (class_it == m_objects_by_class.end())
+  {
+    class_it = m_objects_by_class.emplace(entry.class_name, ClassBucket()).first;
+    class_it->second.display_name = StringUtil::tolower(object.get_display_name());
+  }
+  class_it->second.objects.insert(&object);
+
+  if (!entry.name.empty())
+    m_objects_by_name[entry.name].insert(&object);
+
+  const auto* moving_object = dynamic_cast<const MovingObject*>(&object);
+  if (!moving_object)
+    return;
+
+  entry.cells = get_cells(moving_object->get_bbox());
+  if (!entry.cells ||
+      static_cast<long long>(entry.cells->get_width()) * entry.cells->get_height() > MAX_OBJECT_CELLS)
+  {
+    entry.cells = std::nullopt;
+    m_large_objects.insert(&object);
+    return;
+  }
+
+  for (int y = entry.cells->top; y < entry.cells->bottom; ++y)
+    for (int x = entry.cells->left; x < entry.cells->right; ++x)
+      m_grid[cell_key(x, y)].push_back(&object);
+}
+
+void
+EditorObjectIndex::remove(GameObject& object)
+{
+  auto it = m_entries.find(&object);
+  if (it == m_entries.end())
+    return;
+
+  const Entry& entry = it->second;
+
+  auto class_it = m_objects_by_class.find(entry.class_name);
+  class_it->second.objects.erase(&object);
+  if (class_it->second.objects.empty())
+    m_objects_by_class.erase(class_it);
+
+  if (!entry.name.empty())
+  {
+    auto name_it = m_objects_by_name.find(entry.name);
+    name_it->second.erase(&object);
+    if (name_it->second.empty())
+      m_objects_by_name.erase(name_it);
+  }
+
+  if (entry.cells)
+  {
+    for (int y = entry.cells->top; y < entry.cells->bottom; ++y)
+    {
+      for (int x = entry.cells->left; x < entry.cells->right; ++x)
+      {
+        auto cell_it = m_grid.find(cell_key(x, y));
+        auto& cell = cell_it->second;
+        auto object_it = std::find(cell.begin(), cell.end(), &object);
+        *object_it = cell.back();
+        cell.pop_back();
+        if (cell.empty())
+          m_grid.erase(cell_it);
+      }
+    }
+  }
+  else
+  {
+    m_large_objects.erase(&object);
+  }
+
+  m_entries.erase(it);
+}
+
+void
+EditorObjectIndex::collect_in_area(const Rectf& area, std::vector<GameObject*>& objects) const
+{
+  objects.insert(objects.end(), m_large_objects.begin(), m_large_objects.end());
+
+  const std::optional<Rect> cells = get_cells(area);
+  if (!cells)
+  {
+    // Scanning that many cells would be slower than checking every object.
+    for (const auto& [object, entry] : m_entries)
+      if (entry.cells)
+        objects.push_back(object);
+    return;
+  }
+
+  if (static_cast<long long>(cells->get_width()) * cells->get_height() > static_cast<long long>(m_grid.size()))
+  {
+    // Only a few cells are occupied, compared to the size of the area.
+    for (const auto& [key, cell] : m_grid)
+    {
+      const int x = static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+      const int y = static_cast<int32_t>(static_cast<uint32_t>(key));
+      if (x >= cells->left && x < cells->right && y >= cells->top && y < cells->bottom)
+        objects.insert(objects.end(), cell.begin(), cell.end());
+    }
+    return;
+  }
+
+  for (int y = cells->top; y < cells->bottom; ++y)
+  {
+    for (int x = cells->left; x < cells->right; ++x)
+    {
+      auto it = m_grid.find(cell_key(x, y));
+      if (it != m_grid.end())
+        objects.insert(objects.end(), it->second.begin(), it->second.end());
+    }
+  }
+}
+
+/* EOF */
@@ -0,0 +1,106 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_EDITOR_OBJECT_INDEX_HPP
+#define HEADER_SUPERTUX_EDITOR_OBJECT_INDEX_HPP
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "math/rectf.hpp"
+#include "supertux/object_listener.hpp"
+
+class GameObject;
+class GameObjectManager;
+
+/**
+ * A search index over the saveable objects of a sector, by class name,
+   object name and position. It listens to the sector and is updated
+   incrementally, as objects are added, removed or edited.
+
+   A query consists of terms separated by spaces, all of which have to be
+   contained in the class name, display name or name of an object, ignoring
+   case. Terms prefixed with "class:" or "name:" only match the class and
+   display name, or the name, respectively.
+ */
+class EditorObjectIndex final : public ObjectListener
+{
+private:
+  struct Entry
+  {
+    std::string class_name;
+    std::string name;
+
+    /** Range of grid cells the object was registered in, if it has a position */
+    std::optional<Rect> cells;
+  };
+
+  struct ClassBucket
+  {
+    std::string display_name;
+    std::unordered_set<GameObject*> objects;
+  };
+
+public:
+  EditorObjectIndex();
+  ~EditorObjectIndex() override;
+
+  /** Indexes the objects of the given sector, or clears the index, if nullptr.
+      Any other GameObjectManager can be indexed as well. */
+  void set_sector(GameObjectManager* sector);
+
+  /** Returns all objects matching the query, sorted from left to right.
+      If an area is given, only objects overlapping it are returned.
+      Objects without a position come first and never overlap an area. */
+  std::vector<GameObject*> find(const std::string& query, const std::optional<Rectf>& area = std::nullopt) const;
+
+  size_t size() const { return m_entries.size(); }
+
+  void object_added(GameObject& object) override;
+  void object_removed(GameObject& object) override;
+  void object_changed(GameObject& object) override;
+
+private:
+  void add(GameObject& object);
+  void remove(GameObject& object);
+
+  void collect_in_area(const Rectf& area, std::vector<GameObject*>& objects) const;
+
+private:
+  GameObjectManager* m_sector;
+
+  std::unordered_map<GameObject*, Entry> m_entries;
+  std::unordered_map<std::string, ClassBucket> m_objects_by_class;
+  std::unordered_map<std::string, std::unordered_set<GameObject*>> m_objects_by_name;
+
+  /** Objects with a position, in a uniform grid of cells. Objects spanning
+      too many cells are kept separately and checked on every area query. */
+  std::unordered_map<uint64_t, std::vector<GameObject*>> m_grid;
+  std::unordered_set<GameObject*> m_large_objects;
+
+private:
+  EditorObjectIndex(const EditorObjectIndex&) = delete;
+  EditorObjectIndex& operator=(const EditorObjectIndex&) = delete;
+};
+
+#endif
+
+/* EOF */
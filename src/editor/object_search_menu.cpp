@@ -0,0 +1,158 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "editor/object_search_menu.hpp"
+
+#include <fmt/format.h>
+
+#include "editor/editor.hpp"
+#include "editor/object_index.hpp"
+#include "gui/item_textfield.hpp"
+#include "gui/menu_item.hpp"
+#include "gui/menu_manager.hpp"
+#include "supertux/game_object.hpp"
+#include "supertux/moving_object.hpp"
+#include "util/gettext.hpp"
+
+namespace {
+
+/** Listing more matches would make the menu unwieldy. */
+const size_t MAX_LISTED_RESULTS = 50;
+
+} // namespace
+
+ObjectSearchMenu::ObjectSearchMenu() :
+  m_editor(*Editor::current()),
+  m_query(),
+  m_last_query(),
+  m_in_view(false),
+  m_results(),
+  m_results_item()
+{
+  add_label(_("Find Objects"));
+  add_hl();
+  add_textfield(_("Search"), &m_query, MNID_QUERY)
+    .set_help(_("Matches class and object names. Use \"name:\" or \"class:\" to only match either."));
+  add_toggle(MNID_IN_VIEW, _("Only in View"), &m_in_view);
+  add_hl();
+
+  m_results_item = static_cast<int>(m_items.size());
+  refresh_results();
+}
+
+void
+ObjectSearchMenu::event(const SDL_Event& ev)
+{
+  Menu::event(ev);
+
+  // In case a match has been chosen, closing the menu.
+  if (MenuManager::instance().current_menu() != this)
+    return;
+
+  if (m_query != m_last_query)
+    refresh_results();
+}
+
+void
+ObjectSearchMenu::process_action(const MenuAction& action)
+{
+  Menu::process_action(action);
+
+  if (MenuManager::instance().current_menu() != this)
+    return;
+
+  // Backspace is processed as a menu action.
+  if (action == MenuAction::REMOVE && m_query != m_last_query)
+    refresh_results();
+}
+
+void
+ObjectSearchMenu::menu_action(MenuItem& item)
+{
+  const int id = item.get_id();
+  if (id == MNID_IN_VIEW)
+  {
+    refresh_results();
+  }
+  else if (id >= MNID_RESULT && id < MNID_RESULT + static_cast<int>(m_results.size()))
+  {
+    m_editor.set_search_results(m_results, static_cast<size_t>(id - MNID_RESULT));
+    MenuManager::instance().clear_menu_stack();
+    m_editor.m_reactivate_request = true;
+  }
+}
+
+bool
+ObjectSearchMenu::on_back_action()
+{
+  // Allow going through the matches with F3, even if none has been chosen.
+  m_editor.set_search_results(m_results, std::nullopt);
+
+  if (!MenuManager::instance().previous_menu())
+    m_editor.m_reactivate_request = true;
+
+  return true;
+}
+
+void
+ObjectSearchMenu::refresh_results()
+{
+  m_last_query = m_query;
+
+  while (static_cast<int>(m_items.size()) > m_results_item)
+    delete_item(static_cast<int>(m_items.size()) - 1);
+
+  std::optional<Rectf> area;
+  if (m_in_view)
+    area = m_editor.get_visible_area();
+
+  const std::vector<GameObject*> objects = m_editor.get_object_index().find(m_query, area);
+  m_results.clear();
+  for (const auto* object : objects)
+    m_results.push_back(object->get_uid());
+
+  if (m_query.empty() && !m_in_view)
+    add_inactive(_("Type to search for objects"));
+  else if (objects.empty())
+    add_inactive(_("No matches"));
+  else
+    add_inactive(fmt::format(fmt::runtime(_("{} matches")), objects.size()));
+
+  for (size_t i = 0; i < objects.size() && i < MAX_LISTED_RESULTS; ++i)
+  {
+    const GameObject& object = *objects[i];
+
+    std::string text = object.get_display_name();
+    if (!object.get_name().empty())
+      text += " \"" + object.get_name() + "\"";
+
+    if (const auto* moving_object = dynamic_cast<const MovingObject*>(&object))
+      text += fmt::format(" ({}, {})", static_cast<int>(moving_object->get_pos().x),
+                                       static_cast<int>(moving_object->get_pos().y));
+
+    add_entry(MNID_RESULT + static_cast<int>(i), text);
+  }
+
+  if (objects.size() > MAX_LISTED_RESULTS)
+    add_inactive(fmt::format(fmt::runtime(_("... and {} more, use F3 to go through all")),
+                             objects.size() - MAX_LISTED_RESULTS));
+
+  add_hl();
+  add_back(_("Close"));
+}
+
+/* EOF */
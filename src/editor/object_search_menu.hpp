@@ -0,0 +1,73 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_EDITOR_OBJECT_SEARCH_MENU_HPP
+#define HEADER_SUPERTUX_EDITOR_OBJECT_SEARCH_MENU_HPP
+
+#include "gui/menu.hpp"
+
+#include <string>
+#include <vector>
+
+#include "util/uid.hpp"
+
+class Editor;
+
+/** Searches the objects of the current sector, using the editor's object
+    index, and lists the matches, updating them while the query is typed.
+    Choosing a match jumps to it, after which F3 and Shift+F3 jump
+    between the other matches. */
+class ObjectSearchMenu final : public Menu
+{
+private:
+  enum {
+    MNID_QUERY,
+    MNID_IN_VIEW,
+    MNID_RESULT
+  };
+
+public:
+  ObjectSearchMenu();
+
+  void event(const SDL_Event& ev) override;
+  void process_action(const MenuAction& action) override;
+
+  void menu_action(MenuItem& item) override;
+  bool on_back_action() override;
+
+private:
+  void refresh_results();
+
+private:
+  Editor& m_editor;
+  std::string m_query;
+  std::string m_last_query;
+  bool m_in_view;
+
+  std::vector<UID> m_results;
+
+  /** Index of the first menu item, which lists the results */
+  int m_results_item;
+
+private:
+  ObjectSearchMenu(const ObjectSearchMenu&) = delete;
+  ObjectSearchMenu& operator=(const ObjectSearchMenu&) = delete;
+};
+
+#endif
+
+/* EOF */
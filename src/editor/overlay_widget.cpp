@@ -44,6 +44,8 @@ namespace {
 
   const int snap_grid_sizes[4] = {4, 8, 16, 32};
 
+  const float HIGHLIGHT_TIME = 1.5f;
+
 } // namespace
 
 bool EditorOverlayWidget::action_pressed = false;
@@ -66,6 +68,8 @@ EditorOverlayWidget::EditorOverlayWidget(Editor& editor) :
   m_selected_object(nullptr),
   m_edited_path(nullptr),
   m_last_node_marker(nullptr),
+  m_highlighted_object(nullptr),
+  m_highlight_timer(),
   m_object_tip(new Tip()),
   m_obj_mouse_desync(0, 0),
   m_rectangle_preview(new TileSelection()),
@@ -99,6 +103,7 @@ EditorOverlayWidget::on_level_change()
 {
   m_dragged_object = nullptr;
   m_selected_object = nullptr;
+  m_highlighted_object = nullptr;
   m_edited_path = nullptr;
   m_last_node_marker = nullptr;
   m_hovered_object = nullptr;
@@ -434,10 +439,15 @@ EditorOverlayWidget::fill()
 {
   auto tiles = m_editor.get_tiles();
   auto tilemap = m_editor.get_selected_tilemap();
-  if (!tilemap) return;
+  if (!tilemap || !is_position_inside_tilemap(tilemap, m_hovered_tile)) return;
+
+  const int width = tilemap->get_width();
+  const int height = tilemap->get_height();
+  const int start_x = static_cast<int>(m_hovered_tile.x);
+  const int start_y = static_cast<int>(m_hovered_tile.y);
 
   // The tile that is going to be replaced:
-  uint32_t replace_tile = tilemap->get_tile_id(static_cast<int>(m_hovered_tile.x), static_cast<int>(m_hovered_tile.y));
+  const uint32_t replace_tile = tilemap->get_tile_id(start_x, start_y);
 
   if (replace_tile == tiles->pos(0, 0))
   {
@@ -445,93 +455,112 @@ EditorOverlayWidget::fill()
     return;
   }
 
-  std::vector<Vector> pos_stack;
-  pos_stack.clear();
-  pos_stack.push_back(m_hovered_tile);
+  const auto pattern_tile = [&tiles, start_x, start_y](int x, int y) {
+    return tiles->pos(x - start_x, y - start_y);
+  };
 
-  // Passing recursively trough all tiles to be replaced...
-  while (pos_stack.size())
-  {
+  const std::vector<uint32_t>& old_tiles = tilemap->get_tiles();
+  std::vector<bool> filled(old_tiles.size(), false);
 
-    if (pos_stack.size() > 1000000)
-    {
-      log_warning << "More than 1'000'000 tiles in stack to fill, STOP" << std::endl;
-      return;
-    }
+  const auto can_fill = [&](int x, int y) {
+    const size_t index = static_cast<size_t>(y) * width + x;
+    return !filled[index] && check_tiles_for_fill(replace_tile, old_tiles[index], pattern_tile(x, y));
+  };
 
-    Vector pos = pos_stack[pos_stack.size() - 1];
-    Vector tpos = pos - m_hovered_tile;
+  // Scanline fill: Extend each seed to a horizontal span of fillable tiles,
+  // then seed each run of fillable tiles in the rows above and below it.
+  struct Span
+  {
+    int y;
+    int left;
+    int right;
+  };
+  std::vector<Span> spans;
+  std::vector<std::pair<int, int>> seeds;
 
-    // Tests for being inside tilemap:
-    if (!is_position_inside_tilemap(tilemap, pos))
-    {
-      pos_stack.pop_back();
-      continue;
-    }
+  filled[static_cast<size_t>(start_y) * width + start_x] = true;
+  seeds.emplace_back(start_x, start_y);
+  while (!seeds.empty())
+  {
+    const int x = seeds.back().first;
+    const int y = seeds.back().second;
+    seeds.pop_back();
 
-    // Autotile will happen later, so that directional filling works properly
-    input_tile(pos, tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y)));
+    int left = x;
+    while (left > 0 && can_fill(left - 1, y))
+      filled[static_cast<size_t>(y) * width + --left] = true;
 
-    Vector pos_(0.0f, 0.0f);
+    int right = x;
+    while (right < width - 1 && can_fill(right + 1, y))
+      filled[static_cast<size_t>(y) * width + ++right] = true;
 
-    // Going left...
-    pos_ = pos + Vector(-1, 0);
-    if (pos_.x >= 0)
+    spans.push_back({ y, left, right });
+
+    for (const int row : { y - 1, y + 1 })
     {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x - 1), static_cast<int>(tpos.y))))
-      {
-        pos_stack.push_back( pos_ );
+      if (row < 0 || row >= height)
         continue;
-      }
-    }
 
-    // Going right...
-    pos_ = pos + Vector(1, 0);
-    if (pos_.x < static_cast<float>(tilemap->get_width()))
-    {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x + 1), static_cast<int>(tpos.y))))
+      bool in_run = false;
+      for (int i = left; i <= right; ++i)
       {
-        pos_stack.push_back( pos_ );
-        continue;
+        if (!can_fill(i, row))
+        {
+          in_run = false;
+        }
+        else if (!in_run)
+        {
+          filled[static_cast<size_t>(row) * width + i] = true;
+          seeds.emplace_back(i, row);
+          in_run = true;
+        }
       }
     }
+  }
+
+  tilemap->save_state();
+
+  std::vector<uint32_t> new_tiles = old_tiles;
+  for (const auto& span : spans)
+    for (int x = span.left; x <= span.right; ++x)
+      new_tiles[static_cast<size_t>(span.y) * width + x] = pattern_tile(x, span.y);
+
+  tilemap->apply_delta(TileMapDelta(old_tiles, new_tiles));
 
-    // Going up...
-    pos_ = pos + Vector(0, -1);
-    if (pos_.y >= 0)
+  // Autotile happens after all tiles have been placed (because of borders; see snow tileset),
+  // once for each filled tile and each tile bordering them.
+  if (g_config->editor_autotile_mode)
+  {
+    std::vector<bool> autotiled(new_tiles.size(), false);
+    for (const auto& span : spans)
     {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y - 1))))
+      for (int x = span.left; x <= span.right; ++x)
       {
-        pos_stack.push_back( pos_ );
-        continue;
+        autotiled[static_cast<size_t>(span.y) * width + x] = true;
+        tilemap->autotile(x, span.y, pattern_tile(x, span.y));
       }
     }
 
-    // Going down...
-    pos_ = pos + Vector(0, 1);
-    if (pos_.y < static_cast<float>(tilemap->get_height()))
+    // Bordering tiles are autotiled with the tile filled in next to them,
+    // not with the pattern tile for their own position.
+    for (const auto& span : spans)
     {
-      if (check_tiles_for_fill(replace_tile,
-          tilemap->get_tile_id(static_cast<int>(pos_.x), static_cast<int>(pos_.y)),
-          tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y + 1))))
+      for (int x = span.left; x <= span.right; ++x)
       {
-        pos_stack.push_back( pos_ );
-        continue;
+        for (int y = std::max(span.y - 1, 0); y <= std::min(span.y + 1, height - 1); ++y)
+        {
+          for (int border_x = std::max(x - 1, 0); border_x <= std::min(x + 1, width - 1); ++border_x)
+          {
+            const size_t index = static_cast<size_t>(y) * width + border_x;
+            if (autotiled[index])
+              continue;
+
+            autotiled[index] = true;
+            tilemap->autotile(border_x, y, pattern_tile(x, span.y));
+          }
+        }
       }
     }
-
-    // Autotile happens after directional detection (because of borders; see snow tileset)
-    if (g_config->editor_autotile_mode)
-      input_autotile(pos, tiles->pos(static_cast<int>(tpos.x), static_cast<int>(tpos.y)));
-
-    // When tiles on each side are already filled or occupied by another tiles, it ends.
-    pos_stack.pop_back();
   }
 }
 
@@ -662,20 +691,36 @@ EditorOverlayWidget::select_object()
   delete_markers();
   if (!m_dragged_object || !m_dragged_object->is_valid()) return;
 
-  if (m_dragged_object->has_variable_size())
+  select_object(*m_dragged_object);
+}
+
+void
+EditorOverlayWidget::select_object(MovingObject& object)
+{
+  if (object.has_variable_size())
   {
-    m_selected_object = m_dragged_object;
-    m_dragged_object->editor_select();
+    m_selected_object = &object;
+    object.editor_select();
     return;
   }
 
-  auto path_obj = dynamic_cast<PathObject*>(m_dragged_object.get());
+  auto path_obj = dynamic_cast<PathObject*>(&object);
 
   if (path_obj && path_obj->get_path_gameobject()) {
-    edit_path(path_obj->get_path_gameobject(), m_dragged_object.get());
+    edit_path(path_obj->get_path_gameobject(), &object);
   }
 }
 
+void
+EditorOverlayWidget::highlight_object(MovingObject& object)
+{
+  delete_markers();
+  select_object(object);
+
+  m_highlighted_object = &object;
+  m_highlight_timer.start(HIGHLIGHT_TIME);
+}
+
 void
 EditorOverlayWidget::grab_object()
 {
@@ -1349,51 +1394,40 @@ EditorOverlayWidget::draw_tile_grid(DrawingContext& context, int tile_size, bool
   end.x = std::min(static_cast<float>(current_tm->get_width() * (32 / tile_size)), end.x);
   end.y = std::min(static_cast<float>(current_tm->get_height() * (32 / tile_size)), end.y);
 
-  Vector line_start(0.0f, 0.0f);
-  Vector line_end(0.0f, 0.0f);
-  auto draw_line = [&](const Vector& from, const Vector& to, const Color& col)
-  {
-    context.color().draw_line(from, to, col, current_tm->get_layer());
-  };
-  if (draw_shadow)
+  // Lines of the same color are drawn all at once.
+  std::vector<Vector> lines;
+  const int line_count = std::max(static_cast<int>(end.x) - static_cast<int>(start.x) + 1, 0) +
+                         std::max(static_cast<int>(end.y) - static_cast<int>(start.y) + 1, 0);
+  lines.reserve(static_cast<size_t>(line_count) * 2);
+  const auto add_lines = [&](const Vector& offset)
   {
-    Vector viewport_scale = VideoSystem::current()->get_viewport().get_scale();
-    const Color shadow_colour(0.0f, 0.0f, 0.0f, 0.05f);
-    const Vector shadow_offset(1.0f / viewport_scale.x,
-      1.0f / viewport_scale.y);
     for (int i = static_cast<int>(start.x); i <= static_cast<int>(end.x); i++)
     {
-      line_start = tile_screen_pos(Vector(static_cast<float>(i), 0.0f),
-        tile_size) + shadow_offset;
-      line_end = tile_screen_pos(Vector(static_cast<float>(i), end.y),
-        tile_size) + shadow_offset;
-      draw_line(line_start, line_end, shadow_colour);
+      lines.push_back(tile_screen_pos(Vector(static_cast<float>(i), 0.0f), tile_size) + offset);
+      lines.push_back(tile_screen_pos(Vector(static_cast<float>(i), end.y), tile_size) + offset);
     }
 
     for (int i = static_cast<int>(start.y); i <= static_cast<int>(end.y); i++)
     {
-      line_start = tile_screen_pos(Vector(0.0f, static_cast<float>(i)),
-        tile_size) + shadow_offset;
-      line_end = tile_screen_pos(Vector(end.x, static_cast<float>(i)),
-        tile_size) + shadow_offset;
-      draw_line(line_start, line_end, shadow_colour);
+      lines.push_back(tile_screen_pos(Vector(0.0f, static_cast<float>(i)), tile_size) + offset);
+      lines.push_back(tile_screen_pos(Vector(end.x, static_cast<float>(i)), tile_size) + offset);
     }
-  }
+  };
 
-  const Color line_color(1.f, 1.f, 1.f, 0.2f);
-  for (int i = static_cast<int>(start.x); i <= static_cast<int>(end.x); i++)
+  if (draw_shadow)
   {
-    line_start = tile_screen_pos(Vector(static_cast<float>(i), 0.0f), tile_size);
-    line_end = tile_screen_pos(Vector(static_cast<float>(i), end.y), tile_size);
-    draw_line(line_start, line_end, line_color);
+    Vector viewport_scale = VideoSystem::current()->get_viewport().get_scale();
+    const Color shadow_colour(0.0f, 0.0f, 0.0f, 0.05f);
+    const Vector shadow_offset(1.0f / viewport_scale.x,
+      1.0f / viewport_scale.y);
+    add_lines(shadow_offset);
+    context.color().draw_lines(lines, shadow_colour, current_tm->get_layer());
+    lines.clear();
   }
 
-  for (int i = static_cast<int>(start.y); i <= static_cast<int>(end.y); i++)
-  {
-    line_start = tile_screen_pos(Vector(0.0f, static_cast<float>(i)), tile_size);
-    line_end = tile_screen_pos(Vector(end.x, static_cast<float>(i)), tile_size);
-    draw_line(line_start, line_end, line_color);
-  }
+  const Color line_color(1.f, 1.f, 1.f, 0.2f);
+  add_lines(Vector(0.0f, 0.0f));
+  context.color().draw_lines(lines, line_color, current_tm->get_layer());
 }
 
 void
@@ -1407,10 +1441,25 @@ EditorOverlayWidget::draw_tilemap_border(DrawingContext& context)
   Vector start = tile_screen_pos( Vector(0, 0) );
   Vector end = tile_screen_pos( Vector(static_cast<float>(current_tm->get_width()),
                                        static_cast<float>(current_tm->get_height())) );
-  context.color().draw_line(start, Vector(start.x, end.y), Color(1, 0, 1), current_tm->get_layer());
-  context.color().draw_line(start, Vector(end.x, start.y), Color(1, 0, 1), current_tm->get_layer());
-  context.color().draw_line(Vector(start.x, end.y), end, Color(1, 0, 1), current_tm->get_layer());
-  context.color().draw_line(Vector(end.x, start.y), end, Color(1, 0, 1), current_tm->get_layer());
+  context.color().draw_lines({ start, Vector(start.x, end.y),
+                               start, Vector(end.x, start.y),
+                               Vector(start.x, end.y), end,
+                               Vector(end.x, start.y), end },
+                             Color(1, 0, 1), current_tm->get_layer());
+}
+
+void
+EditorOverlayWidget::draw_highlight(DrawingContext& context)
+{
+  if (!m_highlight_timer.started() || !m_highlighted_object || !m_highlighted_object->is_valid())
+    return;
+
+  const Rectf bbox = m_highlighted_object->get_bbox().grown(4.f);
+  const Color color(1.0f, 0.8f, 0.0f, m_highlight_timer.get_timeleft() / HIGHLIGHT_TIME);
+  context.color().draw_filled_rect(Rectf(bbox.p1(), Vector(bbox.get_right(), bbox.get_top() + 2.f)), color, 0.0f, LAYER_GUI - 5);
+  context.color().draw_filled_rect(Rectf(Vector(bbox.get_left(), bbox.get_bottom() - 2.f), bbox.p2()), color, 0.0f, LAYER_GUI - 5);
+  context.color().draw_filled_rect(Rectf(bbox.p1(), Vector(bbox.get_left() + 2.f, bbox.get_bottom())), color, 0.0f, LAYER_GUI - 5);
+  context.color().draw_filled_rect(Rectf(Vector(bbox.get_right() - 2.f, bbox.get_top()), bbox.p2()), color, 0.0f, LAYER_GUI - 5);
 }
 
 void
@@ -1421,11 +1470,20 @@ EditorOverlayWidget::draw_path(DrawingContext& context)
   if (!m_selected_object->is_valid()) return;
   if (!m_edited_path->is_valid()) return;
 
+  // Bezier handles and curves are each drawn in a single request.
+  std::vector<Vector> handle_lines;
+  std::vector<Vector> curve_lines;
   for (auto i = m_edited_path->get_path().m_nodes.begin(); i != m_edited_path->get_path().m_nodes.end(); ++i)
   {
     auto j = i+1;
     Path::Node* node1 = &(*i);
     Path::Node* node2;
+
+    handle_lines.push_back(node1->position);
+    handle_lines.push_back(node1->bezier_before);
+    handle_lines.push_back(node1->position);
+    handle_lines.push_back(node1->bezier_after);
+
     if (j == m_edited_path->get_path().m_nodes.end())
     {
       if (m_edited_path->get_path().m_mode == WalkMode::CIRCULAR)
@@ -1436,12 +1494,6 @@ EditorOverlayWidget::draw_path(DrawingContext& context)
       else
       {
         // Just draw the bezier lines
-        context.color().draw_line(node1->position,
-                                  node1->bezier_before,
-                                  Color(0, 0, 1), LAYER_GUI - 21);
-        context.color().draw_line(node1->position,
-                                  node1->bezier_after,
-                                  Color(0, 0, 1), LAYER_GUI - 21);
         continue;
       }
     }
@@ -1449,24 +1501,16 @@ EditorOverlayWidget::draw_path(DrawingContext& context)
     {
       node2 = &(*j);
     }
-    Bezier::draw_curve(context,
-                       node1->position,
-                       node1->bezier_after,
-                       node2->bezier_before,
-                       node2->position,
-                       100,
-                       Color::RED,
-                       LAYER_GUI - 21);
-    context.color().draw_line(node1->position,
-                              node1->bezier_before,
-                              Color(0, 0, 1), LAYER_GUI - 21);
-    context.color().draw_line(node1->position,
-                              node1->bezier_after,
-                              Color(0, 0, 1), LAYER_GUI - 21);
-    //context.color().draw_line(node1->position,
-    //                          node2->position,
-    //                          Color(1, 0, 0), LAYER_GUI - 21);
+    Bezier::get_curve_lines(node1->position,
+                            node1->bezier_after,
+                            node2->bezier_before,
+                            node2->position,
+                            100,
+                            curve_lines);
   }
+
+  context.color().draw_lines(curve_lines, Color::RED, LAYER_GUI - 21);
+  context.color().draw_lines(handle_lines, Color(0, 0, 1), LAYER_GUI - 21);
 }
 
 void
@@ -1501,6 +1545,7 @@ EditorOverlayWidget::draw(DrawingContext& context)
   draw_tile_tip(context);
   draw_rectangle_preview(context);
   draw_path(context);
+  draw_highlight(context);
 
   if (m_editor.get_tileselect_input_type() == EditorTilebox::InputType::TILE &&
       !g_config->editor_show_deprecated_tiles) // If showing deprecated tiles is enabled, this is redundant, since tiles are indicated without the need of hovering over.
@@ -71,6 +71,9 @@ public:
   void edit_path(PathGameObject* path, GameObject* new_marked_object = nullptr);
   void reset_action_press();
 
+  /** Selects the object and outlines it for a moment, e.g. after it has been found. */
+  void highlight_object(MovingObject& object);
+
 private:
   static bool action_pressed;
   static bool alt_pressed;
@@ -99,6 +102,7 @@ private:
   void hover_object();
   void show_object_menu(GameObject& object);
   void select_object();
+  void select_object(MovingObject& object);
   void add_path_node();
 
   void draw_tile_tip(DrawingContext&);
@@ -106,6 +110,7 @@ private:
   void draw_tilemap_border(DrawingContext&);
   void draw_path(DrawingContext&);
   void draw_rectangle_preview(DrawingContext& context);
+  void draw_highlight(DrawingContext& context);
 
   void process_left_click();
   void process_right_click();
@@ -146,6 +151,8 @@ private:
   TypedUID<GameObject> m_selected_object;
   TypedUID<PathGameObject> m_edited_path;
   TypedUID<NodeMarker> m_last_node_marker;
+  TypedUID<MovingObject> m_highlighted_object;
+  Timer m_highlight_timer;
 
   std::unique_ptr<Tip> m_object_tip;
   Vector m_obj_mouse_desync;
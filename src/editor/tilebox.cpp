@@ -44,6 +44,10 @@ EditorTilebox::EditorTilebox(Editor& editor, const Rectf& rect) :
   m_on_select_callback([](EditorTilebox&) {}),
   m_scrollbar(),
   m_scroll_progress(1.f),
+  m_visible_tiles(),
+  m_visible_tiles_dirty(true),
+  m_visible_tiles_scroll(0.f),
+  m_visible_tiles_labels(false),
   m_hovered_item(HoveredItem::NONE),
   m_hovered_tile(-1),
   m_dragging(false),
@@ -97,23 +101,56 @@ EditorTilebox::draw(DrawingContext& context)
 }
 
 void
-EditorTilebox::draw_tilegroup(DrawingContext& context)
+EditorTilebox::get_visible_range(int& begin, int& end, int item_count) const
+{
+  const int first_row = std::max(static_cast<int>(floorf(m_scroll_progress / 32.f)), 0);
+  const int last_row = static_cast<int>(ceilf((m_scroll_progress + m_rect.get_height()) / 32.f));
+
+  begin = std::min(first_row * 4, item_count);
+  end = std::min(last_row * 4, item_count);
+}
+
+void
+EditorTilebox::update_visible_tiles()
 {
-  int pos = -1;
-  for (auto& tile_ID : m_active_tilegroup->tiles)
+  const bool show_labels = g_config->developer_mode &&
+                           (m_active_tilegroup->developers_group || g_debug.show_toolbox_tile_ids);
+
+  if (!m_visible_tiles_dirty && m_visible_tiles_scroll == m_scroll_progress &&
+      m_visible_tiles_labels == show_labels)
+    return;
+
+  m_visible_tiles.clear();
+
+  int begin, end;
+  get_visible_range(begin, end, static_cast<int>(m_active_tilegroup->tiles.size()));
+  for (int pos = begin; pos < end; ++pos)
   {
-    pos++;
-    if (pos / 4 < static_cast<int>(m_scroll_progress / 32.f))
-      continue;
+    const uint32_t tile_ID = m_active_tilegroup->tiles[pos];
+    m_visible_tiles.push_back({ tile_ID, get_tile_coords(pos, false),
+                                show_labels && tile_ID != 0 ? std::to_string(tile_ID) : std::string() });
+  }
 
-    auto position = get_tile_coords(pos, false);
-    m_editor.get_tileset()->get(tile_ID).draw(context.color(), position, LAYER_GUI - 9);
+  m_visible_tiles_dirty = false;
+  m_visible_tiles_scroll = m_scroll_progress;
+  m_visible_tiles_labels = show_labels;
+}
+
+void
+EditorTilebox::draw_tilegroup(DrawingContext& context)
+{
+  update_visible_tiles();
 
-    if (g_config->developer_mode && (m_active_tilegroup->developers_group || g_debug.show_toolbox_tile_ids) && tile_ID != 0)
+  const TileSet& tileset = *m_editor.get_tileset();
+  for (const auto& tile : m_visible_tiles)
+  {
+    tileset.get(tile.id).draw(context.color(), tile.position, LAYER_GUI - 9);
+
+    if (!tile.label.empty())
     {
       // Display tile ID on top of tile:
-      context.color().draw_text(Resources::console_font, std::to_string(tile_ID),
-                                position + Vector(16, 16), ALIGN_CENTER, LAYER_GUI - 9, Color::WHITE);
+      context.color().draw_text(Resources::console_font, tile.label,
+                                tile.position + Vector(16, 16), ALIGN_CENTER, LAYER_GUI - 9, Color::WHITE);
     }
   }
 }
@@ -121,15 +158,12 @@ EditorTilebox::draw_tilegroup(DrawingContext& context)
 void
 EditorTilebox::draw_objectgroup(DrawingContext& context)
 {
-  int pos = -1;
-  for (auto& icon : m_active_objectgroup->get_icons())
-  {
-    pos++;
-    if (pos / 4 < static_cast<int>(m_scroll_progress / 32.f))
-      continue;
+  auto& icons = m_active_objectgroup->get_icons();
 
-    icon.draw(context, get_tile_coords(pos, false));
-  }
+  int begin, end;
+  get_visible_range(begin, end, static_cast<int>(icons.size()));
+  for (int pos = begin; pos < end; ++pos)
+    icons[pos].draw(context, get_tile_coords(pos, false));
 }
 
 Rectf
@@ -312,6 +346,8 @@ EditorTilebox::update_hovered_tile()
 void
 EditorTilebox::on_window_resize()
 {
+  m_visible_tiles_dirty = true;
+
   m_scrollbar->set_covered_region(m_rect.get_height());
   m_scrollbar->set_total_region(get_tiles_height());
   m_scrollbar->set_rect(Rectf(Vector(m_rect.get_right() - 10.f, m_rect.get_top()), m_rect.p2()));
@@ -381,6 +417,7 @@ void
 EditorTilebox::set_tilegroup(std::unique_ptr<Tilegroup> tilegroup)
 {
   m_active_tilegroup = std::move(tilegroup);
+  m_visible_tiles_dirty = true;
 }
 
 void
@@ -433,6 +470,7 @@ EditorTilebox::reset_scrollbar()
 {
   m_scroll_progress = 0.f;
   m_scrollbar->set_total_region(get_tiles_height());
+  m_visible_tiles_dirty = true;
 }
 
 /* EOF */
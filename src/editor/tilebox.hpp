@@ -104,9 +104,24 @@ private:
 
   void reset_scrollbar();
 
+  /** Returns the range of item positions in rows, which are at least partially visible. */
+  void get_visible_range(int& begin, int& end, int item_count) const;
+
+  /** Rebuilds the list of visible tiles, if it has been invalidated or the tilebox has been scrolled. */
+  void update_visible_tiles();
+
   void draw_tilegroup(DrawingContext& context);
   void draw_objectgroup(DrawingContext& context);
 
+private:
+  struct VisibleTile
+  {
+    uint32_t id;
+    Vector position;
+    /** The tile ID as text, if IDs are shown */
+    std::string label;
+  };
+
 private:
   Editor& m_editor;
 
@@ -127,6 +142,13 @@ private:
   std::unique_ptr<ControlScrollbar> m_scrollbar;
   float m_scroll_progress;
 
+  /** Tiles of the active tilegroup within the visible rows, so the whole
+      tilegroup doesn't have to be gone through on every frame. */
+  std::vector<VisibleTile> m_visible_tiles;
+  bool m_visible_tiles_dirty;
+  float m_visible_tiles_scroll;
+  bool m_visible_tiles_labels;
+
   HoveredItem m_hovered_item;
   int m_hovered_tile;
 
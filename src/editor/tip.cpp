@@ -53,7 +53,8 @@ Tip::set_info(const std::string& text)
 void
 Tip::set_info_for_object(GameObject& object)
 {
-  auto os = object.get_settings();
+  // Called on every mouse motion while hovering, so the settings are cached.
+  const ObjectSettings& os = object.get_cached_settings();
   m_header = os.get_name();
   m_strings.clear();
   m_warnings.clear();
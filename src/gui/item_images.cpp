@@ -19,25 +19,18 @@
 #include "supertux/resources.hpp"
 #include "video/surface.hpp"
 #include "video/drawing_context.hpp"
+#include "video/texture_manager.hpp"
 
 ItemImages::ItemImages(const std::string& image_path, int max_image_width, int max_image_height, int id):
-  MenuItem("", id),
-  m_images(),
-  m_gallery_mode(false),
-  m_selected_image(0),
-  m_max_image_width(max_image_width),
-  m_max_image_height(max_image_height),
-  m_item_width(0),
-  m_item_height(0)
+  ItemImages(std::vector<std::string>({ image_path }), max_image_width, max_image_height, id)
 {
-  m_images.push_back(Surface::from_file(image_path));
-  m_item_width = (m_images[0]->get_width() > max_image_width && max_image_width > 0 ? max_image_width : m_images[0]->get_width()) + 4;
-  m_item_height = (m_images[0]->get_height() > max_image_height && max_image_height > 0 ? max_image_height : m_images[0]->get_height()) + 4;
 }
 
 ItemImages::ItemImages(const std::vector<std::string>& image_paths, int max_image_width, int max_image_height, int id):
   MenuItem("", id),
+  m_image_paths(image_paths),
   m_images(),
+  m_images_ready(),
   m_gallery_mode(image_paths.size() > 1),
   m_selected_image(0),
   m_max_image_width(max_image_width),
@@ -45,6 +38,20 @@ ItemImages::ItemImages(const std::vector<std::string>& image_paths, int max_imag
   m_item_width(0),
   m_item_height(0)
 {
+  if (max_image_width > 0 && max_image_height > 0)
+  {
+    // The size of the item doesn't depend on the images, so they are
+    // decoded in the background, showing a placeholder until then.
+    for (const auto& image_path : image_paths)
+    {
+      m_images_ready.push_back(TextureManager::current()->is_ready(image_path));
+      m_images.push_back(Surface::from_texture(TextureManager::current()->get_async(image_path)));
+    }
+    m_item_width = max_image_width + 4;
+    m_item_height = max_image_height + 4;
+    return;
+  }
+
   int max_width = 0;
   int max_height = 0;
   for (unsigned i = 0; i < image_paths.size(); i++)
@@ -55,6 +62,7 @@ ItemImages::ItemImages(const std::vector<std::string>& image_paths, int max_imag
     if(m_images[i]->get_height() > max_height)
       max_height = (m_images[i]->get_height() > max_image_height && max_image_height > 0 ? max_image_height : m_images[i]->get_height());
   }
+  m_images_ready.assign(m_images.size(), true);
   m_item_width = max_width + 4;
   m_item_height = max_height + 4;
 }
@@ -64,6 +72,13 @@ ItemImages::draw(DrawingContext& drawing_context, const Vector& pos, int menu_wi
 {
   if (m_images.empty())
     return;
+  if (!m_images_ready[m_selected_image] &&
+      TextureManager::current()->is_ready(m_image_paths[m_selected_image]))
+  {
+    // Replace the placeholder with the decoded image.
+    m_images[m_selected_image] = Surface::from_texture(TextureManager::current()->get(m_image_paths[m_selected_image]));
+    m_images_ready[m_selected_image] = true;
+  }
   SurfacePtr surface = m_images[m_selected_image];
   if (m_max_image_width > 0 && m_max_image_height > 0 && (surface->get_width() > m_max_image_width || surface->get_height() > m_max_image_height))
     drawing_context.color().draw_surface_scaled(surface, Rectf(pos + Vector((menu_width - m_max_image_width)/2 - 2, -m_max_image_height/2),
@@ -32,7 +32,11 @@ public:
   virtual void process_action(const MenuAction& action) override;
 
 private:
+  std::vector<std::string> m_image_paths;
   std::vector<SurfacePtr> m_images;
+
+  /** False, while an image is replaced by a placeholder, until it's decoded */
+  std::vector<bool> m_images_ready;
   bool m_gallery_mode;
   int m_selected_image;
   int m_max_image_width;
@@ -103,23 +103,35 @@ void
 Bezier::draw_curve(DrawingContext& context, const Vector& p1, const Vector& p2,
                    const Vector& p3, const Vector& p4, int steps, Color color,
                    int layer)
+{
+  std::vector<Vector> lines;
+  get_curve_lines(p1, p2, p3, p4, steps, lines);
+  context.color().draw_lines(lines, color, layer);
+}
+
+void
+Bezier::get_curve_lines(const Vector& p1, const Vector& p2, const Vector& p3,
+                        const Vector& p4, int steps, std::vector<Vector>& lines)
 {
   // Save ourselves some processing time in common special cases.
   if (p1 == p2 && p3 == p4)
   {
-    context.color().draw_line(p1, p4, color, layer);
+    lines.push_back(p1);
+    lines.push_back(p4);
     return;
   }
 
+  lines.reserve(lines.size() + static_cast<size_t>(steps) * 2);
+
+  Vector previous = p1;
   for (int i = 0; i < steps; i += 1)
   {
-    float f1 = static_cast<float>(i) / static_cast<float>(steps),
-          f2 = static_cast<float>(i + 1) / static_cast<float>(steps);
+    const float f = static_cast<float>(i + 1) / static_cast<float>(steps);
+    const Vector point = get_point(p1, p2, p3, p4, f);
 
-    context.color().draw_line(get_point(p1, p2, p3, p4, f1),
-                              get_point(p1, p2, p3, p4, f2),
-                              color,
-                              layer);
+    lines.push_back(previous);
+    lines.push_back(point);
+    previous = point;
   }
 }
 
@@ -17,6 +17,8 @@
 #ifndef HEADER_SUPERTUX_MATH_BEZIER_HPP
 #define HEADER_SUPERTUX_MATH_BEZIER_HPP
 
+#include <vector>
+
 #include <math/vector.hpp>
 
 class Color;
@@ -37,6 +39,9 @@ public:
   static Vector get_point_by_length(const Vector& p1, const Vector& p2, const Vector& p3, const Vector& p4, float t);
   // FIXME: Move this to the Canvas object?
   static void draw_curve(DrawingContext& context, const Vector& p1, const Vector& p2, const Vector& p3, const Vector& p4, int steps, Color color, int layer);
+  // Appends the start and end points of the lines approximating the curve, as passed to Canvas::draw_lines()
+  static void get_curve_lines(const Vector& p1, const Vector& p2, const Vector& p3, const Vector& p4, int steps,
+                              std::vector<Vector>& lines);
 
 private:
   Bezier(const Bezier&) = delete;
@@ -43,6 +43,7 @@ public:
   ~Background() override;
 
   virtual void update(float dt_sec) override;
+  virtual int get_update_access() const override { return UPDATE_ACCESS_OWN; }
   virtual void draw(DrawingContext& context) override;
 
   static std::string class_name() { return "background"; }
@@ -54,6 +54,7 @@ public:
 
   virtual void draw(DrawingContext& context) override;
   virtual void update(float dt_sec) override;
+  virtual int get_update_access() const override { return UPDATE_ACCESS_OWN; }
 
   virtual void on_flip(float height) override;
 
@@ -87,11 +87,10 @@ Explosion::explode()
 
   if (does_push) {
     Vector center = m_col.m_bbox.get_middle ();
-    auto near_objects = Sector::get().get_nearby_objects (center, 128.0 * 32.0);
-
-    for (auto& obj: near_objects) {
+    Sector::get().for_each_nearby_object(center, 128.0f * 32.0f, [this, &center](MovingObject& object) {
+      MovingObject* obj = &object;
       if(!Sector::current()->free_line_of_sight(center, obj->get_pos(), true))
-        continue;
+        return;
 
       Vector obj_vector = obj->get_bbox ().get_middle ();
       Vector direction = obj_vector - center;
@@ -100,7 +99,7 @@ Explosion::explode()
       /* If the distance is very small, for example because "obj" is the badguy
        * causing the explosion, skip this object. */
       if (distance <= 1.0f)
-        continue;
+        return;
 
       /* The force decreases with the distance squared. In the distance of one
        * tile (32 pixels) you will have a speed increase of 150 pixels/s. */
@@ -144,7 +143,7 @@ Explosion::explode()
       if (weakblock && in_break_range) {
         weakblock->startBurning();
       }
-    }
+    });
   }
 }
 
@@ -76,7 +76,7 @@ GhostParticleSystem::update(float dt_sec)
     particle->pos.x -= particle->speed * dt_sec;
     if (particle->pos.y > static_cast<float>(SCREEN_HEIGHT)) {
       particle->pos.y = fmodf(particle->pos.y , virtual_height);
-      particle->pos.x = graphicsRandom.randf(virtual_width);
+      particle->pos.x = m_random.randf(virtual_width);
     }
   }
 }
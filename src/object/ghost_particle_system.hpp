@@ -31,6 +31,7 @@ public:
 
   void init();
   virtual void update(float dt_sec) override;
+  virtual int get_update_access() const override { return UPDATE_ACCESS_OWN; }
 
   static std::string class_name() { return "particles-ghosts"; }
   virtual std::string get_class_name() const override { return class_name(); }
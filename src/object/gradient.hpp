@@ -39,6 +39,7 @@ public:
   ~Gradient() override;
 
   virtual void update(float dt_sec) override;
+  virtual int get_update_access() const override { return UPDATE_ACCESS_OWN; }
   virtual void draw(DrawingContext& context) override;
 
   virtual bool is_saveable() const override;
@@ -128,6 +128,14 @@ public:
    */
   void set_action(const Direction& dir, int loops = -1);
 
+  /** Sets the action from an action ID, as well as the number of times it should loop. */
+  void set_action(const ActionId& action, int loops = -1);
+
+  /** Sets the action from an action ID and a particular direction,
+      in the form specified by the ID, eg. "walk-left".
+   */
+  void set_action(const ActionId& action, const Direction& dir, int loops = -1);
+
   /** Set new action for sprite and re-center bounding box.  use with
       care as you can easily get stuck when resizing the bounding
       box. */
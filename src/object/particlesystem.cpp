@@ -40,8 +40,10 @@ ParticleSystem::ParticleSystem(const ReaderMapping& reader, float max_particle_s
   particles(),
   virtual_width(static_cast<float>(SCREEN_WIDTH) + max_particle_size * 2.0f),
   virtual_height(static_cast<float>(SCREEN_HEIGHT) + max_particle_size * 2.0f),
+  m_random(),
   enabled(true)
 {
+  m_random.seed(graphicsRandom.rand());
   reader.get("enabled", enabled, true);
   z_pos = reader_get_layer(reader, LAYER_BACKGROUND1);
 }
@@ -53,8 +55,10 @@ ParticleSystem::ParticleSystem(float max_particle_size_) :
   particles(),
   virtual_width(static_cast<float>(SCREEN_WIDTH) + max_particle_size * 2.0f),
   virtual_height(static_cast<float>(SCREEN_HEIGHT) + max_particle_size * 2.0f),
+  m_random(),
   enabled(true)
 {
+  m_random.seed(graphicsRandom.rand());
 }
 
 ObjectSettings
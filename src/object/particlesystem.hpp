@@ -19,6 +19,7 @@
 
 #include <vector>
 
+#include "math/random.hpp"
 #include "math/vector.hpp"
 #include "supertux/game_object.hpp"
 #include "video/surface_ptr.hpp"
@@ -116,6 +117,10 @@ protected:
   float virtual_width;
   float virtual_height;
 
+  /** Random generator for use in update(), as graphicsRandom
+      must not be accessed from parallel updates. */
+  Random m_random;
+
   /**
    * @scripting
    * @description Determines whether the system is enabled.
@@ -127,23 +127,23 @@ ParticleSystem_Interactive::collision(Particle* object, const Vector& movement)
     // FIXME Handle a nonzero tilemap offset
     for (int x = starttilex; x*32 < max_x; ++x) {
       for (int y = starttiley; y*32 < max_y; ++y) {
-        const Tile& tile = solids->get_tile(x, y);
+        const TileMap::CollisionTile& tile = solids->get_collision_tile(x, y);
 
         // skip non-solid tiles, except water
-        if (! (tile.get_attributes() & (Tile::WATER | Tile::SOLID)))
+        if (! (tile.attributes & (Tile::WATER | Tile::SOLID)))
           continue;
 
         Rectf rect = solids->get_tile_bbox(x, y);
-        if (tile.is_slope ()) { // slope tile
-          AATriangle triangle = AATriangle(rect, tile.get_data());
+        if (tile.attributes & Tile::SLOPE) { // slope tile
+          AATriangle triangle = AATriangle(rect, tile.data);
 
           if (rectangle_aatriangle(&constraints, dest, triangle)) {
-            if (tile.get_attributes() & Tile::WATER)
+            if (tile.attributes & Tile::WATER)
               water = true;
           }
         } else { // normal rectangular tile
           if (dest.overlaps(rect)) {
-            if (tile.get_attributes() & Tile::WATER)
+            if (tile.attributes & Tile::WATER)
               water = true;
             set_rectangle_rectangle_constraints(&constraints, dest, rect);
           }
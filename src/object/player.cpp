@@ -69,6 +69,67 @@ const std::vector<std::string> IDLE_STAGES
   "idle"
 });
 
+/** A sprite action of Tux, interned with the prefix of each bonus,
+    e.g. "big-walk" */
+class BonusActionId final
+{
+public:
+  explicit BonusActionId(const std::string& name) :
+    m_ids({{ ActionId("small-" + name), ActionId("big-" + name), ActionId("fire-" + name),
+             ActionId("ice-" + name), ActionId("air-" + name), ActionId("earth-" + name) }})
+  {}
+
+  const ActionId& get(BonusType bonus) const
+  {
+    return (bonus >= 0 && static_cast<size_t>(bonus) < m_ids.size()) ? m_ids[bonus] : m_ids[NO_BONUS];
+  }
+
+private:
+  std::array<ActionId, EARTH_BONUS + 1> m_ids;
+};
+
+const ActionId ACTION_GAMEOVER("gameover");
+const ActionId ACTION_EARTH_STONE("earth-stone");
+const ActionId ACTION_GROW("grow");
+const ActionId ACTION_SWIMGROW("swimgrow");
+const ActionId ACTION_SLIDEGROW("slidegrow");
+const ActionId ACTION_CLIMBGROW("climbgrow");
+
+const BonusActionId ACTION_CLIMB("climb");
+const BonusActionId ACTION_BACKFLIP("backflip");
+const BonusActionId ACTION_SLIDEJUMP("slidejump");
+const BonusActionId ACTION_SLIDE("slide");
+const BonusActionId ACTION_DUCK("duck");
+const BonusActionId ACTION_CRAWL("crawl");
+const BonusActionId ACTION_SKID("skid");
+const BonusActionId ACTION_KICK("kick");
+const BonusActionId ACTION_STOMP("stomp");
+const BonusActionId ACTION_BUTTJUMP("buttjump");
+const BonusActionId ACTION_WALLJUMP("walljump");
+const BonusActionId ACTION_FLOAT("float");
+const BonusActionId ACTION_SWIMJUMP("swimjump");
+const BonusActionId ACTION_BOOST("boost");
+const BonusActionId ACTION_SWIM("swim");
+const BonusActionId ACTION_FALL("fall");
+const BonusActionId ACTION_JUMP("jump");
+const BonusActionId ACTION_RUN("run");
+const BonusActionId ACTION_WALK("walk");
+
+/** actions of the idle stages */
+const std::vector<BonusActionId> IDLE_ACTIONS
+({
+  BonusActionId(IDLE_STAGES[0]),
+  BonusActionId(IDLE_STAGES[1]),
+  BonusActionId(IDLE_STAGES[2])
+});
+/** parts of action names, identifying actions of the idle stages */
+const std::vector<std::string> IDLE_ACTION_PATTERNS
+({
+  "-" + IDLE_STAGES[0] + "-",
+  "-" + IDLE_STAGES[1] + "-",
+  "-" + IDLE_STAGES[2] + "-"
+});
+
 /** acceleration in horizontal direction when walking
  * (all accelerations are in  pixel/s^2) */
 const float WALK_ACCELERATION_X = 300;
@@ -1913,13 +1974,13 @@ Player::set_bonus(BonusType type, bool animate, bool increment_powerup_counter)
     if (animate) {
       m_growing = true;
       if (m_climbing)
-        m_sprite->set_action("climbgrow", m_dir, 1);
+        m_sprite->set_action(ACTION_CLIMBGROW, m_dir, 1);
       else if (m_swimming)
-        m_sprite->set_action("swimgrow", m_dir, 1);
+        m_sprite->set_action(ACTION_SWIMGROW, m_dir, 1);
       else if (m_sliding)
-        m_sprite->set_action("slidegrow", m_dir, 1);
+        m_sprite->set_action(ACTION_SLIDEGROW, m_dir, 1);
       else
-        m_sprite->set_action("grow", m_dir , 1);
+        m_sprite->set_action(ACTION_GROW, m_dir, 1);
     }
   }
 
@@ -2022,73 +2083,60 @@ Player::draw(DrawingContext& context)
     context.color().draw_surface(m_airarrow, Vector(px, py), LAYER_HUD - 1);
   }
 
-  std::string sa_prefix = "";
-  std::string sa_postfix = "";
-
-  if (get_bonus() == GROWUP_BONUS)
-    sa_prefix = "big";
-  else if (get_bonus() == FIRE_BONUS)
-    sa_prefix = "fire";
-  else if (get_bonus() == ICE_BONUS)
-    sa_prefix = "ice";
-  else if (get_bonus() == AIR_BONUS)
-    sa_prefix = "air";
-  else if (get_bonus() == EARTH_BONUS)
-    sa_prefix = "earth";
-  else
-    sa_prefix = "small";
+  const BonusType bonus = get_bonus();
+  Direction action_dir;
   if (!m_swimming && !m_water_jump)
   {
-    sa_postfix = (m_dir == Direction::RIGHT) ? "-right" : "-left";
+    action_dir = (m_dir == Direction::RIGHT) ? Direction::RIGHT : Direction::LEFT;
   }
   else
   {
-    sa_postfix = ((std::abs(m_swimming_angle) <= math::PI_2)
+    action_dir = ((std::abs(m_swimming_angle) <= math::PI_2)
       || (m_water_jump && std::abs(m_physic.get_velocity_x()) < 10.f))
-      ? "-right" : "-left";
+      ? Direction::RIGHT : Direction::LEFT;
   }
 
   /* Set Tux sprite action */
   if (m_dying) {
     m_sprite->set_angle(0.0f);
-    m_sprite->set_action("gameover");
+    m_sprite->set_action(ACTION_GAMEOVER);
   }
   else if (m_growing)
   {
     // while growing, do not change action
     // do_duck() will take care of cancelling growing manually
     // update() will take care of cancelling when growing completed
-    std::string action = "grow";
+    const ActionId* action = &ACTION_GROW;
     if (m_swimming || m_water_jump) {
-      action = "swimgrow";
+      action = &ACTION_SWIMGROW;
     }
     else if (m_sliding) {
-      action = "slidegrow";
+      action = &ACTION_SLIDEGROW;
     }
     else if (m_climbing) {
-      action = "climbgrow";
+      action = &ACTION_CLIMBGROW;
     }
-    m_sprite->set_action(action + sa_postfix, Sprite::LOOPS_CONTINUED);
+    m_sprite->set_action(*action, action_dir, Sprite::LOOPS_CONTINUED);
   }
   else if (m_stone) {
-    m_sprite->set_action("earth-stone");
+    m_sprite->set_action(ACTION_EARTH_STONE);
   }
   else if (m_climbing) {
-    m_sprite->set_action(sa_prefix+"-climb"+sa_postfix);
+    m_sprite->set_action(ACTION_CLIMB.get(bonus), action_dir);
 
     // Avoid flickering briefly after growing on ladder
     if ((m_physic.get_velocity_x()==0)&&(m_physic.get_velocity_y()==0))
       m_sprite->pause_animation();
   }
   else if (m_backflipping) {
-    m_sprite->set_action(sa_prefix+"-backflip"+sa_postfix);
+    m_sprite->set_action(ACTION_BACKFLIP.get(bonus), action_dir);
   }
   else if (m_sliding) {
     if (m_jumping || m_is_slidejump_falling) {
-      m_sprite->set_action(sa_prefix +"-slidejump"+ sa_postfix);
+      m_sprite->set_action(ACTION_SLIDEJUMP.get(bonus), action_dir);
     }
     else {
-      m_sprite->set_action(sa_prefix + "-slide" + sa_postfix);
+      m_sprite->set_action(ACTION_SLIDE.get(bonus), action_dir);
       if (m_was_crawling_before_slide)
       {
         m_sprite->set_frame(m_sprite->get_frames()); // Skip the "duck" animation when coming from crawling
@@ -2097,13 +2145,13 @@ Player::draw(DrawingContext& context)
     }
   }
   else if (m_duck && is_big() && !m_swimming && !m_crawl) {
-    m_sprite->set_action(sa_prefix+"-duck"+sa_postfix);
+    m_sprite->set_action(ACTION_DUCK.get(bonus), action_dir);
   }
   else if (m_crawl)
   {
     if (on_ground())
     {
-      m_sprite->set_action(sa_prefix + "-crawl" + sa_postfix);
+      m_sprite->set_action(ACTION_CRAWL.get(bonus), action_dir);
       if (m_physic.get_velocity_x() != 0.f) {
         m_sprite->resume_animation();
       }
@@ -2112,26 +2160,26 @@ Player::draw(DrawingContext& context)
       }
     }
     else {
-      m_sprite->set_action(sa_prefix + "-slidejump" + sa_postfix);
+      m_sprite->set_action(ACTION_SLIDEJUMP.get(bonus), action_dir);
     }
   }
   else if (m_skidding_timer.started() && !m_skidding_timer.check() && !m_swimming) {
-    m_sprite->set_action(sa_prefix + "-skid" + sa_postfix);
+    m_sprite->set_action(ACTION_SKID.get(bonus), action_dir);
   }
   else if (m_kick_timer.started() && !m_kick_timer.check() && !m_swimming && !m_water_jump) {
-    m_sprite->set_action(sa_prefix+"-kick"+sa_postfix);
+    m_sprite->set_action(ACTION_KICK.get(bonus), action_dir);
   }
   else if ((m_wants_buttjump || m_does_buttjump) && is_big() && !m_water_jump) {
     if (m_buttjump_stomp) {
-      m_sprite->set_action(sa_prefix + "-stomp" + sa_postfix, 1);
+      m_sprite->set_action(ACTION_STOMP.get(bonus), action_dir, 1);
     }
     else {
-      m_sprite->set_action(sa_prefix + "-buttjump" + sa_postfix, 1);
+      m_sprite->set_action(ACTION_BUTTJUMP.get(bonus), action_dir, 1);
     }
   }
   else if ((m_controller->hold(Control::LEFT) || m_controller->hold(Control::RIGHT)) && m_can_walljump)
   {
-    m_sprite->set_action(sa_prefix+"-walljump"+(m_on_left_wall ? "-left" : "-right"), 1);
+    m_sprite->set_action(ACTION_WALLJUMP.get(bonus), m_on_left_wall ? Direction::LEFT : Direction::RIGHT, 1);
   }
   else if (!on_ground() || m_fall_mode != ON_GROUND)
   {
@@ -2142,60 +2190,60 @@ Player::draw(DrawingContext& context)
         if (m_water_jump && m_dir != m_old_dir)
           log_debug << "Obracanko (:" << std::endl;
         if (glm::length(m_physic.get_velocity()) < 50.f)
-          m_sprite->set_action(sa_prefix + "-float" + sa_postfix);
+          m_sprite->set_action(ACTION_FLOAT.get(bonus), action_dir);
         else if (m_water_jump)
-          m_sprite->set_action(sa_prefix + "-swimjump" + sa_postfix);
+          m_sprite->set_action(ACTION_SWIMJUMP.get(bonus), action_dir);
         else if (m_swimboosting)
-          m_sprite->set_action(sa_prefix + "-boost" + sa_postfix);
+          m_sprite->set_action(ACTION_BOOST.get(bonus), action_dir);
         else
-          m_sprite->set_action(sa_prefix + "-swim" + sa_postfix);
+          m_sprite->set_action(ACTION_SWIM.get(bonus), action_dir);
       }
       else
       {
         if (m_physic.get_velocity_y() > 0)
-          m_sprite->set_action(sa_prefix + "-fall" + sa_postfix);
+          m_sprite->set_action(ACTION_FALL.get(bonus), action_dir);
         else if (m_physic.get_velocity_y() <= 0)
-          m_sprite->set_action(sa_prefix + "-jump" + sa_postfix);
+          m_sprite->set_action(ACTION_JUMP.get(bonus), action_dir);
       }
     }
   }
   else
   {
     if (fabsf(m_physic.get_velocity_x()) < 1.0f) {
-      if (std::all_of(IDLE_STAGES.begin(), IDLE_STAGES.end(),
-            [this](const std::string& stage) { return m_sprite->get_action().find("-" + stage + "-") == std::string::npos; }))
+      if (std::all_of(IDLE_ACTION_PATTERNS.begin(), IDLE_ACTION_PATTERNS.end(),
+            [this](const std::string& pattern) { return m_sprite->get_action().find(pattern) == std::string::npos; }))
       {
         m_idle_stage = 0;
         m_idle_timer.start(static_cast<float>(TIME_UNTIL_IDLE) / 1000.0f);
 
-        m_sprite->set_action(sa_prefix+("-" + IDLE_STAGES[m_idle_stage])+sa_postfix, Sprite::LOOPS_CONTINUED);
+        m_sprite->set_action(IDLE_ACTIONS[m_idle_stage].get(bonus), action_dir, Sprite::LOOPS_CONTINUED);
       }
       else if (m_idle_timer.check() || m_sprite->animation_done()) {
         m_idle_stage++;
         if (m_idle_stage >= static_cast<unsigned int>(IDLE_STAGES.size()))
         {
           m_idle_stage = static_cast<int>(IDLE_STAGES.size()) - 1;
-          m_sprite->set_action(sa_prefix+("-" + IDLE_STAGES[m_idle_stage])+sa_postfix);
+          m_sprite->set_action(IDLE_ACTIONS[m_idle_stage].get(bonus), action_dir);
           m_sprite->set_animation_loops(-1);
         }
         else
         {
-          m_sprite->set_action(sa_prefix+("-" + IDLE_STAGES[m_idle_stage])+sa_postfix, 1);
+          m_sprite->set_action(IDLE_ACTIONS[m_idle_stage].get(bonus), action_dir, 1);
         }
       }
       else {
-        m_sprite->set_action(sa_prefix+("-" + IDLE_STAGES[m_idle_stage])+sa_postfix, Sprite::LOOPS_CONTINUED);
+        m_sprite->set_action(IDLE_ACTIONS[m_idle_stage].get(bonus), action_dir, Sprite::LOOPS_CONTINUED);
       }
     }
     else
     {
       if (std::abs(m_physic.get_velocity_x()) >= MAX_RUN_XM-3)
       {
-        m_sprite->set_action(sa_prefix+"-run"+sa_postfix);
+        m_sprite->set_action(ACTION_RUN.get(bonus), action_dir);
       }
       else
       {
-        m_sprite->set_action(sa_prefix+"-walk"+sa_postfix);
+        m_sprite->set_action(ACTION_WALK.get(bonus), action_dir);
       }
     }
   }
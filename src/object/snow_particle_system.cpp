@@ -141,7 +141,7 @@ SnowParticleSystem::update(float dt_sec)
       // New wind strength.
       m_gust_onset = -m_wind_speed;
     }
-    m_timer.start(graphicsRandom.randf(m_state_length));
+    m_timer.start(m_random.randf(m_state_length));
   }
 
   // Update velocities.
@@ -177,12 +177,12 @@ SnowParticleSystem::update(float dt_sec)
     // Falling.
     particle->pos.y += particle->speed * dt_sec * sq_g;
     // Drifting (speed approaches wind at a rate dependent on flake size).
-    particle->drift_speed += (m_gust_current_velocity - particle->drift_speed) / static_cast<float>(particle->flake_size) + graphicsRandom.randf(-m_epsilon, m_epsilon);
+    particle->drift_speed += (m_gust_current_velocity - particle->drift_speed) / static_cast<float>(particle->flake_size) + m_random.randf(-m_epsilon, m_epsilon);
     particle->anchorx += particle->drift_speed * dt_sec;
     // Wobbling (particle approaches anchorx).
     particle->pos.x += particle->wobble * dt_sec * sq_g;
     anchor_delta = (particle->anchorx - particle->pos.x);
-    particle->wobble += (WOBBLE_FACTOR * anchor_delta) + graphicsRandom.randf(-m_epsilon, m_epsilon);
+    particle->wobble += (WOBBLE_FACTOR * anchor_delta) + m_random.randf(-m_epsilon, m_epsilon);
     particle->wobble *= WOBBLE_DECAY;
     // Spinning.
     particle->angle += particle->spin_speed * dt_sec;
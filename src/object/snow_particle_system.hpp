@@ -31,6 +31,7 @@ public:
   ~SnowParticleSystem() override;
 
   virtual void update(float dt_sec) override;
+  virtual int get_update_access() const override { return UPDATE_ACCESS_READ_SHARED; }
 
   static std::string class_name() { return "particles-snow"; }
   virtual std::string get_class_name() const override { return class_name(); }
@@ -45,6 +45,7 @@ TileMap::TileMap(const TileSet *new_tileset) :
   m_editor_active(true),
   m_tileset(new_tileset),
   m_tiles(),
+  m_collision_tiles(),
   m_real_solid(false),
   m_effective_solid(false),
   m_speed_x(1),
@@ -69,7 +70,10 @@ TileMap::TileMap(const TileSet *new_tileset) :
   m_new_offset_x(0),
   m_new_offset_y(0),
   m_add_path(false),
-  m_starting_node(0)
+  m_starting_node(0),
+  m_undo_settings(),
+  m_undo_tiles(),
+  m_undo_width(0)
 {
 }
 
@@ -79,6 +83,7 @@ TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
   m_editor_active(true),
   m_tileset(tileset_),
   m_tiles(),
+  m_collision_tiles(),
   m_real_solid(false),
   m_effective_solid(false),
   m_speed_x(1),
@@ -103,7 +108,10 @@ TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
   m_new_offset_x(0),
   m_new_offset_y(0),
   m_add_path(false),
-  m_starting_node(0)
+  m_starting_node(0),
+  m_undo_settings(),
+  m_undo_tiles(),
+  m_undo_width(0)
 {
   assert(m_tileset);
 
@@ -185,6 +193,7 @@ TileMap::TileMap(const TileSet *tileset_, const ReaderMapping& reader) :
 
     m_tileset->get(tile);
   }
+  update_collision_tiles();
 
   if (empty)
   {
@@ -331,15 +340,86 @@ TileMap::after_editor_set()
 void
 TileMap::save_state()
 {
-  GameObject::save_state();
   PathObject::save_state();
+
+  if (!get_parent())
+    return;
+
+  if (!get_parent()->undo_tracking_enabled())
+  {
+    m_undo_settings.clear();
+    m_undo_tiles.clear();
+    return;
+  }
+  if (!track_state())
+    return;
+
+  if (m_undo_settings.empty())
+  {
+    m_undo_settings = save_settings();
+    m_undo_tiles = m_tiles;
+    m_undo_width = m_width;
+  }
 }
 
 void
 TileMap::check_state()
 {
-  GameObject::check_state();
   PathObject::check_state();
+
+  // GameObject::check_state() isn't called, as the undo state is kept
+  // differently, but object listeners still have to know of the change.
+  GameObject::notify_changed();
+
+  if (!get_parent())
+    return;
+
+  if (!get_parent()->undo_tracking_enabled())
+  {
+    m_undo_settings.clear();
+    m_undo_tiles.clear();
+    return;
+  }
+  if (!track_state() || m_undo_settings.empty())
+    return;
+
+  if (save_settings() == m_undo_settings && m_undo_tiles.size() == m_tiles.size())
+  {
+    // Only tiles have changed, so only save the changed ones.
+    TileMapDelta delta(m_undo_tiles, m_tiles);
+    if (!delta.empty())
+      get_parent()->save_tile_change(*this, std::move(delta));
+  }
+  else
+  {
+    // Other settings have changed too (e.g. on resize), so save the complete previous state.
+    std::string data = std::move(m_undo_settings);
+    {
+      Writer writer(data);
+      writer.write("tiles", m_undo_tiles, m_undo_width);
+    }
+    get_parent()->save_object_change(*this, data);
+  }
+
+  m_undo_settings.clear();
+  m_undo_tiles.clear();
+  m_undo_tiles.shrink_to_fit();
+}
+
+std::string
+TileMap::save_settings()
+{
+  std::string data;
+  {
+    Writer writer(data);
+    auto settings = get_settings();
+    for (const auto& option : settings.get_options())
+    {
+      if (option->get_key() != "tiles")
+        option->save(writer);
+    }
+  }
+  return data;
 }
 
 void
@@ -546,6 +626,9 @@ TileMap::set(int newwidth, int newheight, const std::vector<unsigned int>&newt,
   // make sure all tiles are loaded
   for (const auto& tile : m_tiles)
     m_tileset->get(tile);
+
+  update_collision_tiles();
+  notify_tilemap_changed();
 }
 
 void
@@ -594,6 +677,9 @@ TileMap::resize(int new_width, int new_height, int fill_id,
     apply_offset_x(fill_id, xoffset);
   if (!offset_finished_y)
     apply_offset_y(fill_id, yoffset);
+
+  update_collision_tiles();
+  notify_tilemap_changed();
 }
 
 void TileMap::resize(const Size& newsize, const Size& resize_offset) {
@@ -664,6 +750,20 @@ TileMap::get_tile(int x, int y) const
   return m_tileset->get(id);
 }
 
+const TileMap::CollisionTile&
+TileMap::get_collision_tile(int x, int y) const
+{
+  static const CollisionTile empty = { 0, 0 };
+
+  // Same clamping as in get_tile_id().
+  x = std::max(0, std::min(x, m_width - 1));
+  y = std::max(0, std::min(y, m_height - 1));
+  if (m_collision_tiles.empty())
+    return empty;
+
+  return m_collision_tiles[y*m_width + x];
+}
+
 uint32_t
 TileMap::get_tile_id_at(const Vector& pos) const
 {
@@ -691,6 +791,31 @@ TileMap::change(int x, int y, uint32_t newtile)
     return;
 
   m_tiles[y*m_width + x] = newtile;
+  notify_tile_changed(x, y);
+}
+
+void
+TileMap::apply_delta(const TileMapDelta& delta)
+{
+  if (delta.get_size() != m_tiles.size())
+  {
+    log_warning << "Tile change doesn't match the size of tilemap '" << get_name() << "'." << std::endl;
+    return;
+  }
+
+  if (delta.get_tile_count() > m_tiles.size() / 4)
+  {
+    // Update everything at once, when a large part of the tilemap has changed.
+    delta.apply(m_tiles, {});
+    update_collision_tiles();
+    notify_tilemap_changed();
+  }
+  else
+  {
+    delta.apply(m_tiles, [this](size_t index) {
+        notify_tile_changed(static_cast<int>(index) % m_width, static_cast<int>(index) / m_width);
+      });
+  }
 }
 
 void
@@ -765,6 +890,7 @@ TileMap::autotile(int x, int y, uint32_t tile)
     x, y);
 
   m_tiles[y*m_width + x] = realtile;
+  notify_tile_changed(x, y);
 }
 
 void
@@ -816,6 +942,7 @@ TileMap::autotile_corner(int x, int y, uint32_t tile, AutotileCornerOperation op
     x, y);
 
   m_tiles[y*m_width + x] = realtile;
+  notify_tile_changed(x, y);
 }
 
 bool
@@ -852,6 +979,7 @@ TileMap::autotile_erase(const Vector& pos, const Vector& corner_pos)
   {
     int x = static_cast<int>(pos.x), y = static_cast<int>(pos.y);
     m_tiles[y*m_width + x] = 0;
+    notify_tile_changed(x, y);
 
     if (x - 1 >= 0 && y - 1 >= 0 && !is_corner(m_tiles[(y-1)*m_width + x-1])) {
       if (m_tiles[y*m_width + x] == 0)
@@ -953,6 +1081,18 @@ TileMap::move_by(const Vector& shift)
   }
   get_path()->move_by(shift);
   m_offset += shift;
+  notify_tilemap_changed();
+}
+
+void
+TileMap::set_offset(const Vector &offset_)
+{
+  m_offset = offset_;
+
+  // Tilemaps following a path aren't merged into the solid tile bitmap,
+  // so don't rebuild it on every movement.
+  if (!get_walker())
+    notify_tilemap_changed();
 }
 
 void
@@ -973,6 +1113,42 @@ void
 TileMap::set_tileset(const TileSet* new_tileset)
 {
   m_tileset = new_tileset;
+  update_collision_tiles();
+  notify_tilemap_changed();
+}
+
+TileMap::CollisionTile
+TileMap::make_collision_tile(uint32_t id) const
+{
+  static_assert(Tile::WALLJUMP <= 0xFFFF, "Tile attributes must fit into CollisionTile");
+
+  const Tile& tile = m_tileset->get(id);
+  return { static_cast<uint16_t>(tile.get_attributes()),
+           static_cast<uint16_t>(tile.is_slope() ? tile.get_data() : 0) };
+}
+
+void
+TileMap::update_collision_tiles()
+{
+  m_collision_tiles.resize(m_tiles.size());
+  for (size_t i = 0; i < m_tiles.size(); ++i)
+    m_collision_tiles[i] = make_collision_tile(m_tiles[i]);
+}
+
+void
+TileMap::notify_tilemap_changed()
+{
+  if (get_parent())
+    get_parent()->on_tilemap_changed(*this);
+}
+
+void
+TileMap::notify_tile_changed(int x, int y)
+{
+  m_collision_tiles[y*m_width + x] = make_collision_tile(m_tiles[y*m_width + x]);
+
+  if (get_parent())
+    get_parent()->on_tilemap_tile_changed(*this, x, y);
 }
 
 
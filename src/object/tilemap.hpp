@@ -25,6 +25,7 @@
 #include "math/size.hpp"
 #include "object/path_object.hpp"
 #include "object/path_walker.hpp"
+#include "object/tilemap_delta.hpp"
 #include "supertux/autotile.hpp"
 #include "supertux/game_object.hpp"
 #include "video/color.hpp"
@@ -52,6 +53,16 @@ class TileMap final : public GameObject,
 public:
   static void register_class(ssq::VM& vm);
 
+public:
+  /** Attributes and slope data of a tile, cached for collision detection,
+      so it doesn't have to go through the TileSet for every tile. */
+  struct CollisionTile
+  {
+    uint16_t attributes;
+    /** Slope data, only set for tiles with the SLOPE attribute */
+    uint16_t data;
+  };
+
 public:
   TileMap(const TileSet *tileset);
   TileMap(const TileSet *tileset, const ReaderMapping& reader);
@@ -93,7 +104,7 @@ public:
   int get_height() const { return m_height; }
   Size get_size() const { return Size(m_width, m_height); }
 
-  void set_offset(const Vector &offset_) { m_offset = offset_; }
+  void set_offset(const Vector &offset_);
   Vector get_offset() const { return m_offset; }
 
   void set_ground_movement_manager(const std::shared_ptr<CollisionGroundMovementManager>& movement_manager)
@@ -156,6 +167,10 @@ public:
   bool is_outside_bounds(const Vector& pos) const;
   const Tile& get_tile(int x, int y) const;
   const Tile& get_tile_at(const Vector& pos) const;
+
+  /** Returns the cached collision data of a tile. Like with get_tile(),
+      positions outside of the tilemap are clamped to its edges. */
+  const CollisionTile& get_collision_tile(int x, int y) const;
   /**
    * @scripting
    * @description Returns the ID of the tile at the given coordinates or 0 if out of bounds.
@@ -267,11 +282,27 @@ public:
   float get_target_alpha() const { return m_alpha; }
 
   void set_tileset(const TileSet* new_tileset);
+  const TileSet* get_tileset() const { return m_tileset; }
 
   const std::vector<uint32_t>& get_tiles() const { return m_tiles; }
 
+  /** Applies a change to multiple tiles at once, e.g. one recorded for undo/redo. */
+  void apply_delta(const TileMapDelta& delta);
+
 private:
+  /** Saves all settings, except the tiles. */
+  std::string save_settings();
+
   void update_effective_solid(bool update_manager = true);
+
+  CollisionTile make_collision_tile(uint32_t id) const;
+  void update_collision_tiles();
+
+  /** Notify the parent GameObjectManager about changed tiles. */
+  void notify_tilemap_changed();
+
+  /** Update the collision data of a changed tile and notify the parent. */
+  void notify_tile_changed(int x, int y);
   void float_channel(float target, float &current, float remaining_time, float dt_sec);
 
   bool is_corner(uint32_t tile) const;
@@ -288,6 +319,9 @@ private:
   typedef std::vector<uint32_t> Tiles;
   Tiles m_tiles;
 
+  /** Collision data of all tiles, in the same layout as m_tiles */
+  std::vector<CollisionTile> m_collision_tiles;
+
   /* read solid: In *general*, is this a solid layer? effective solid:
      is the layer *currently* solid? A generally solid layer may be
      not solid when its alpha is low. See `is_solid' above. */
@@ -330,6 +364,12 @@ private:
 
   int m_starting_node;
 
+  /** State before a change, saved by save_state(). Changes of only the
+      tiles are saved as a delta, instead of the complete object. */
+  std::string m_undo_settings;
+  Tiles m_undo_tiles;
+  int m_undo_width;
+
 private:
   TileMap(const TileMap&) = delete;
   TileMap& operator=(const TileMap&) = delete;
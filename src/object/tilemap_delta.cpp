@@ -0,0 +1,88 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "object/tilemap_delta.hpp"
+
+#include <assert.h>
+
+TileMapDelta::TileMapDelta() :
+  m_size(0),
+  m_runs(),
+  m_old_tiles(),
+  m_new_tiles()
+{
+}
+
+TileMapDelta::TileMapDelta(const std::vector<uint32_t>& old_tiles,
+                           const std::vector<uint32_t>& new_tiles) :
+  m_size(new_tiles.size()),
+  m_runs(),
+  m_old_tiles(),
+  m_new_tiles()
+{
+  assert(old_tiles.size() == new_tiles.size());
+
+  for (size_t i = 0; i < m_size; ++i)
+  {
+    if (old_tiles[i] == new_tiles[i])
+      continue;
+
+    if (!m_runs.empty() && m_runs.back().index + m_runs.back().count == i)
+      m_runs.back().count += 1;
+    else
+      m_runs.push_back({ static_cast<uint32_t>(i), 1 });
+
+    m_old_tiles.push_back(old_tiles[i]);
+    m_new_tiles.push_back(new_tiles[i]);
+  }
+
+  m_runs.shrink_to_fit();
+  m_old_tiles.shrink_to_fit();
+  m_new_tiles.shrink_to_fit();
+}
+
+size_t
+TileMapDelta::get_memory_usage() const
+{
+  return m_runs.capacity() * sizeof(Run) +
+         (m_old_tiles.capacity() + m_new_tiles.capacity()) * sizeof(uint32_t);
+}
+
+void
+TileMapDelta::apply(std::vector<uint32_t>& tiles, const std::function<void (size_t)>& on_change) const
+{
+  assert(tiles.size() == m_size);
+
+  size_t tile = 0;
+  for (const Run& run : m_runs)
+  {
+    for (size_t i = run.index; i < run.index + run.count; ++i, ++tile)
+    {
+      tiles[i] = m_new_tiles[tile];
+      if (on_change)
+        on_change(i);
+    }
+  }
+}
+
+void
+TileMapDelta::invert()
+{
+  m_old_tiles.swap(m_new_tiles);
+}
+
+/* EOF */
@@ -0,0 +1,75 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_OBJECT_TILEMAP_DELTA_HPP
+#define HEADER_SUPERTUX_OBJECT_TILEMAP_DELTA_HPP
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * A change to the tiles of a tilemap, stored as runs of consecutive
+   changed tiles with their old and new IDs. Used for undo/redo in the
+   editor, so the whole tiles array doesn't have to be saved for
+   every change.
+ */
+class TileMapDelta final
+{
+public:
+  TileMapDelta();
+  /** Records the tiles which differ between the arrays. Both arrays
+      must be of the same size. */
+  TileMapDelta(const std::vector<uint32_t>& old_tiles,
+               const std::vector<uint32_t>& new_tiles);
+
+  bool empty() const { return m_runs.empty(); }
+
+  /** Returns the amount of changed tiles. */
+  size_t get_tile_count() const { return m_old_tiles.size(); }
+
+  /** Returns the size of the tiles array the delta was recorded for. */
+  size_t get_size() const { return m_size; }
+
+  /** Returns the amount of memory allocated by the delta, in bytes. */
+  size_t get_memory_usage() const;
+
+  /** Sets the changed tiles to their new IDs, calling the function
+      with the index of each changed tile. */
+  void apply(std::vector<uint32_t>& tiles, const std::function<void (size_t)>& on_change) const;
+
+  /** Swaps the old and new IDs, so the next apply() reverts the change. */
+  void invert();
+
+private:
+  struct Run
+  {
+    uint32_t index;
+    uint32_t count;
+  };
+
+private:
+  size_t m_size;
+  std::vector<Run> m_runs;
+  std::vector<uint32_t> m_old_tiles;
+  std::vector<uint32_t> m_new_tiles;
+};
+
+#endif
+
+/* EOF */
@@ -38,7 +38,8 @@ protected:
 
 private:
   PHYSFS_File* file;
-  char buf[1024];
+  /** Large enough to read most files in a few calls to PhysFS */
+  char buf[16384];
 
 private:
   IFileStreambuf(const IFileStreambuf&) = delete;
@@ -0,0 +1,41 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_PHYSFS_IMAPPED_FILE_STREAM_HPP
+#define HEADER_SUPERTUX_PHYSFS_IMAPPED_FILE_STREAM_HPP
+
+#include <memory>
+#include <istream>
+
+/** An input stream over the whole content of a file, which is mapped
+    or read in one go. See MappedFile. */
+class IMappedFileStream final : public std::istream
+{
+protected:
+  std::unique_ptr<std::streambuf> sb;
+
+public:
+  IMappedFileStream(const std::string& filename);
+
+private:
+  IMappedFileStream(const IMappedFileStream&) = delete;
+  IMappedFileStream& operator=(const IMappedFileStream&) = delete;
+};
+
+#endif
+
+/* EOF */
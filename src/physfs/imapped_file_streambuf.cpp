@@ -0,0 +1,61 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "physfs/imapped_file_streambuf.hpp"
+
+#include <assert.h>
+
+IMappedFileStreambuf::IMappedFileStreambuf(const std::string& filename) :
+  m_file(filename)
+{
+  // The get area is never written to, as putback() is not supported.
+  char* data = const_cast<char*>(m_file.get_data());
+  setg(data, data, data + m_file.get_size());
+}
+
+IMappedFileStreambuf::pos_type
+IMappedFileStreambuf::seekpos(pos_type pos, std::ios_base::openmode)
+{
+  if (pos < 0 || static_cast<size_t>(pos) > m_file.get_size())
+    return pos_type(off_type(-1));
+
+  setg(eback(), eback() + static_cast<off_type>(pos), egptr());
+  return pos;
+}
+
+IMappedFileStreambuf::pos_type
+IMappedFileStreambuf::seekoff(off_type off, std::ios_base::seekdir dir,
+                              std::ios_base::openmode mode)
+{
+  switch (dir) {
+    case std::ios_base::beg:
+      break;
+    case std::ios_base::cur:
+      off += gptr() - eback();
+      break;
+    case std::ios_base::end:
+      off += egptr() - eback();
+      break;
+    default:
+      assert(false);
+      return pos_type(off_type(-1));
+  }
+
+  return seekpos(static_cast<pos_type>(off), mode);
+}
+
+/* EOF */
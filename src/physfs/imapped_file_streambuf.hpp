@@ -0,0 +1,48 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_PHYSFS_IMAPPED_FILE_STREAMBUF_HPP
+#define HEADER_SUPERTUX_PHYSFS_IMAPPED_FILE_STREAMBUF_HPP
+
+#include <streambuf>
+
+#include "physfs/mapped_file.hpp"
+
+/** A streambuf, which exposes the whole content of a MappedFile as its
+    get area. Unlike IFileStreambuf, it never needs to refill a buffer,
+    so reading doesn't go through any virtual calls or copies. */
+class IMappedFileStreambuf final : public std::streambuf
+{
+public:
+  IMappedFileStreambuf(const std::string& filename);
+
+protected:
+  virtual pos_type seekoff(off_type pos, std::ios_base::seekdir,
+                           std::ios_base::openmode) override;
+  virtual pos_type seekpos(pos_type pos, std::ios_base::openmode) override;
+
+private:
+  MappedFile m_file;
+
+private:
+  IMappedFileStreambuf(const IMappedFileStreambuf&) = delete;
+  IMappedFileStreambuf& operator=(const IMappedFileStreambuf&) = delete;
+};
+
+#endif
+
+/* EOF */
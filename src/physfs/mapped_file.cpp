@@ -0,0 +1,146 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "physfs/mapped_file.hpp"
+
+#include <physfs.h>
+#include <sstream>
+#include <stdexcept>
+
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+#  define SUPERTUX_HAVE_MMAP
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include "physfs/util.hpp"
+#include "util/file_system.hpp"
+#include "util/log.hpp"
+
+MappedFile::MappedFile(const std::string& filename) :
+  m_data(nullptr),
+  m_size(0),
+  m_mapping(nullptr),
+  m_buffer()
+{
+  if (!map(filename))
+  {
+#ifdef SUPERTUX_HAVE_MMAP
+    log_debug << "Couldn't map '" << filename << "', reading it instead." << std::endl;
+#endif
+    read(filename);
+  }
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef SUPERTUX_HAVE_MMAP
+  if (m_mapping)
+    munmap(m_mapping, m_size);
+#endif
+}
+
+bool
+MappedFile::map(const std::string& filename)
+{
+#ifdef SUPERTUX_HAVE_MMAP
+  // Only files in real directories can be mapped, not the ones in archives.
+  const char* dir = PHYSFS_getRealDir(filename.c_str());
+  if (!dir || !FileSystem::is_directory(dir))
+    return false;
+
+  // The real directory may be mounted below the root of the search path
+  // (e.g. "<datadir>/levels" at "levels/"), in which case the mount point
+  // isn't part of the path on disk.
+  std::string relative_path = filename;
+  while (!relative_path.empty() && relative_path.front() == '/')
+    relative_path.erase(0, 1);
+
+  if (const char* mount_point = PHYSFS_getMountPoint(dir))
+  {
+    std::string prefix = mount_point;
+    while (!prefix.empty() && prefix.front() == '/')
+      prefix.erase(0, 1);
+
+    if (!prefix.empty() && prefix.back() != '/')
+      prefix += '/';
+
+    if (relative_path.compare(0, prefix.size(), prefix) != 0)
+      return false;
+
+    relative_path.erase(0, prefix.size());
+  }
+
+  const std::string path = FileSystem::join(dir, relative_path);
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat info;
+  if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0)
+  {
+    close(fd);
+    return false;
+  }
+
+  void* mapping = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED)
+    return false;
+
+  m_mapping = mapping;
+  m_data = static_cast<const char*>(mapping);
+  m_size = static_cast<size_t>(info.st_size);
+  return true;
+#else
+  (void) filename;
+  return false;
+#endif
+}
+
+void
+MappedFile::read(const std::string& filename)
+{
+  PHYSFS_File* file = PHYSFS_openRead(filename.c_str());
+  if (!file)
+  {
+    std::ostringstream msg;
+    msg << "Couldn't open file '" << filename << "': " << physfsutil::get_last_error();
+    throw std::runtime_error(msg.str());
+  }
+
+  const PHYSFS_sint64 length = PHYSFS_fileLength(file);
+  if (length > 0)
+  {
+    m_buffer.resize(static_cast<size_t>(length));
+    if (PHYSFS_readBytes(file, m_buffer.data(), length) != length)
+    {
+      PHYSFS_close(file);
+      std::ostringstream msg;
+      msg << "Couldn't read file '" << filename << "': " << physfsutil::get_last_error();
+      throw std::runtime_error(msg.str());
+    }
+  }
+  PHYSFS_close(file);
+
+  m_data = m_buffer.data();
+  m_size = m_buffer.size();
+}
+
+/* EOF */
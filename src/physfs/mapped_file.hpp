@@ -0,0 +1,58 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_PHYSFS_MAPPED_FILE_HPP
+#define HEADER_SUPERTUX_PHYSFS_MAPPED_FILE_HPP
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+/** Provides read-only access to the whole content of a file in the
+    PhysFS search path. Files in a directory on disk are memory-mapped,
+    where supported, others (e.g. inside of archives) are read. */
+class MappedFile final
+{
+public:
+  /** Throws a std::runtime_error, if the file can't be opened. */
+  explicit MappedFile(const std::string& filename);
+  ~MappedFile();
+
+  const char* get_data() const { return m_data; }
+  size_t get_size() const { return m_size; }
+
+  /** Returns true, if the file is memory-mapped, instead of read. */
+  bool is_mapped() const { return m_mapping != nullptr; }
+
+private:
+  bool map(const std::string& filename);
+  void read(const std::string& filename);
+
+private:
+  const char* m_data;
+  size_t m_size;
+  void* m_mapping;
+  std::vector<char> m_buffer;
+
+private:
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+};
+
+#endif
+
+/* EOF */
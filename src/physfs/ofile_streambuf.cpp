@@ -52,7 +52,8 @@ OFileStreambuf::overflow(int c)
 
   size_t size = pptr() - pbase();
   PHYSFS_sint64 res = PHYSFS_writeBytes(file, pbase(), size);
-  if (res <= 0)
+  // A short write (e.g. on a full disk) is an error too.
+  if (res < static_cast<PHYSFS_sint64>(size))
     return traits_type::eof();
 
   if (c != traits_type::eof()) {
@@ -61,7 +62,7 @@ OFileStreambuf::overflow(int c)
       return traits_type::eof();
   }
 
-  setp(buf, buf + res);
+  setp(buf, buf + sizeof(buf));
   return 0;
 }
 
@@ -16,10 +16,13 @@
 
 #include "physfs/util.hpp"
 
+#include <filesystem>
 #include <physfs.h>
 
+#include "physfs/ofile_stream.hpp"
 #include "physfs/physfs_file_system.hpp"
 #include "util/file_system.hpp"
+#include "util/log.hpp"
 
 namespace physfsutil {
 
@@ -66,6 +69,57 @@ bool remove(const std::string& filename)
   return PHYSFS_delete(filename.c_str()) == 0;
 }
 
+bool rename(const std::string& oldname, const std::string& newname)
+{
+  // PhysFS can't rename files, so do it in the write directory directly.
+  const char* write_dir = PHYSFS_getWriteDir();
+  if (!write_dir)
+  {
+    log_warning << "No write directory set, couldn't move " << oldname << " to " << newname << std::endl;
+    return false;
+  }
+
+  std::error_code error;
+  std::filesystem::rename(FileSystem::join(write_dir, oldname),
+                          FileSystem::join(write_dir, newname), error);
+  if (error)
+  {
+    log_warning << "Couldn't move " << oldname << " to " << newname << ": " << error.message() << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool write_file_replacing(const std::string& filename, const std::string& temp_filename,
+                          const std::function<void (std::ostream&)>& write)
+{
+  bool written = false;
+  try
+  {
+    OFileStream out(temp_filename);
+    write(out);
+
+    // Write errors, e.g. on a full disk, are only reported through the stream state.
+    out.flush();
+    written = !out.fail();
+    if (!written)
+    {
+      log_warning << "Couldn't write " << temp_filename << ": " << get_last_error() << std::endl;
+    }
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't write " << temp_filename << ": " << err.what() << std::endl;
+  }
+
+  if (!written || !rename(temp_filename, filename))
+  {
+    PHYSFS_delete(temp_filename.c_str());
+    return false;
+  }
+  return true;
+}
+
 #define PHYSFS_UTIL_DIRECTORY_GUARD \
   if (!is_directory(dir) || !PHYSFS_exists(dir.c_str())) return
 
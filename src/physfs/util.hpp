@@ -18,6 +18,7 @@
 #define HEADER_SUPERTUX_PHYSFS_UTIL_HPP
 
 #include <functional>
+#include <ostream>
 #include <string>
 
 namespace physfsutil {
@@ -35,6 +36,17 @@ bool is_directory(const std::string& path);
 
 bool remove(const std::string& filename);
 
+/** Renames a file in the write directory, replacing the target file
+    atomically. Returns false, with the reason logged, on failure. */
+bool rename(const std::string& oldname, const std::string& newname);
+
+/** Writes a file in the write directory through a temporary file, which
+    is only moved over the target file, once it has been written without
+    errors. On failure, the target file is left untouched, the temporary
+    file is removed and the reason is logged. Returns true on success. */
+bool write_file_replacing(const std::string& filename, const std::string& temp_filename,
+                          const std::function<void (std::ostream&)>& write);
+
 /** Removes the content of a directory */
 void remove_content(const std::string& dir);
 
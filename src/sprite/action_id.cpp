@@ -0,0 +1,99 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "sprite/action_id.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct ActionName
+{
+  std::string name;
+  ActionId::Format format;
+};
+
+/** Interned names, kept in a function so IDs created during static
+    initialization of other translation units can use it. */
+struct ActionRegistry
+{
+  std::mutex mutex;
+  std::vector<ActionName> names;
+  std::unordered_map<std::string, uint32_t> indices;
+};
+
+ActionRegistry& get_registry()
+{
+  static ActionRegistry registry;
+  return registry;
+}
+
+} // namespace
+
+ActionId::ActionId(const std::string& name, Format format) :
+  m_index(INVALID_INDEX)
+{
+  ActionRegistry& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  const std::string key = std::to_string(static_cast<int>(format)) + ":" + name;
+  auto it = registry.indices.find(key);
+  if (it != registry.indices.end())
+  {
+    m_index = it->second;
+    return;
+  }
+
+  m_index = static_cast<uint32_t>(registry.names.size());
+  registry.names.push_back({ name, format });
+  registry.indices[key] = m_index;
+}
+
+std::string
+ActionId::get_name(Direction dir) const
+{
+  if (!is_valid())
+    return std::string();
+
+  ActionName action;
+  {
+    ActionRegistry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    action = registry.names[m_index];
+  }
+
+  // Same composition as the Sprite::set_action() overloads taking strings.
+  if (action.name.empty())
+    return dir_to_string(dir);
+  if (dir == Direction::NONE)
+    return action.name;
+
+  if (action.format == Format::DIRECTION_NAME)
+    return dir_to_string(dir) + "-" + action.name;
+  return action.name + "-" + dir_to_string(dir);
+}
+
+size_t
+ActionId::get_count()
+{
+  ActionRegistry& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.names.size();
+}
+
+/* EOF */
@@ -0,0 +1,72 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SPRITE_ACTION_ID_HPP
+#define HEADER_SUPERTUX_SPRITE_ACTION_ID_HPP
+
+#include <stdint.h>
+#include <string>
+
+#include "supertux/direction.hpp"
+
+/**
+ * An interned sprite action name, which, combined with a direction,
+   refers to an action of any sprite.
+
+   Sprites resolve IDs into their actions once and keep the result in a
+   table, so setting actions by ID doesn't need to compose or look up
+   any strings. IDs are meant to be created once, e.g. as constants.
+ */
+class ActionId final
+{
+public:
+  /** How the action name is combined with a direction */
+  enum class Format
+  {
+    NAME_DIRECTION, /**< "name-direction", e.g. "walk-left" */
+    DIRECTION_NAME /**< "direction-name", e.g. "left-up" */
+  };
+
+  static const uint32_t INVALID_INDEX = UINT32_MAX;
+
+public:
+  ActionId() : m_index(INVALID_INDEX) {}
+
+  /** Interns the given action name. An empty name refers to the
+      actions named after the direction only, e.g. "left". */
+  explicit ActionId(const std::string& name, Format format = Format::NAME_DIRECTION);
+
+  bool is_valid() const { return m_index != INVALID_INDEX; }
+  uint32_t get_index() const { return m_index; }
+
+  /** Returns the full name of the action for the given direction.
+      Direction::NONE leaves out the direction, except for actions
+      named after the direction only. */
+  std::string get_name(Direction dir = Direction::NONE) const;
+
+  bool operator==(const ActionId& other) const { return m_index == other.m_index; }
+  bool operator!=(const ActionId& other) const { return m_index != other.m_index; }
+
+  /** Returns the amount of interned action names. */
+  static size_t get_count();
+
+private:
+  uint32_t m_index;
+};
+
+#endif
+
+/* EOF */
@@ -102,6 +102,33 @@ Sprite::set_action(const std::string& name, int loops)
     return;
   }
 
+  set_action(newaction, loops);
+}
+
+void
+Sprite::set_action(const ActionId& action, int loops)
+{
+  set_action(action, Direction::NONE, loops);
+}
+
+void
+Sprite::set_action(const ActionId& action, const Direction& dir, int loops)
+{
+  const SpriteData::Action* newaction = m_data.get_action(action, dir);
+  if (!newaction) {
+    log_warning << "Action '" << action.get_name(dir) << "' not found." << std::endl;
+    return;
+  }
+
+  if (m_action == newaction)
+    return;
+
+  set_action(newaction, loops);
+}
+
+void
+Sprite::set_action(const SpriteData::Action* newaction, int loops)
+{
   // Automatically resume if a new action is set
   m_is_paused = false;
 
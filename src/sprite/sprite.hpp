@@ -60,6 +60,14 @@ public:
    */
   void set_action(const Direction& dir, int loops = -1);
 
+  /** Set action (or state) by ID, without any string operations */
+  void set_action(const ActionId& action, int loops = -1);
+
+  /** Set action (or state) by ID, combined with a particular direction,
+   * as specified by the ID's format, e.g. "walk-left"
+   */
+  void set_action(const ActionId& action, const Direction& dir, int loops = -1);
+
   /** Set number of animation cycles until animation stops */
   void set_animation_loops(int loops = -1) { m_animation_loops = loops; }
 
@@ -125,10 +133,12 @@ public:
   Blend get_blend() const;
 
   bool has_action (const std::string& name) const { return (m_data.get_action(name) != nullptr); }
+  bool has_action(const ActionId& action, const Direction& dir = Direction::NONE) const { return (m_data.get_action(action, dir) != nullptr); }
   size_t get_actions_count() const { return m_data.actions.size(); }
 
 private:
   void update();
+  void set_action(const SpriteData::Action* action, int loops);
 
   SpriteData& m_data;
 
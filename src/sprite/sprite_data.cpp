@@ -50,7 +50,8 @@ SpriteData::Action::Action() :
 
 SpriteData::SpriteData(const ReaderMapping& mapping) :
   actions(),
-  name()
+  name(),
+  action_ids()
 {
   auto iter = mapping.get_iter();
   while (iter.next())
@@ -69,7 +70,8 @@ SpriteData::SpriteData(const ReaderMapping& mapping) :
 
 SpriteData::SpriteData(const std::string& image) :
   actions(),
-  name()
+  name(),
+  action_ids()
 {
   auto surface = Surface::from_file(image);
   if (!TextureManager::current()->last_load_successful())
@@ -82,7 +84,8 @@ SpriteData::SpriteData(const std::string& image) :
 
 SpriteData::SpriteData() :
   actions(),
-  name()
+  name(),
+  action_ids()
 {
   auto surface = Surface::from_texture(TextureManager::current()->create_dummy_texture());
   auto action = create_action_from_surface(surface);
@@ -389,4 +392,25 @@ SpriteData::get_action(const std::string& act) const
   return i->second.get();
 }
 
+const SpriteData::Action*
+SpriteData::get_action(const ActionId& id, Direction dir) const
+{
+  if (!id.is_valid())
+    return nullptr;
+
+  const size_t index = id.get_index();
+  if (index >= action_ids.size())
+    action_ids.resize(index + 1);
+
+  ResolvedActionId& resolved = action_ids[index];
+  if (!resolved.resolved)
+  {
+    for (size_t i = 0; i < resolved.actions.size(); ++i)
+      resolved.actions[i] = get_action(id.get_name(static_cast<Direction>(i)));
+    resolved.resolved = true;
+  }
+
+  return resolved.actions[static_cast<size_t>(dir)];
+}
+
 /* EOF */
@@ -17,10 +17,13 @@
 #ifndef HEADER_SUPERTUX_SPRITE_SPRITE_DATA_HPP
 #define HEADER_SUPERTUX_SPRITE_SPRITE_DATA_HPP
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "sprite/action_id.hpp"
+#include "supertux/direction.hpp"
 #include "video/surface_ptr.hpp"
 
 class ReaderMapping;
@@ -89,15 +92,26 @@ private:
 
   typedef std::map<std::string, std::unique_ptr<Action> > Actions;
 
+  /** The actions an ActionId refers to, indexed by direction */
+  struct ResolvedActionId
+  {
+    bool resolved = false;
+    std::array<const Action*, static_cast<size_t>(Direction::DOWN) + 1> actions = {};
+  };
+
   static std::unique_ptr<Action> create_action_from_surface(SurfacePtr surface);
 
   void parse_action(const ReaderMapping& mapping);
   /** Get an action */
   const Action* get_action(const std::string& act) const;
+  /** Get an action by ID, resolving the ID on first use */
+  const Action* get_action(const ActionId& id, Direction dir) const;
 
 private:
   Actions actions;
   std::string name;
+
+  mutable std::vector<ResolvedActionId> action_ids;
 };
 
 #endif
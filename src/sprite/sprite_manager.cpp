@@ -106,4 +106,41 @@ SpriteManager::load(const std::string& filename)
   return m_sprites[filename].get();
 }
 
+void
+SpriteManager::get_images(const std::string& filename, std::vector<std::string>& images)
+{
+  const auto doc = ReaderDocument::from_file(filename);
+  const auto root = doc.get_root();
+  if (root.get_name() != "supertux-sprite")
+    return;
+
+  auto iter = root.get_mapping().get_iter();
+  while (iter.next())
+  {
+    if (iter.get_key() != "action")
+      continue;
+
+    const auto mapping = iter.as_mapping();
+
+    std::vector<std::string> action_images;
+    if (mapping.get("images", action_images))
+    {
+      for (const auto& image : action_images)
+        images.push_back(FileSystem::join(doc.get_directory(), image));
+    }
+
+    std::optional<ReaderMapping> regions;
+    if (mapping.get("regions", regions))
+    {
+      auto regions_iter = regions->get_iter();
+      while (regions_iter.next())
+      {
+        const auto& arr = regions_iter.as_mapping().get_sexp().as_array();
+        if (arr.size() == 6 && arr[1].is_string())
+          images.push_back(FileSystem::join(doc.get_directory(), arr[1].as_string()));
+      }
+    }
+  }
+}
+
 /* EOF */
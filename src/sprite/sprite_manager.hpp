@@ -23,6 +23,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "sprite/sprite_ptr.hpp"
 
@@ -46,6 +47,10 @@ public:
   /** loads a sprite. */
   SpritePtr create(const std::string& filename);
 
+  /** Collects the images used by the actions of a sprite file.
+      Only reads the file, so it can be called from any thread. */
+  static void get_images(const std::string& filename, std::vector<std::string>& images);
+
 private:
   SpriteData* load(const std::string& filename);
 
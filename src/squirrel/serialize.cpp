@@ -115,4 +115,76 @@ void save_squirrel_table(const ssq::Table& table, Writer& writer)
   }
 }
 
+sexp::Value snapshot_squirrel_table(const ssq::Table& table)
+{
+  std::vector<sexp::Value> entries;
+  for (const auto& [key, value] : table.convertRaw())
+  {
+    sexp::Value entry;
+    switch (value.getType())
+    {
+      case ssq::Type::INTEGER:
+        entry = sexp::Value::integer(value.to<int>());
+        break;
+      case ssq::Type::FLOAT:
+        entry = sexp::Value::real(value.toFloat());
+        break;
+      case ssq::Type::BOOL:
+        entry = sexp::Value::boolean(value.toBool());
+        break;
+      case ssq::Type::STRING:
+        entry = sexp::Value::string(value.toString());
+        break;
+      case ssq::Type::TABLE:
+        entry = snapshot_squirrel_table(value.toTable());
+        break;
+
+      case ssq::Type::CLOSURE:
+      case ssq::Type::NATIVECLOSURE:
+        continue; // Ignore
+
+      default:
+        log_warning << "Can't serialize key '" << key << "' in Squirrel table." << std::endl;
+        continue;
+    }
+
+    entries.push_back(sexp::Value::array({ sexp::Value::string(key), std::move(entry) }));
+  }
+
+  return sexp::Value::array(std::move(entries));
+}
+
+void write_squirrel_snapshot(const sexp::Value& snapshot, Writer& writer)
+{
+  for (const auto& pair : snapshot.as_array())
+  {
+    const std::string& key = pair.as_array()[0].as_string();
+    const auto& value = pair.as_array()[1];
+
+    switch (value.get_type())
+    {
+      case sexp::Value::Type::INTEGER:
+        writer.write(key, value.as_int());
+        break;
+      case sexp::Value::Type::REAL:
+        writer.write(key, value.as_float());
+        break;
+      case sexp::Value::Type::BOOLEAN:
+        writer.write(key, value.as_bool());
+        break;
+      case sexp::Value::Type::STRING:
+        writer.write(key, value.as_string());
+        break;
+      case sexp::Value::Type::ARRAY:
+        writer.start_list(key, true);
+        write_squirrel_snapshot(value, writer);
+        writer.end_list(key);
+        break;
+      default:
+        assert(false);
+        break;
+    }
+  }
+}
+
 /* EOF */
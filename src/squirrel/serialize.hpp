@@ -20,6 +20,10 @@
 class ReaderMapping;
 class Writer;
 
+namespace sexp {
+class Value;
+} // namespace sexp
+
 namespace ssq {
 class Table;
 } // namespace ssq
@@ -27,6 +31,13 @@ class Table;
 void load_squirrel_table(ssq::Table& table, const ReaderMapping& mapping);
 void save_squirrel_table(const ssq::Table& table, Writer& writer);
 
+/** Captures the serializable entries of the table into an array of
+    (key value) pairs, with nested tables as arrays of pairs themselves.
+    Unlike the table, the snapshot can be written from another thread. */
+sexp::Value snapshot_squirrel_table(const ssq::Table& table);
+/** Writes a snapshot, in the same format as save_squirrel_table(). */
+void write_squirrel_snapshot(const sexp::Value& snapshot, Writer& writer);
+
 #endif
 
 /* EOF */
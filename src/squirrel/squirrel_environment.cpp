@@ -17,21 +17,34 @@
 #include "squirrel/squirrel_environment.hpp"
 
 #include <algorithm>
+#include <iterator>
 
 #include <simplesquirrel/class.hpp>
 #include <simplesquirrel/vm.hpp>
 #include <sqstdaux.h>
 
+#include "physfs/mapped_file.hpp"
+#include "squirrel/squirrel_script_cache.hpp"
 #include "squirrel/squirrel_util.hpp"
 #include "squirrel/squirrel_virtual_machine.hpp"
 #include "supertux/globals.hpp"
 #include "util/log.hpp"
 
+namespace {
+
+/** Amount of finished threads kept for reuse */
+const size_t MAX_FREE_THREADS = 16;
+
+} // namespace
+
 SquirrelEnvironment::SquirrelEnvironment(ssq::VM& vm, const std::string& name) :
   m_vm(vm),
   m_table(m_vm.newTable()),
   m_name(name),
   m_scripts(),
+  m_free_threads(),
+  m_threads_created(0),
+  m_threads_reused(0),
   m_scheduler(std::make_unique<SquirrelScheduler>(m_vm))
 {
   // Garbage collector has to be invoked manually!
@@ -44,6 +57,7 @@ SquirrelEnvironment::SquirrelEnvironment(ssq::VM& vm, const std::string& name) :
 SquirrelEnvironment::~SquirrelEnvironment()
 {
   m_scripts.clear();
+  m_free_threads.clear();
   m_table.reset();
 
   sq_collectgarbage(m_vm.getHandle());
@@ -100,35 +114,83 @@ SquirrelEnvironment::run_script(const std::string& script, const std::string& so
 {
   if (script.empty()) return;
 
-  std::istringstream stream(script);
-  run_script(stream, sourcename);
+  run_source(script, sourcename);
 }
 
 void
 SquirrelEnvironment::garbage_collect()
 {
-  m_scripts.erase(
-    std::remove_if(m_scripts.begin(), m_scripts.end(),
-                   [](ssq::VM& thread) {
-                     return thread.getState() != SQ_VMSTATE_SUSPENDED;
-                   }),
-    m_scripts.end());
+  auto it = std::partition(m_scripts.begin(), m_scripts.end(),
+                           [](const ssq::VM& thread) {
+                             return thread.getState() == SQ_VMSTATE_SUSPENDED;
+                           });
+
+  for (auto finished = it; finished != m_scripts.end(); ++finished)
+    release_thread(std::move(*finished));
+
+  m_scripts.erase(it, m_scripts.end());
+}
+
+ssq::VM
+SquirrelEnvironment::acquire_thread()
+{
+  if (!m_free_threads.empty())
+  {
+    ssq::VM thread = std::move(m_free_threads.back());
+    m_free_threads.pop_back();
+    m_threads_reused += 1;
+    return thread;
+  }
+
+  ssq::VM thread = m_vm.newThread(64);
+  thread.setForeignPtr(this);
+  thread.setRootTable(m_table);
+  m_threads_created += 1;
+  return thread;
+}
+
+void
+SquirrelEnvironment::release_thread(ssq::VM thread)
+{
+  if (m_free_threads.size() >= MAX_FREE_THREADS)
+    return;
+
+  // Drop anything left on the stack by the previous script.
+  sq_settop(thread.getHandle(), 0);
+  m_free_threads.push_back(std::move(thread));
+}
+
+void
+SquirrelEnvironment::print_thread_stats(std::ostream& out) const
+{
+  out << m_name << ": " << m_scripts.size() << " suspended threads, "
+      << m_free_threads.size() << " pooled threads, "
+      << m_threads_created << " created, " << m_threads_reused << " reused" << std::endl;
 }
 
 void
 SquirrelEnvironment::run_script(std::istream& in, const std::string& sourcename)
 {
-  garbage_collect();
+  const std::string source((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  run_source(source, sourcename);
+}
 
-  try
-  {
-    ssq::VM thread = m_vm.newThread(64);
-    thread.setForeignPtr(this);
-    thread.setRootTable(m_table);
+void
+SquirrelEnvironment::run_script_file(const std::string& filename, const std::string& sourcename)
+{
+  MappedFile file(filename);
+  run_source(std::string_view(file.get_data(), file.get_size()), sourcename);
+}
 
-    thread.run(thread.compileSource(in, sourcename.c_str()));
+void
+SquirrelEnvironment::run_source(std::string_view source, const std::string& sourcename)
+{
+  ssq::VM thread = acquire_thread();
 
-    m_scripts.push_back(std::move(thread));
+  try
+  {
+    // The script is loaded in the thread, so it uses its root table.
+    thread.run(SquirrelVirtualMachine::current()->get_script_cache().load(thread, source, sourcename));
   }
   catch (const ssq::Exception& e)
   {
@@ -141,6 +203,12 @@ SquirrelEnvironment::run_script(std::istream& in, const std::string& sourcename)
   {
     log_warning << e.what() << std::endl;
   }
+
+  // Keep the thread, if the script is waiting for something.
+  if (thread.getState() == SQ_VMSTATE_SUSPENDED)
+    m_scripts.push_back(std::move(thread));
+  else
+    release_thread(std::move(thread));
 }
 
 SQInteger
@@ -159,6 +227,8 @@ void
 SquirrelEnvironment::update(float dt_sec)
 {
   m_scheduler->update(g_game_time);
+
+  garbage_collect();
 }
 
 /* EOF */
@@ -18,7 +18,10 @@
 #ifndef HEADER_SUPERTUX_SQUIRREL_SQUIRREL_ENVIRONMENT_HPP
 #define HEADER_SUPERTUX_SQUIRREL_SQUIRREL_ENVIRONMENT_HPP
 
+#include <memory>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include <simplesquirrel/vm.hpp>
@@ -58,18 +61,37 @@ public:
       destroyed). */
   void run_script(std::istream& in, const std::string& sourcename);
 
+  /** Runs the script in the given file, which is read in one go.
+      Throws, if the file can't be opened. */
+  void run_script_file(const std::string& filename, const std::string& sourcename);
+
+  /** Prints the amount of running, suspended and pooled threads. */
+  void print_thread_stats(std::ostream& out) const;
+
   void update(float dt_sec);
   SQInteger wait_for_seconds(HSQUIRRELVM vm, float seconds);
   SQInteger skippable_wait_for_seconds(HSQUIRRELVM vm, float seconds);
 
 private:
+  /** Moves threads, which have finished running, back into the pool. */
   void garbage_collect();
 
+  /** Returns a pooled thread, or creates a new one, if there is none. */
+  ssq::VM acquire_thread();
+  void release_thread(ssq::VM thread);
+
+  void run_source(std::string_view source, const std::string& sourcename);
+
 private:
   ssq::VM& m_vm;
   ssq::Table m_table;
   std::string m_name;
+  /** Threads of scripts, which have been suspended */
   std::vector<ssq::VM> m_scripts;
+  /** Finished threads, ready to run another script */
+  std::vector<ssq::VM> m_free_threads;
+  size_t m_threads_created;
+  size_t m_threads_reused;
   std::unique_ptr<SquirrelScheduler> m_scheduler;
 
 private:
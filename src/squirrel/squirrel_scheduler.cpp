@@ -16,83 +16,104 @@
 
 #include "squirrel/squirrel_scheduler.hpp"
 
-#include <algorithm>
+#include <cmath>
+#include <sstream>
 
 #include <simplesquirrel/exceptions.hpp>
 
 #include "squirrel/squirrel_util.hpp"
 #include "squirrel/squirrel_virtual_machine.hpp"
+#include "supertux/constants.hpp"
 #include "supertux/level.hpp"
 #include "util/log.hpp"
 
 SquirrelScheduler::SquirrelScheduler(ssq::VM& vm) :
   m_vm(vm),
-  schedule()
+  m_waits(),
+  m_skippable_waits()
 {
 }
 
+SquirrelScheduler::~SquirrelScheduler()
+{
+  const auto release = [this](ScheduledThread& scheduled) {
+    sq_release(m_vm.getHandle(), &scheduled.thread_ref);
+  };
+  m_waits.take_all(release);
+  m_skippable_waits.take_all(release);
+}
+
 void
 SquirrelScheduler::update(float time)
 {
-  while (!schedule.empty() &&
-         (schedule.front().wakeup_time < time ||
-          (schedule.front().skippable && Level::current() &&
-           Level::current()->m_skip_cutscene)))
-  {
-    HSQOBJECT thread_ref = schedule.front().thread_ref;
-
-    sq_pushobject(m_vm.getHandle(), thread_ref);
-    sq_getweakrefval(m_vm.getHandle(), -1);
-
-    HSQUIRRELVM scheduled_vm;
-    if (sq_gettype(m_vm.getHandle(), -1) == OT_THREAD &&
-       SQ_SUCCEEDED(sq_getthread(m_vm.getHandle(), -1, &scheduled_vm))) {
-      if (SQ_FAILED(sq_wakeupvm(scheduled_vm, SQFalse, SQFalse, SQTrue, SQFalse))) {
-        std::ostringstream msg;
-        msg << "Error waking VM: ";
-        sq_getlasterror(scheduled_vm);
-        if (sq_gettype(scheduled_vm, -1) != OT_STRING) {
-          msg << "(no info)";
-        } else {
-          const char* lasterr;
-          sq_getstring(scheduled_vm, -1, &lasterr);
-          msg << lasterr;
-        }
-        log_warning << msg.str() << std::endl;
-        sq_pop(scheduled_vm, 1);
-      }
-    }
+  // Waits are only woken up once their whole game step has passed.
+  const uint64_t step = static_cast<uint64_t>(std::max(0.0f, std::floor(time * LOGICAL_FPS)));
+  const auto wakeup = [this](ScheduledThread& scheduled) { this->wakeup(scheduled); };
 
-    sq_release(m_vm.getHandle(), &thread_ref);
-    sq_pop(m_vm.getHandle(), 2);
+  m_waits.advance(step, wakeup);
 
-    std::pop_heap(schedule.begin(), schedule.end());
-    schedule.pop_back();
-  }
+  if (Level::current() && Level::current()->m_skip_cutscene)
+    m_skippable_waits.take_all(wakeup);
+  else
+    m_skippable_waits.advance(step, wakeup);
 }
 
 SQInteger
 SquirrelScheduler::schedule_thread(HSQUIRRELVM scheduled_vm, float time, bool skippable)
 {
-  // create a weakref to the VM
-  sq_pushthread(m_vm.getHandle(), scheduled_vm);
-  sq_weakref(m_vm.getHandle(), -1);
+  ScheduledThread scheduled;
+  scheduled.thread = scheduled_vm;
 
-  ScheduleEntry entry;
-  if (SQ_FAILED(sq_getstackobj(m_vm.getHandle(), -1, & entry.thread_ref))) {
-    sq_pop(m_vm.getHandle(), 2);
-    throw ssq::Exception(m_vm.getHandle(), "Couldn't get thread weakref from vm");
+  sq_pushthread(m_vm.getHandle(), scheduled_vm);
+  if (SQ_FAILED(sq_getstackobj(m_vm.getHandle(), -1, &scheduled.thread_ref))) {
+    sq_pop(m_vm.getHandle(), 1);
+    throw ssq::Exception(m_vm.getHandle(), "Couldn't get thread from vm");
   }
-  entry.wakeup_time = time;
-  entry.skippable = skippable;
-
-  sq_addref(m_vm.getHandle(), & entry.thread_ref);
-  sq_pop(m_vm.getHandle(), 2);
+  sq_addref(m_vm.getHandle(), &scheduled.thread_ref);
+  sq_pop(m_vm.getHandle(), 1);
 
-  schedule.push_back(entry);
-  std::push_heap(schedule.begin(), schedule.end());
+  if (skippable)
+    m_skippable_waits.insert(to_step(time), scheduled);
+  else
+    m_waits.insert(to_step(time), scheduled);
 
   return sq_suspendvm(scheduled_vm);
 }
 
+uint64_t
+SquirrelScheduler::to_step(float time)
+{
+  return static_cast<uint64_t>(std::max(0.0f, std::ceil(time * LOGICAL_FPS)));
+}
+
+void
+SquirrelScheduler::wakeup(ScheduledThread& scheduled)
+{
+  // The reference keeps the thread alive, so it can be woken up directly.
+  // It may have finished or been woken up otherwise in the meantime though,
+  // e.g. by another wakeup() call, so it's only woken up while suspended.
+  HSQUIRRELVM scheduled_vm = scheduled.thread;
+  if (sq_getvmstate(scheduled_vm) != SQ_VMSTATE_SUSPENDED) {
+    sq_release(m_vm.getHandle(), &scheduled.thread_ref);
+    return;
+  }
+
+  if (SQ_FAILED(sq_wakeupvm(scheduled_vm, SQFalse, SQFalse, SQTrue, SQFalse))) {
+    std::ostringstream msg;
+    msg << "Error waking VM: ";
+    sq_getlasterror(scheduled_vm);
+    if (sq_gettype(scheduled_vm, -1) != OT_STRING) {
+      msg << "(no info)";
+    } else {
+      const char* lasterr;
+      sq_getstring(scheduled_vm, -1, &lasterr);
+      msg << lasterr;
+    }
+    log_warning << msg.str() << std::endl;
+    sq_pop(scheduled_vm, 1);
+  }
+
+  sq_release(m_vm.getHandle(), &scheduled.thread_ref);
+}
+
 /* EOF */
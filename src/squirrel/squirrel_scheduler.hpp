@@ -17,16 +17,19 @@
 #ifndef HEADER_SUPERTUX_SQUIRREL_SQUIRREL_SCHEDULER_HPP
 #define HEADER_SUPERTUX_SQUIRREL_SQUIRREL_SCHEDULER_HPP
 
-#include <vector>
+#include <stdint.h>
 
 #include <simplesquirrel/vm.hpp>
 
+#include "util/timer_wheel.hpp"
+
 /** This class keeps a list of squirrel threads that are scheduled for a certain
     time. (the typical result of a wait() command in a squirrel script) */
 class SquirrelScheduler final
 {
 public:
   SquirrelScheduler(ssq::VM& vm);
+  ~SquirrelScheduler();
 
   /** time must be absolute time, not relative updates, i.e. g_game_time */
   void update(float time);
@@ -34,27 +37,26 @@ public:
   SQInteger schedule_thread(HSQUIRRELVM vm, float time, bool skippable);
 
 private:
-  struct ScheduleEntry final
+  struct ScheduledThread final
   {
-    /// weak reference to the squirrel vm object
+    /// reference to the squirrel thread object, keeping it alive
     HSQOBJECT thread_ref;
-    /// time when the thread should be woken up
-    float wakeup_time;
-    // true if calling force_wake_up should wake this entry up
-    bool skippable;
-
-    bool operator<(const ScheduleEntry& other) const
-    {
-      // we need the smallest value on top
-      return wakeup_time > other.wakeup_time;
-    }
+    HSQUIRRELVM thread;
   };
 
+  /** Converts a time into the logical game step, in which it falls. */
+  static uint64_t to_step(float time);
+
+  void wakeup(ScheduledThread& scheduled);
+
 private:
   ssq::VM& m_vm;
 
-  typedef std::vector<ScheduleEntry> ScheduleHeap;
-  ScheduleHeap schedule;
+  /** Waits, keyed to the game step they end in */
+  TimerWheel<ScheduledThread> m_waits;
+
+  /** Waits which end early, once a cutscene is skipped */
+  TimerWheel<ScheduledThread> m_skippable_waits;
 
 private:
   SquirrelScheduler(const SquirrelScheduler&) = delete;
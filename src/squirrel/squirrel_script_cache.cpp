@@ -0,0 +1,336 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "squirrel/squirrel_script_cache.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iterator>
+#include <physfs.h>
+#include <sstream>
+
+#include "physfs/ifile_stream.hpp"
+#include "physfs/mapped_file.hpp"
+#include "physfs/util.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "util/log.hpp"
+
+namespace {
+
+const char* CACHE_DIRECTORY = "cache/scripts";
+const char CACHE_FILE_MAGIC[4] = { 'S', 'T', 'B', 'C' };
+const uint32_t CACHE_FILE_VERSION = 2;
+
+struct ReadBuffer
+{
+  const char* data;
+  size_t size;
+  size_t pos;
+};
+
+SQInteger read_buffer(SQUserPointer user_data, SQUserPointer dest, SQInteger size)
+{
+  ReadBuffer& buffer = *static_cast<ReadBuffer*>(user_data);
+  if (size < 0 || static_cast<size_t>(size) > buffer.size - buffer.pos)
+    return -1;
+
+  memcpy(dest, buffer.data + buffer.pos, static_cast<size_t>(size));
+  buffer.pos += static_cast<size_t>(size);
+  return size;
+}
+
+SQInteger write_buffer(SQUserPointer user_data, SQUserPointer src, SQInteger size)
+{
+  static_cast<std::string*>(user_data)->append(static_cast<const char*>(src), static_cast<size_t>(size));
+  return size;
+}
+
+std::string read_string(std::istream& in)
+{
+  uint64_t size = 0;
+  if (!in.read(reinterpret_cast<char*>(&size), sizeof(size)))
+    return std::string();
+
+  std::string result(static_cast<size_t>(size), '\0');
+  in.read(&result[0], static_cast<std::streamsize>(size));
+  return result;
+}
+
+void write_string(std::ostream& out, std::string_view text)
+{
+  const uint64_t size = text.size();
+  out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+  out.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+double seconds_since(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool cache_files_enabled()
+{
+  return g_config && g_config->cache_compiled_scripts;
+}
+
+} // namespace
+
+SquirrelScriptCache::SquirrelScriptCache(size_t capacity) :
+  m_capacity(capacity),
+  m_entries(),
+  m_index(),
+  m_hits(0),
+  m_file_hits(0),
+  m_misses(0),
+  m_compile_time(0.0),
+  m_load_time(0.0)
+{
+}
+
+ssq::Script
+SquirrelScriptCache::load(ssq::VM& vm, std::istream& in, const std::string& sourcename)
+{
+  const std::string source((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  return load(vm, source, sourcename);
+}
+
+ssq::Script
+SquirrelScriptCache::load_file(ssq::VM& vm, const std::string& filename)
+{
+  MappedFile file(filename);
+  return load(vm, std::string_view(file.get_data(), file.get_size()), filename);
+}
+
+ssq::Script
+SquirrelScriptCache::load(ssq::VM& vm, std::string_view source, const std::string& sourcename)
+{
+  const uint64_t key = hash(source, sourcename);
+
+  auto it = m_index.find(key);
+  if (it != m_index.end() &&
+      it->second->source == source && it->second->sourcename == sourcename)
+  {
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+    const auto start = std::chrono::steady_clock::now();
+    ssq::Script script(vm.getHandle());
+    const bool loaded = read_closure(vm, m_entries.front().bytecode, script);
+    m_load_time += seconds_since(start);
+
+    if (loaded)
+    {
+      m_hits += 1;
+      return script;
+    }
+  }
+
+  Entry entry{ key, std::string(source), sourcename, std::string() };
+
+  if (read_cache_file(source, sourcename, key, entry.bytecode))
+  {
+    const auto start = std::chrono::steady_clock::now();
+    ssq::Script script(vm.getHandle());
+    const bool loaded = read_closure(vm, entry.bytecode, script);
+    m_load_time += seconds_since(start);
+
+    if (loaded)
+    {
+      m_file_hits += 1;
+      insert(std::move(entry));
+      return script;
+    }
+
+    log_warning << "Couldn't load cached bytecode of '" << sourcename << "', recompiling." << std::endl;
+    entry.bytecode.clear();
+  }
+
+  m_misses += 1;
+
+  const auto start = std::chrono::steady_clock::now();
+  ssq::Script script = vm.compileSource(entry.source.c_str(), sourcename.c_str());
+  m_compile_time += seconds_since(start);
+
+  if (write_closure(vm, script, entry.bytecode))
+  {
+    write_cache_file(source, sourcename, key, entry.bytecode);
+    insert(std::move(entry));
+  }
+
+  return script;
+}
+
+void
+SquirrelScriptCache::clear()
+{
+  m_entries.clear();
+  m_index.clear();
+}
+
+void
+SquirrelScriptCache::debug_print(std::ostream& out) const
+{
+  size_t total_bytecode = 0;
+  for (const auto& entry : m_entries)
+    total_bytecode += entry.bytecode.size();
+
+  out << "script cache: " << m_entries.size() << "/" << m_capacity << " scripts, "
+      << total_bytecode << " bytes of bytecode" << std::endl;
+  out << "  hits:" << m_hits << " file_hits:" << m_file_hits << " misses:" << m_misses << std::endl;
+  out << "  compile_time:" << m_compile_time * 1000.0 << "ms"
+      << " load_time:" << m_load_time * 1000.0 << "ms" << std::endl;
+}
+
+uint64_t
+SquirrelScriptCache::hash(std::string_view source, const std::string& sourcename)
+{
+  // FNV-1a, as its result has to stay the same between runs for the cache files.
+  // The Squirrel version is included, as its bytecode format might change.
+  uint64_t result = 14695981039346656037ULL ^ static_cast<uint64_t>(SQUIRREL_VERSION_NUMBER);
+  const auto add = [&result](std::string_view text) {
+    for (const char c : text)
+    {
+      result ^= static_cast<unsigned char>(c);
+      result *= 1099511628211ULL;
+    }
+    result ^= 0xff;
+    result *= 1099511628211ULL;
+  };
+  add(sourcename);
+  add(source);
+  return result;
+}
+
+std::string
+SquirrelScriptCache::get_cache_filename(uint64_t hash)
+{
+  std::ostringstream out;
+  out << CACHE_DIRECTORY << "/" << std::hex << std::setw(16) << std::setfill('0') << hash << ".cnut";
+  return out.str();
+}
+
+bool
+SquirrelScriptCache::read_closure(ssq::VM& vm, const std::string& bytecode, ssq::Script& script)
+{
+  HSQUIRRELVM handle = vm.getHandle();
+
+  ReadBuffer buffer{ bytecode.data(), bytecode.size(), 0 };
+  if (SQ_FAILED(sq_readclosure(handle, &read_buffer, &buffer)))
+    return false;
+
+  sq_getstackobj(handle, -1, &script.getRaw());
+  sq_addref(handle, &script.getRaw());
+  sq_pop(handle, 1);
+  return true;
+}
+
+bool
+SquirrelScriptCache::write_closure(ssq::VM& vm, const ssq::Script& script, std::string& bytecode)
+{
+  HSQUIRRELVM handle = vm.getHandle();
+
+  sq_pushobject(handle, script.getRaw());
+  const bool success = SQ_SUCCEEDED(sq_writeclosure(handle, &write_buffer, &bytecode));
+  sq_pop(handle, 1);
+
+  if (!success)
+    bytecode.clear();
+  return success;
+}
+
+bool
+SquirrelScriptCache::read_cache_file(std::string_view source, const std::string& sourcename,
+                                     uint64_t hash, std::string& bytecode) const
+{
+  if (!cache_files_enabled())
+    return false;
+
+  const std::string filename = get_cache_filename(hash);
+  if (!PHYSFS_exists(filename.c_str()))
+    return false;
+
+  try
+  {
+    IFileStream in(filename);
+
+    char magic[sizeof(CACHE_FILE_MAGIC)];
+    uint32_t version = 0;
+    in.read(magic, sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!in || memcmp(magic, CACHE_FILE_MAGIC, sizeof(magic)) != 0 || version != CACHE_FILE_VERSION)
+      return false;
+
+    // The file name is only a hash, so the whole source is compared,
+    // to never run the bytecode of a different script on a collision.
+    if (read_string(in) != sourcename || read_string(in) != source || !in)
+      return false;
+
+    bytecode.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return !bytecode.empty();
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't read script cache file '" << filename << "': " << err.what() << std::endl;
+    return false;
+  }
+}
+
+void
+SquirrelScriptCache::write_cache_file(std::string_view source, const std::string& sourcename,
+                                      uint64_t hash, const std::string& bytecode) const
+{
+  if (!cache_files_enabled() || !g_config->write_caches)
+    return;
+
+  const std::string filename = get_cache_filename(hash);
+  if (!PHYSFS_mkdir(CACHE_DIRECTORY))
+  {
+    log_warning << "Couldn't write script cache file '" << filename << "': Couldn't create cache directory" << std::endl;
+    return;
+  }
+
+  // Another instance may read the file at the same time, so it's only
+  // replaced once it has been written completely.
+  physfsutil::write_file_replacing(filename, filename + ".part",
+    [&](std::ostream& out) {
+      out.write(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+      out.write(reinterpret_cast<const char*>(&CACHE_FILE_VERSION), sizeof(CACHE_FILE_VERSION));
+      write_string(out, sourcename);
+      write_string(out, source);
+      out.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
+    });
+}
+
+void
+SquirrelScriptCache::insert(Entry entry)
+{
+  auto it = m_index.find(entry.hash);
+  if (it != m_index.end())
+    m_entries.erase(it->second);
+
+  const uint64_t key = entry.hash;
+  m_entries.push_front(std::move(entry));
+  m_index[key] = m_entries.begin();
+
+  while (m_entries.size() > m_capacity)
+  {
+    m_index.erase(m_entries.back().hash);
+    m_entries.pop_back();
+  }
+}
+
+/* EOF */
@@ -0,0 +1,108 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SQUIRREL_SQUIRREL_SCRIPT_CACHE_HPP
+#define HEADER_SUPERTUX_SQUIRREL_SQUIRREL_SCRIPT_CACHE_HPP
+
+#include <list>
+#include <ostream>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <simplesquirrel/vm.hpp>
+
+/**
+ * Caches the compiled bytecode of scripts, keyed by a hash of their
+   source and source name, so scripts run over and over again (e.g. by
+   triggers) are only compiled once.
+
+   Only the bytecode is kept, as compiled closures are bound to the root
+   table they have been created with. Loading a closure from bytecode
+   is much cheaper than compiling it, and it gets the root table of the
+   VM (or thread) it is loaded in.
+
+   If enabled in the config, the bytecode is also written to ".cnut"
+   files in the user directory, so it can be reused on the next start.
+ */
+class SquirrelScriptCache final
+{
+private:
+  struct Entry
+  {
+    uint64_t hash;
+    std::string source;
+    std::string sourcename;
+    std::string bytecode;
+  };
+
+public:
+  static const size_t DEFAULT_CAPACITY = 256;
+
+public:
+  SquirrelScriptCache(size_t capacity = DEFAULT_CAPACITY);
+
+  /** Returns a closure of the given script, created in the given VM.
+      Throws ssq::Exception, if the script fails to compile. */
+  ssq::Script load(ssq::VM& vm, std::string_view source, const std::string& sourcename);
+  ssq::Script load(ssq::VM& vm, std::istream& in, const std::string& sourcename);
+  /** Loads the whole file in one go, with its name as the source name. */
+  ssq::Script load_file(ssq::VM& vm, const std::string& filename);
+
+  void clear();
+
+  void debug_print(std::ostream& out) const;
+
+private:
+  static uint64_t hash(std::string_view source, const std::string& sourcename);
+  static std::string get_cache_filename(uint64_t hash);
+
+  static bool read_closure(ssq::VM& vm, const std::string& bytecode, ssq::Script& script);
+  static bool write_closure(ssq::VM& vm, const ssq::Script& script, std::string& bytecode);
+
+  /** Cache files store the whole source and source name, which have to
+      match, since the file name is only derived from their hash. */
+  bool read_cache_file(std::string_view source, const std::string& sourcename,
+                       uint64_t hash, std::string& bytecode) const;
+  void write_cache_file(std::string_view source, const std::string& sourcename,
+                        uint64_t hash, const std::string& bytecode) const;
+
+  void insert(Entry entry);
+
+private:
+  size_t m_capacity;
+
+  /** Most recently used entries first */
+  std::list<Entry> m_entries;
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> m_index;
+
+  size_t m_hits;
+  size_t m_file_hits;
+  size_t m_misses;
+
+  /** Total time spent on compiling and loading scripts, in seconds */
+  double m_compile_time;
+  double m_load_time;
+
+private:
+  SquirrelScriptCache(const SquirrelScriptCache&) = delete;
+  SquirrelScriptCache& operator=(const SquirrelScriptCache&) = delete;
+};
+
+#endif
+
+/* EOF */
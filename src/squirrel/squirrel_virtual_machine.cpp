@@ -20,8 +20,8 @@
 #include <stdarg.h>
 #include <stdio.h>
 
-#include "physfs/ifile_stream.hpp"
 #include "squirrel/squirrel_scheduler.hpp"
+#include "squirrel/squirrel_script_cache.hpp"
 #include "squirrel/squirrel_thread_queue.hpp"
 #include "squirrel/squirrel_util.hpp"
 #include "squirrel/supertux_api.hpp"
@@ -59,6 +59,7 @@ static const char* DEFAULT_SCRIPT_FILE = "scripts/default.nut";
 
 SquirrelVirtualMachine::SquirrelVirtualMachine(bool enable_debugger) :
   m_vm(64, ssq::Libs::BLOB | ssq::Libs::MATH | ssq::Libs::STRING),
+  m_script_cache(std::make_unique<SquirrelScriptCache>()),
   m_screenswitch_queue(),
   m_scheduler()
 {
@@ -95,8 +96,7 @@ SquirrelVirtualMachine::SquirrelVirtualMachine(bool enable_debugger) :
   // Try to load the default script.
   try
   {
-    IFileStream stream(DEFAULT_SCRIPT_FILE);
-    m_vm.run(m_vm.compileSource(stream, DEFAULT_SCRIPT_FILE));
+    m_vm.run(m_script_cache->load_file(m_vm, DEFAULT_SCRIPT_FILE));
   }
   catch (const std::exception& err)
   {
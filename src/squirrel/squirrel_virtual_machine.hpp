@@ -23,6 +23,7 @@
 
 #include "util/currenton.hpp"
 
+class SquirrelScriptCache;
 class SquirrelThreadQueue;
 class SquirrelScheduler;
 
@@ -33,6 +34,7 @@ public:
   ~SquirrelVirtualMachine() override;
 
   ssq::VM& get_vm() { return m_vm; }
+  SquirrelScriptCache& get_script_cache() { return *m_script_cache; }
 
   SQInteger wait_for_seconds(HSQUIRRELVM vm, float seconds);
   SQInteger skippable_wait_for_seconds(HSQUIRRELVM vm, float seconds);
@@ -50,6 +52,7 @@ private:
 private:
   ssq::VM m_vm;
 
+  std::unique_ptr<SquirrelScriptCache> m_script_cache;
   std::unique_ptr<SquirrelThreadQueue> m_screenswitch_queue;
   std::unique_ptr<SquirrelScheduler> m_scheduler;
 
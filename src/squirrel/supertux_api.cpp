@@ -25,7 +25,7 @@
 #include "math/random.hpp"
 #include "object/camera.hpp"
 #include "object/player.hpp"
-#include "physfs/ifile_stream.hpp"
+#include "squirrel/squirrel_script_cache.hpp"
 #include "squirrel/squirrel_virtual_machine.hpp"
 #include "supertux/console.hpp"
 #include "supertux/debug.hpp"
@@ -339,8 +339,7 @@ static void import(HSQUIRRELVM vm, const std::string& filename)
 {
   ssq::VM ssq_vm(vm);
 
-  IFileStream in(filename);
-  ssq_vm.run(ssq_vm.compileSource(in, filename.c_str()));
+  ssq_vm.run(SquirrelVirtualMachine::current()->get_script_cache().load_file(ssq_vm, filename));
 }
 
 /**
@@ -394,6 +393,19 @@ static void debug_worldmap_ghost(bool enable)
   auto& tux = worldmap_sector->get_singleton_by_type<worldmap::Tux>();
   tux.set_ghost_mode(enable);
 }
+/**
+ * @scripting
+ * @description Prints statistics of the script cache and the script threads of the current sector to the console.
+ */
+static void debug_print_script_stats()
+{
+  SquirrelVirtualMachine::current()->get_script_cache().debug_print(ConsoleBuffer::output);
+
+  if (::Sector::current())
+    ::Sector::get().get_squirrel_environment().print_thread_stats(ConsoleBuffer::output);
+  if (worldmap::WorldMapSector::current())
+    worldmap::WorldMapSector::current()->get_squirrel_environment().print_thread_stats(ConsoleBuffer::output);
+}
 /**
  * @scripting
  * @description Sets the game speed to ""speed"".
@@ -838,6 +850,7 @@ void register_supertux_scripting_api(ssq::VM& vm)
   vm.addFunc("debug_draw_solids_only", &scripting::Globals::debug_draw_solids_only);
   vm.addFunc("debug_draw_editor_images", &scripting::Globals::debug_draw_editor_images);
   vm.addFunc("debug_worldmap_ghost", &scripting::Globals::debug_worldmap_ghost);
+  vm.addFunc("debug_print_script_stats", &scripting::Globals::debug_print_script_stats);
   vm.addFunc("set_game_speed", &scripting::Globals::set_game_speed);
   vm.addFunc("save_state", &scripting::Globals::save_state);
   vm.addFunc("load_state", &scripting::Globals::load_state);
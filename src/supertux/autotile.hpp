@@ -65,6 +65,8 @@ public:
   /** Returns true if the "center" bool of masks are true. All masks of given Autotile must have the same value for their "center" property.*/
   bool is_solid() const { return m_solid; }
 
+  const std::vector<AutotileMask>& get_masks() const { return m_masks; }
+
 private:
   uint32_t m_tile_id;
   std::vector<std::pair<uint32_t, float>> m_alt_tiles;
@@ -108,6 +110,9 @@ public:
 
   /** true if this is a corner-based autotileset */
   bool is_corner() const { return m_corner; }
+
+  const std::string& get_name() const { return m_name; }
+  const std::vector<Autotile*>& get_autotiles() const { return m_autotiles; }
   
   /** Returns the first mask corresponding to the current tile
    *  (useful for corners-based autotilesets)
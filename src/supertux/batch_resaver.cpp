@@ -0,0 +1,298 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/batch_resaver.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <thread>
+
+#include <fmt/format.h>
+
+#ifdef WIN32
+#include <process.h>
+#elif !defined(__EMSCRIPTEN__)
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+#include "supertux/command_line_arguments.hpp"
+#include "supertux/level_resaver.hpp"
+#include "util/log.hpp"
+#include "util/string_util.hpp"
+
+namespace {
+
+int get_process_id()
+{
+#ifdef WIN32
+  return _getpid();
+#elif defined(__EMSCRIPTEN__)
+  return 0;
+#else
+  return static_cast<int>(getpid());
+#endif
+}
+
+#ifdef WIN32
+/** _spawnv() joins the arguments with spaces, so they have to be quoted. */
+std::string quote_argument(const std::string& arg)
+{
+  if (!arg.empty() && arg.find_first_of(" \t\"") == std::string::npos)
+    return arg;
+
+  std::string result = "\"";
+  size_t backslashes = 0;
+  for (const char c : arg)
+  {
+    if (c == '\\')
+    {
+      backslashes += 1;
+      continue;
+    }
+
+    // Backslashes are only special in front of quotes.
+    result.append(c == '"' ? backslashes * 2 + 1 : backslashes, '\\');
+    backslashes = 0;
+    result += c;
+  }
+  result.append(backslashes * 2, '\\');
+  result += '"';
+  return result;
+}
+#endif
+
+} // namespace
+
+bool
+BatchResaver::run(const std::string& program, const CommandLineArguments& args)
+{
+  namespace fs = std::filesystem;
+
+  const std::string& directory = *args.resave_directory;
+  std::vector<std::string> files;
+  try
+  {
+    for (const auto& entry : fs::recursive_directory_iterator(directory))
+    {
+      const std::string path = entry.path().string();
+      if (entry.is_regular_file() &&
+          (StringUtil::has_suffix(path, ".stl") || StringUtil::has_suffix(path, ".stwm")))
+        files.push_back(path);
+    }
+  }
+  catch (const fs::filesystem_error& err)
+  {
+    log_warning << "Couldn't list levels in '" << directory << "': " << err.what() << std::endl;
+    return false;
+  }
+  std::sort(files.begin(), files.end());
+
+  if (files.empty())
+  {
+    log_warning << "No levels found in '" << directory << "'." << std::endl;
+    return true;
+  }
+
+  const size_t job_count = args.resave_jobs ? static_cast<size_t>(*args.resave_jobs) :
+                                              std::max(std::thread::hardware_concurrency(), 1u);
+  const auto jobs = partition(files, job_count);
+  log_info << "Resaving " << files.size() << " levels with " << jobs.size() << " processes." << std::endl;
+
+  struct Worker
+  {
+    long long handle;
+    std::string results_file;
+  };
+  std::vector<Worker> workers;
+  for (size_t i = 0; i < jobs.size(); ++i)
+  {
+    const std::string results_file = (fs::temp_directory_path() /
+      fmt::format("supertux-resave-{}-{}.txt", get_process_id(), i)).string();
+
+    std::vector<std::string> worker_args = { "--resave", "--resave-results", results_file };
+    if (args.update_versions && *args.update_versions)
+      worker_args.push_back("--update-versions");
+    if (args.datadir)
+      worker_args.insert(worker_args.end(), { "--datadir", *args.datadir });
+    if (args.userdir)
+      worker_args.insert(worker_args.end(), { "--userdir", *args.userdir });
+    worker_args.insert(worker_args.end(), jobs[i].begin(), jobs[i].end());
+
+    workers.push_back({ spawn(program, worker_args), results_file });
+  }
+
+  std::map<std::string, LevelResaver::Result> results;
+  for (size_t i = 0; i < workers.size(); ++i)
+  {
+    const Worker& worker = workers[i];
+    const int status = worker.handle < 0 ? -1 : wait(worker.handle);
+
+    if (fs::exists(worker.results_file))
+    {
+      try
+      {
+        for (auto& result : LevelResaver::load_results(worker.results_file))
+          results[result.filename] = std::move(result);
+      }
+      catch (const std::exception& err)
+      {
+        log_warning << "Couldn't load resave results: " << err.what() << std::endl;
+      }
+
+      std::error_code ec;
+      fs::remove(worker.results_file, ec);
+    }
+    std::error_code ec;
+    fs::remove(worker.results_file + ".part", ec);
+
+    // The worker records results after each level, in the order of the job.
+    // So the first level without results has crashed it, and the levels
+    // after it weren't resaved at all.
+    std::string crashed_file;
+    for (const auto& file : jobs[i])
+    {
+      if (results.find(file) != results.end())
+        continue;
+
+      LevelResaver::Result& result = results[file];
+      result.filename = file;
+      if (worker.handle < 0)
+      {
+        result.error = "worker process couldn't be started";
+      }
+      else if (crashed_file.empty())
+      {
+        result.error = fmt::format("worker process exited with status {}", status);
+        crashed_file = file;
+      }
+      else
+      {
+        result.error = "not resaved, since the worker process crashed on " + crashed_file;
+      }
+    }
+  }
+
+  std::vector<LevelResaver::Result> sorted_results;
+  for (auto& it : results)
+    sorted_results.push_back(std::move(it.second));
+
+  if (args.resave_report)
+  {
+    LevelResaver::write_report_file(*args.resave_report, sorted_results);
+  }
+  else
+  {
+    LevelResaver::write_report(std::cout, sorted_results);
+  }
+
+  return std::none_of(sorted_results.begin(), sorted_results.end(),
+                      [](const LevelResaver::Result& result) { return !result.error.empty(); });
+}
+
+std::vector<std::vector<std::string>>
+BatchResaver::partition(const std::vector<std::string>& files, size_t job_count)
+{
+  std::vector<std::pair<uintmax_t, std::string>> sized_files;
+  for (const auto& file : files)
+  {
+    std::error_code ec;
+    const uintmax_t size = std::filesystem::file_size(file, ec);
+    sized_files.push_back({ ec ? 0 : size, file });
+  }
+  std::stable_sort(sized_files.begin(), sized_files.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+  job_count = std::max<size_t>(std::min(job_count, files.size()), 1);
+  std::vector<std::vector<std::string>> jobs(job_count);
+  std::vector<uintmax_t> job_sizes(job_count, 0);
+  for (const auto& [size, file] : sized_files)
+  {
+    const size_t job = std::min_element(job_sizes.begin(), job_sizes.end()) - job_sizes.begin();
+    jobs[job].push_back(file);
+    job_sizes[job] += size;
+  }
+  return jobs;
+}
+
+long long
+BatchResaver::spawn(const std::string& program, const std::vector<std::string>& args)
+{
+#ifdef __EMSCRIPTEN__
+  log_warning << "Batch resaving is not supported on this platform." << std::endl;
+  return -1;
+#else
+#ifdef WIN32
+  std::vector<std::string> quoted_args = { quote_argument(program) };
+  for (const auto& arg : args)
+    quoted_args.push_back(quote_argument(arg));
+
+  std::vector<const char*> argv;
+  for (const auto& arg : quoted_args)
+    argv.push_back(arg.c_str());
+  argv.push_back(nullptr);
+
+  const intptr_t handle = _spawnv(_P_NOWAIT, program.c_str(), argv.data());
+  if (handle == -1)
+  {
+    log_warning << "Couldn't start '" << program << "'." << std::endl;
+    return -1;
+  }
+  return static_cast<long long>(handle);
+#else
+  std::vector<char*> argv = { const_cast<char*>(program.c_str()) };
+  for (const auto& arg : args)
+    argv.push_back(const_cast<char*>(arg.c_str()));
+  argv.push_back(nullptr);
+
+  pid_t pid;
+  const int error = posix_spawnp(&pid, program.c_str(), nullptr, nullptr, argv.data(), environ);
+  if (error != 0)
+  {
+    log_warning << "Couldn't start '" << program << "': " << strerror(error) << std::endl;
+    return -1;
+  }
+  return static_cast<long long>(pid);
+#endif
+#endif
+}
+
+int
+BatchResaver::wait(long long handle)
+{
+#ifdef __EMSCRIPTEN__
+  return -1;
+#elif defined(WIN32)
+  int status;
+  if (_cwait(&status, static_cast<intptr_t>(handle), 0) == -1)
+    return -1;
+  return status;
+#else
+  int status;
+  if (waitpid(static_cast<pid_t>(handle), &status, 0) == -1)
+    return -1;
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+#endif
+}
+
+/* EOF */
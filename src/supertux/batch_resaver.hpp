@@ -0,0 +1,54 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_BATCH_RESAVER_HPP
+#define HEADER_SUPERTUX_SUPERTUX_BATCH_RESAVER_HPP
+
+#include <string>
+#include <vector>
+
+class CommandLineArguments;
+
+/** Resaves all levels and worldmaps in a directory, by distributing them
+    over multiple worker processes, each running SuperTux with "--resave".
+    Processes are used instead of threads, since loading levels relies on
+    global managers, which are not thread-safe. */
+class BatchResaver final
+{
+public:
+  /** Resaves the levels in the "--resave-dir" directory and writes a report.
+      Returns false, if any of the levels couldn't be resaved. */
+  static bool run(const std::string& program, const CommandLineArguments& args);
+
+private:
+  /** Splits the files into up to the given amount of jobs with a similar
+      total file size, handing out the largest files first. */
+  static std::vector<std::vector<std::string>> partition(const std::vector<std::string>& files, size_t job_count);
+
+  /** Starts a worker process and returns its handle, or -1 on failure. */
+  static long long spawn(const std::string& program, const std::vector<std::string>& args);
+
+  /** Waits for a worker process to finish and returns its exit status. */
+  static int wait(long long handle);
+
+private:
+  BatchResaver() = delete;
+};
+
+#endif
+
+/* EOF */
@@ -50,7 +50,12 @@ CommandLineArguments::CommandLineArguments() :
   christmas_mode(),
   repository_url(),
   editor(),
-  resave()
+  resave(),
+  resave_directory(),
+  resave_report(),
+  resave_results(),
+  resave_jobs(),
+  update_versions()
 {
 }
 
@@ -113,6 +118,10 @@ CommandLineArguments::print_help(const char* arg0) const
     << _("Game Options:") << "\n"
     << _("  --edit-level                 Open given level in editor") << "\n"
     << _("  --resave                     Loads given level and saves it") << "\n"
+    << _("  --resave-dir DIR             Resaves all levels in DIR in parallel") << "\n"
+    << _("  --resave-jobs N              Number of processes to resave levels with") << "\n"
+    << _("  --resave-report FILE         Write a report of the resaved levels to FILE") << "\n"
+    << _("  --update-versions            Update outdated objects when resaving levels") << "\n"
     << _("  --show-fps                   Display framerate in levels") << "\n"
     << _("  --no-show-fps                Do not display framerate in levels") << "\n"
     << _("  --show-pos                   Display player's current position") << "\n"
@@ -367,6 +376,39 @@ CommandLineArguments::parse_args(int argc, char** argv)
     {
       resave = true;
     }
+    else if (arg == "--resave-dir")
+    {
+      if (++i >= argc)
+        throw std::runtime_error("--resave-dir DIR needs an argument");
+
+      resave_directory = argv[i];
+    }
+    else if (arg == "--resave-report")
+    {
+      if (++i >= argc)
+        throw std::runtime_error("--resave-report FILE needs an argument");
+
+      resave_report = argv[i];
+    }
+    else if (arg == "--resave-results")
+    {
+      if (++i >= argc)
+        throw std::runtime_error("--resave-results FILE needs an argument");
+
+      resave_results = argv[i];
+    }
+    else if (arg == "--resave-jobs")
+    {
+      int jobs;
+      if (++i >= argc || sscanf(argv[i], "%9d", &jobs) != 1 || jobs < 1)
+        throw std::runtime_error("--resave-jobs N needs a positive number");
+
+      resave_jobs = jobs;
+    }
+    else if (arg == "--update-versions")
+    {
+      update_versions = true;
+    }
     else if (arg[0] != '-')
     {
       filenames.push_back(arg);
@@ -381,6 +423,9 @@ CommandLineArguments::parse_args(int argc, char** argv)
   if (filenames.size() > 1 && !(resave && *resave)) {
     throw std::runtime_error("Only one filename allowed for the given options");
   }
+  if (resave_directory && !filenames.empty()) {
+    throw std::runtime_error("--resave-dir can't be combined with level filenames");
+  }
 }
 
 void
@@ -79,6 +79,12 @@ public:
 
   std::optional<bool> editor;
   std::optional<bool> resave;
+  std::optional<std::string> resave_directory;
+  std::optional<std::string> resave_report;
+  /** File to store the results of resaving in, used by batch resave worker processes */
+  std::optional<std::string> resave_results;
+  std::optional<int> resave_jobs;
+  std::optional<bool> update_versions;
 
   // std::optional<std::string> locale;
 
@@ -32,10 +32,18 @@ static const float FADE_SPEED = 1;
 
 ConsoleBuffer::ConsoleBuffer() :
   m_lines(),
-  m_console(nullptr)
+  m_console(nullptr),
+  m_queue_mutex(),
+  m_queued_lines()
 {
 }
 
+ConsoleBuffer::~ConsoleBuffer()
+{
+  // Print out whatever was logged after the last update.
+  process_queued_lines();
+}
+
 void
 ConsoleBuffer::set_console(Console* console)
 {
@@ -103,6 +111,26 @@ ConsoleBuffer::flush(ConsoleStreamBuffer& buffer)
   }
 }
 
+void
+ConsoleBuffer::queue_lines(const std::string& s)
+{
+  std::lock_guard<std::mutex> lock(m_queue_mutex);
+  m_queued_lines.push_back(s);
+}
+
+void
+ConsoleBuffer::process_queued_lines()
+{
+  std::vector<std::string> lines;
+  {
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    lines.swap(m_queued_lines);
+  }
+
+  for (const auto& s : lines)
+    addLines(s);
+}
+
 Console::Console(ConsoleBuffer& buffer) :
   m_buffer(buffer),
   m_inputBuffer(),
@@ -486,6 +514,8 @@ Console::toggle()
 void
 Console::update(float dt_sec)
 {
+  m_buffer.process_queued_lines();
+
   if (m_stayOpen > 0) {
     m_stayOpen -= dt_sec;
     if (m_stayOpen < 0)
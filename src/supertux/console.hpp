@@ -18,6 +18,7 @@
 #define HEADER_SUPERTUX_SUPERTUX_CONSOLE_HPP
 
 #include <list>
+#include <mutex>
 #include <sstream>
 #include <vector>
 
@@ -43,14 +44,26 @@ public:
 
 public:
   ConsoleBuffer();
+  ~ConsoleBuffer() override;
 
   void addLines(const std::string& s); /**< display a string of (potentially) multiple lines in the console */
   void addLine(const std::string& s); /**< display a line in the console */
 
   void flush(ConsoleStreamBuffer& buffer); /**< act upon changes in a ConsoleStreamBuffer */
 
+  /** Queues lines to be displayed by process_queued_lines(). Unlike the
+      other functions, this may be called from any thread. */
+  void queue_lines(const std::string& s);
+
+  /** Displays the lines queued from other threads. Main thread only. */
+  void process_queued_lines();
+
   void set_console(Console* console);
 
+private:
+  std::mutex m_queue_mutex;
+  std::vector<std::string> m_queued_lines;
+
 private:
   ConsoleBuffer(const ConsoleBuffer&) = delete;
   ConsoleBuffer& operator=(const ConsoleBuffer&) = delete;
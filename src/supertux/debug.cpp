@@ -26,6 +26,8 @@ Debug::Debug() :
   show_worldmap_path(false),
   draw_redundant_frames(false),
   show_toolbox_tile_ids(false),
+  parallel_object_updates(true),
+  check_parallel_update_order(false),
   m_use_bitmap_fonts(false),
   m_game_speed_multiplier(1.0f)
 {
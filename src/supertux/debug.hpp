@@ -41,6 +41,14 @@ public:
 
   bool show_toolbox_tile_ids;
 
+  /** Update parallel-safe objects on the thread pool */
+  bool parallel_object_updates;
+
+  /** Check parallel-safe objects for order dependence: update them serially
+      in order, as a reference run, and warn if they change other objects
+      of their batch or add objects. */
+  bool check_parallel_update_order;
+
 private:
   /** Use old bitmap fonts instead of TTF */
   bool m_use_bitmap_fonts;
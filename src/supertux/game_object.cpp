@@ -38,6 +38,7 @@ GameObject::GameObject() :
   m_uid(),
   m_scheduled_for_removal(false),
   m_last_state(),
+  m_cached_settings(),
   m_components(),
   m_remove_listeners()
 {
@@ -54,6 +55,7 @@ GameObject::GameObject(const std::string& name) :
   m_uid(),
   m_scheduled_for_removal(false),
   m_last_state(),
+  m_cached_settings(),
   m_components(),
   m_remove_listeners()
 {
@@ -102,11 +104,12 @@ GameObject::save(Writer& writer)
 std::string
 GameObject::save()
 {
-  std::ostringstream save_stream;
-  Writer writer(save_stream);
-  save(writer);
-
-  return save_stream.str();
+  std::string data;
+  {
+    Writer writer(data);
+    save(writer);
+  }
+  return data;
 }
 
 GameObjectClasses
@@ -144,6 +147,19 @@ GameObject::get_settings()
   return result;
 }
 
+const ObjectSettings&
+GameObject::get_cached_settings()
+{
+  if (!m_cached_settings)
+  {
+    // Building the settings shouldn't be mistaken for opening the object menu.
+    const int previous_type = m_previous_type;
+    m_cached_settings = std::make_unique<ObjectSettings>(get_settings());
+    m_previous_type = previous_type;
+  }
+  return *m_cached_settings;
+}
+
 const std::string&
 GameObject::get_name() const
 {
@@ -186,6 +202,7 @@ void
 GameObject::update_version()
 {
   m_version = get_latest_version();
+  invalidate_cached_settings();
 }
 
 void
@@ -209,6 +226,8 @@ GameObject::save_state()
 void
 GameObject::check_state()
 {
+  notify_changed();
+
   if (!m_parent)
     return;
 
@@ -231,6 +250,15 @@ GameObject::check_state()
   }
 }
 
+void
+GameObject::notify_changed()
+{
+  invalidate_cached_settings();
+
+  if (m_parent)
+    m_parent->on_object_changed(*this);
+}
+
 void
 GameObject::parse_type(const ReaderMapping& reader)
 {
@@ -260,6 +288,8 @@ GameObject::get_types() const
 void
 GameObject::after_editor_set()
 {
+  invalidate_cached_settings();
+
   // Check if the type has changed.
   if (m_previous_type > -1 &&
       m_previous_type != m_type)
@@ -107,6 +107,23 @@ public:
       in pause mode). This function is not called in the Editor. */
   virtual void update(float dt_sec) = 0;
 
+  /** Flags describing which state, other than its own, an object
+      accesses in update(). */
+  enum UpdateAccess
+  {
+    UPDATE_ACCESS_OWN = 0,
+    /** Reads other objects or sector state (camera, gravity, etc.). */
+    UPDATE_ACCESS_READ_SHARED = 1 << 0,
+    /** Writes other objects or sector state, adds objects, runs scripts,
+        plays sounds or depends on the update order in any other way. */
+    UPDATE_ACCESS_WRITE_SHARED = 1 << 1
+  };
+
+  /** Returns the UpdateAccess flags of this object. Objects, which do not
+      write shared state, are updated in parallel after all other objects.
+      By default, objects are assumed to both read and write shared state. */
+  virtual int get_update_access() const { return UPDATE_ACCESS_READ_SHARED | UPDATE_ACCESS_WRITE_SHARED; }
+
   /** The GameObject should draw itself onto the provided
       DrawingContext if this function is called. */
   virtual void draw(DrawingContext& context) = 0;
@@ -168,6 +185,13 @@ public:
   virtual bool has_settings() const { return is_saveable(); }
   virtual ObjectSettings get_settings();
 
+  /** Returns the settings from the last call, building them only if the
+      object's state or version has changed since. Only suitable for
+      displaying the current values, as some options (e.g. Rectf) take
+      a snapshot on construction, which would be stale for saving. */
+  const ObjectSettings& get_cached_settings();
+  void invalidate_cached_settings() { m_cached_settings.reset(); }
+
   /** Get all types of the object, if available. **/
   virtual GameObjectTypes get_types() const;
   /**
@@ -256,6 +280,11 @@ public:
   GameObjectManager* get_parent() const { return m_parent; }
 
 protected:
+  /** Drops the cached settings and informs the object listeners of the
+      parent, that the object may have changed. Done by check_state(), so
+      overrides, which don't call it, have to call this themselves. */
+  void notify_changed();
+
   /** Parse object type. **/
   void parse_type(const ReaderMapping& reader);
 
@@ -313,6 +342,8 @@ private:
       Used to check for changes that may have occured. */
   std::string m_last_state;
 
+  std::unique_ptr<ObjectSettings> m_cached_settings;
+
   std::vector<std::unique_ptr<GameObjectComponent> > m_components;
 
   std::vector<ObjectRemoveListener*> m_remove_listeners;
@@ -27,14 +27,30 @@
 #include "object/ambient_light.hpp"
 #include "object/music_object.hpp"
 #include "object/tilemap.hpp"
+#include "supertux/debug.hpp"
 #include "supertux/game_object_factory.hpp"
 #include "supertux/moving_object.hpp"
+#include "supertux/object_listener.hpp"
+#include "supertux/tilemap_listener.hpp"
+#include "util/log.hpp"
+#include "util/thread_pool.hpp"
 
 bool GameObjectManager::s_draw_solids_only = false;
+thread_local const GameObject* GameObjectManager::s_parallel_update_object = nullptr;
+
+void
+GameObjectManager::check_parallel_update(const char* action)
+{
+  if (!s_parallel_update_object || !g_debug.check_parallel_update_order)
+    return;
+
+  log_warning << "Object of class '" << s_parallel_update_object->get_class_name()
+              << "' is marked as parallel-safe, but attempted to " << action
+              << " during its update." << std::endl;
+}
 
 GameObjectManager::GameObjectManager(bool undo_tracking) :
   m_initialized(false),
-  m_uid_generator(),
   m_change_uid_generator(),
   m_undo_tracking(undo_tracking),
   m_undo_stack_size(20),
@@ -46,10 +62,15 @@ GameObjectManager::GameObjectManager(bool undo_tracking) :
   m_gameobjects_new(),
   m_solid_tilemaps(),
   m_all_tilemaps(),
+  m_solid_tile_bitmap(),
+  m_solid_tile_bitmap_dirty(true),
+  m_tilemap_listeners(),
+  m_object_listeners(),
   m_objects_by_name(),
   m_objects_by_uid(),
   m_objects_by_type_index(),
-  m_name_resolve_requests()
+  m_name_resolve_requests(),
+  m_parallel_update_objects()
 {
 }
 
@@ -128,18 +149,23 @@ GameObject&
 GameObjectManager::add_object(std::unique_ptr<GameObject> object)
 {
   assert(object);
+  check_parallel_update("add an object");
 
   object->m_parent = this;
 
   if (!object->get_uid())
   {
-    object->set_uid(m_uid_generator.next());
+    object->set_uid(m_objects_by_uid.insert(object.get()));
 
     // No object UID would indicate the object is not a result of undo/redo.
     // Any newly placed object in the editor should be on its latest version.
     if (m_initialized && Editor::is_active())
       object->update_version();
   }
+  else
+  {
+    m_objects_by_uid.insert(object->get_uid(), object.get());
+  }
 
   // Make sure the object isn't already in the list.
 #ifndef NDEBUG
@@ -200,21 +226,113 @@ GameObjectManager::clear_objects()
   flush_game_objects();
 
   for (const auto& obj: m_gameobjects) {
+    for (auto* listener : m_object_listeners)
+      listener->object_removed(*obj);
+
     before_object_remove(*obj);
   }
   m_gameobjects.clear();
+  m_objects_by_uid.clear();
+
+  m_solid_tilemaps.clear();
+  m_all_tilemaps.clear();
+  m_solid_tile_bitmap_dirty = true;
 }
 
 void
 GameObjectManager::update(float dt_sec)
 {
+  // Objects, which may write shared state, are updated in order. The
+  // parallel-safe objects between them are updated as a batch, before
+  // the next of those objects, so the order of the updates is kept.
+  m_parallel_update_objects.clear();
   for (const auto& object : m_gameobjects)
   {
     if (!object->is_valid())
       continue;
 
-    object->update(dt_sec);
+    if (object->get_update_access() & GameObject::UPDATE_ACCESS_WRITE_SHARED)
+    {
+      update_parallel_batch(dt_sec);
+      object->update(dt_sec);
+    }
+    else
+    {
+      m_parallel_update_objects.push_back(object.get());
+    }
+  }
+  update_parallel_batch(dt_sec);
+}
+
+void
+GameObjectManager::update_parallel_object(GameObject& object, float dt_sec)
+{
+  if (!object.is_valid())
+    return;
+
+  s_parallel_update_object = &object;
+  object.update(dt_sec);
+  s_parallel_update_object = nullptr;
+}
+
+void
+GameObjectManager::update_parallel_batch(float dt_sec)
+{
+  if (m_parallel_update_objects.empty())
+    return;
+
+  if (g_debug.check_parallel_update_order)
+  {
+    check_parallel_batch(dt_sec);
+  }
+  else if (g_debug.parallel_object_updates && m_parallel_update_objects.size() > 1 &&
+           ThreadPool::current() && !ThreadPool::in_job())
+  {
+    ThreadPool::current()->parallel_for(m_parallel_update_objects.size(), [this, dt_sec](size_t i) {
+        update_parallel_object(*m_parallel_update_objects[i], dt_sec);
+      });
+  }
+  else
+  {
+    for (GameObject* object : m_parallel_update_objects)
+      update_parallel_object(*object, dt_sec);
+  }
+  m_parallel_update_objects.clear();
+}
+
+void
+GameObjectManager::check_parallel_batch(float dt_sec)
+{
+  // The batch is updated serially and in order, as a reference run. Updating
+  // it in parallel only gives the same result, if no object of the batch
+  // changes another one. So the saved state of each object has to be the same
+  // before its own update as at the start of the batch, and the same at the
+  // end of the batch as right after its own update.
+  std::vector<std::string> states;
+  for (GameObject* object : m_parallel_update_objects)
+    states.push_back(object->save());
+
+  const auto check_state = [](GameObject& object, const std::string& state) {
+    if (object.is_valid() && object.save() != state)
+    {
+      log_warning << "Object of class '" << object.get_class_name()
+                  << "' was changed during the update of other parallel-safe objects, "
+                  << "so updating them in parallel differs from updating them in order." << std::endl;
+    }
+  };
+
+  for (size_t i = 0; i < m_parallel_update_objects.size(); ++i)
+  {
+    GameObject& object = *m_parallel_update_objects[i];
+    check_state(object, states[i]);
+
+    update_parallel_object(object, dt_sec);
+    if (object.is_valid())
+      states[i] = object.save();
   }
+
+  for (size_t i = 0; i < m_parallel_update_objects.size(); ++i)
+    check_state(*m_parallel_update_objects[i], states[i]);
 }
 
 void
@@ -272,10 +390,13 @@ GameObjectManager::flush_game_objects()
           else
             m_gameobjects.push_back(std::move(object));
         }
+        else
+        {
+          m_objects_by_uid.erase(object->get_uid());
+        }
       }
     }
   }
-  update_tilemaps();
 
   // A resolve request may depend on an object being added.
   try_process_resolve_requests();
@@ -291,28 +412,101 @@ GameObjectManager::flush_game_objects()
   m_initialized = true;
 }
 
-void 
-GameObjectManager::update_solid(TileMap* tm) {
+void
+GameObjectManager::update_solid(TileMap* tm)
+{
   auto it = std::find(m_solid_tilemaps.begin(), m_solid_tilemaps.end(), tm);
   bool found = it != m_solid_tilemaps.end();
   if (tm->is_solid() && !found) {
-    m_solid_tilemaps.push_back(tm);
+    insert_solid_tilemap(tm);
+    m_solid_tile_bitmap_dirty = true;
   } else if(!tm->is_solid() && found) {
     m_solid_tilemaps.erase(it);
+    m_solid_tile_bitmap_dirty = true;
   }
 }
 
 void
-GameObjectManager::update_tilemaps()
+GameObjectManager::insert_solid_tilemap(TileMap* tilemap)
 {
-  m_solid_tilemaps.clear();
-  m_all_tilemaps.clear();
-  for (auto tilemap : get_objects_by_type_index(typeid(TileMap)))
+  // Tilemaps, which haven't been added yet, are inserted once they are.
+  auto all_it = std::find(m_all_tilemaps.begin(), m_all_tilemaps.end(), tilemap);
+  if (all_it == m_all_tilemaps.end())
+    return;
+
+  // The solid tilemaps are a subsequence of all tilemaps, so skip over
+  // the solid ones preceding the tilemap.
+  auto it = m_solid_tilemaps.begin();
+  for (auto prev = m_all_tilemaps.begin(); prev != all_it; ++prev)
   {
-    TileMap* tm = static_cast<TileMap*>(tilemap);
-    if (tm->is_solid()) m_solid_tilemaps.push_back(tm);
-    m_all_tilemaps.push_back(tm);
+    if (it != m_solid_tilemaps.end() && *it == *prev)
+      ++it;
   }
+  m_solid_tilemaps.insert(it, tilemap);
+}
+
+void
+GameObjectManager::on_tilemap_changed(const TileMap& tilemap)
+{
+  if (tilemap.is_solid())
+    m_solid_tile_bitmap_dirty = true;
+
+  for (auto* listener : m_tilemap_listeners)
+    listener->tilemap_changed(tilemap);
+}
+
+void
+GameObjectManager::on_tilemap_tile_changed(const TileMap& tilemap, int x, int y)
+{
+  if (!m_solid_tile_bitmap_dirty && tilemap.is_solid())
+    m_solid_tile_bitmap.update_tile(tilemap, x, y);
+
+  for (auto* listener : m_tilemap_listeners)
+    listener->tilemap_tile_changed(tilemap, x, y);
+}
+
+void
+GameObjectManager::add_tilemap_listener(TileMapListener* listener)
+{
+  m_tilemap_listeners.push_back(listener);
+}
+
+void
+GameObjectManager::remove_tilemap_listener(TileMapListener* listener)
+{
+  m_tilemap_listeners.erase(std::remove(m_tilemap_listeners.begin(), m_tilemap_listeners.end(), listener),
+                            m_tilemap_listeners.end());
+}
+
+void
+GameObjectManager::on_object_changed(GameObject& object)
+{
+  for (auto* listener : m_object_listeners)
+    listener->object_changed(object);
+}
+
+void
+GameObjectManager::add_object_listener(ObjectListener* listener)
+{
+  m_object_listeners.push_back(listener);
+}
+
+void
+GameObjectManager::remove_object_listener(ObjectListener* listener)
+{
+  m_object_listeners.erase(std::remove(m_object_listeners.begin(), m_object_listeners.end(), listener),
+                           m_object_listeners.end());
+}
+
+const SolidTileBitmap&
+GameObjectManager::get_solid_tile_bitmap() const
+{
+  if (m_solid_tile_bitmap_dirty)
+  {
+    m_solid_tile_bitmap.rebuild(m_solid_tilemaps);
+    m_solid_tile_bitmap_dirty = false;
+  }
+  return m_solid_tile_bitmap;
 }
 
 void
@@ -415,6 +609,17 @@ GameObjectManager::create_object_from_change(const ObjectChange& change)
 void
 GameObjectManager::process_object_change(ObjectChange& change)
 {
+  if (!change.tiles.empty())
+  {
+    // The delta holds the tiles before the change on undo, and the ones after it on redo.
+    change.tiles.invert();
+
+    auto tilemap = get_object_by_uid<TileMap>(change.uid);
+    if (tilemap)
+      tilemap->apply_delta(change.tiles);
+    return;
+  }
+
   GameObject* object = get_object_by_uid<GameObject>(change.uid);
   if (object) // Object exists, remove it.
   {
@@ -439,7 +644,7 @@ void
 GameObjectManager::save_object_change(GameObject& object, bool creation)
 {
   if (m_undo_tracking && object.track_state() && object.m_track_undo)
-    m_pending_change_stack.push_back({ object.get_class_name(), object.get_uid(), object.save(), creation });
+    m_pending_change_stack.push_back({ object.get_class_name(), object.get_uid(), object.save(), creation, TileMapDelta() });
 
   object.m_track_undo = true;
 }
@@ -448,7 +653,14 @@ void
 GameObjectManager::save_object_change(GameObject& object, const std::string& data)
 {
   if (m_undo_tracking)
-    m_pending_change_stack.push_back({ object.get_class_name(), object.get_uid(), data, false });
+    m_pending_change_stack.push_back({ object.get_class_name(), object.get_uid(), data, false, TileMapDelta() });
+}
+
+void
+GameObjectManager::save_tile_change(GameObject& tilemap, TileMapDelta delta)
+{
+  if (m_undo_tracking)
+    m_pending_change_stack.push_back({ tilemap.get_class_name(), tilemap.get_uid(), std::string(), false, std::move(delta) });
 }
 
 void
@@ -466,6 +678,23 @@ GameObjectManager::has_object_changes() const
          (!m_undo_stack.empty() && m_undo_stack.back().uid != m_last_saved_change);
 }
 
+size_t
+GameObjectManager::get_undo_stack_memory() const
+{
+  size_t memory = 0;
+  for (const auto* stack : { &m_undo_stack, &m_redo_stack })
+  {
+    for (const auto& changes : *stack)
+    {
+      memory += sizeof(ObjectChanges);
+      for (const auto& change : changes.objects)
+        memory += sizeof(ObjectChange) + change.name.capacity() + change.data.capacity() +
+                  change.tiles.get_memory_usage();
+    }
+  }
+  return memory;
+}
+
 void
 GameObjectManager::this_before_object_add(GameObject& object)
 {
@@ -476,12 +705,6 @@ GameObjectManager::this_before_object_add(GameObject& object)
     }
   }
 
-  { // By id:
-    assert(object.get_uid());
-
-    m_objects_by_uid[object.get_uid()] = &object;
-  }
-
   { // By type index:
     for (const std::type_index& type : object.get_class_types().types)
     {
@@ -489,6 +712,22 @@ GameObjectManager::this_before_object_add(GameObject& object)
     }
   }
 
+  if (auto* tilemap = dynamic_cast<TileMap*>(&object))
+  {
+    m_all_tilemaps.push_back(tilemap);
+    if (tilemap->is_solid())
+    {
+      m_solid_tilemaps.push_back(tilemap);
+      m_solid_tile_bitmap_dirty = true;
+    }
+
+    for (auto* listener : m_tilemap_listeners)
+      listener->tilemap_changed(*tilemap);
+  }
+
+  for (auto* listener : m_object_listeners)
+    listener->object_added(object);
+
   save_object_change(object, true);
 }
 
@@ -497,6 +736,9 @@ GameObjectManager::this_before_object_remove(GameObject& object)
 {
   save_object_change(object);
 
+  for (auto* listener : m_object_listeners)
+    listener->object_removed(object);
+
   { // By name:
     const std::string& name = object.get_name();
     if (!name.empty())
@@ -518,6 +760,21 @@ GameObjectManager::this_before_object_remove(GameObject& object)
       vec.erase(it);
     }
   }
+
+  if (auto* tilemap = dynamic_cast<TileMap*>(&object))
+  {
+    m_all_tilemaps.erase(std::remove(m_all_tilemaps.begin(), m_all_tilemaps.end(), tilemap),
+                         m_all_tilemaps.end());
+    auto it = std::find(m_solid_tilemaps.begin(), m_solid_tilemaps.end(), tilemap);
+    if (it != m_solid_tilemaps.end())
+    {
+      m_solid_tilemaps.erase(it);
+      m_solid_tile_bitmap_dirty = true;
+    }
+
+    for (auto* listener : m_tilemap_listeners)
+      listener->tilemap_changed(*tilemap);
+  }
 }
 
 void
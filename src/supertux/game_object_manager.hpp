@@ -27,12 +27,17 @@
 #include <unordered_map>
 #include <vector>
 
+#include "object/tilemap_delta.hpp"
 #include "supertux/game_object.hpp"
+#include "supertux/solid_tile_bitmap.hpp"
 #include "util/uid_generator.hpp"
+#include "util/uid_table.hpp"
 
 class DrawingContext;
 class MovingObject;
+class ObjectListener;
 class TileMap;
+class TileMapListener;
 
 template<class T> class GameObjectRange;
 
@@ -50,6 +55,14 @@ public:
 public:
   static void register_class(ssq::VM& vm);
 
+  /** Warns about a modification of shared state, if it is done from within the
+      parallel update phase, while checking the parallel update order is enabled. */
+  static void check_parallel_update(const char* action);
+
+private:
+  /** The object, which is being updated in the parallel update phase on this thread. */
+  static thread_local const GameObject* s_parallel_update_object;
+
 private:
   struct NameResolveRequest
   {
@@ -188,31 +201,22 @@ public:
   template<class T>
   T* get_object_by_uid(const UID& uid) const
   {
-    auto it = m_objects_by_uid.find(uid);
-    if (it == m_objects_by_uid.end())
-    {
-      // FIXME: Is this a good idea? Should gameobjects be made
-      // accessible even when not fully inserted into the manager?
-      for (auto&& itnew : m_gameobjects_new)
-      {
-        if (itnew->get_uid() == uid)
-          return static_cast<T*>(itnew.get());
-      }
+    // Objects are registered once they are queued up to be added,
+    // so they are accessible before they are fully inserted.
+    GameObject* object = m_objects_by_uid.get(uid);
+    if (!object)
       return nullptr;
-    }
-    else
-    {
+
 #ifdef NDEBUG
-      return static_cast<T*>(it->second);
+    return static_cast<T*>(object);
 #else
-      // Since uids should be unique, there should be no need to guess
-      // the type, thus we assert() when the object type is not what
-      // we expected.
-      auto ptr = dynamic_cast<T*>(it->second);
-      assert(ptr != nullptr);
-      return ptr;
+    // Since uids should be unique, there should be no need to guess
+    // the type, thus we assert() when the object type is not what
+    // we expected.
+    auto ptr = dynamic_cast<T*>(object);
+    assert(ptr != nullptr);
+    return ptr;
 #endif
-    }
   }
 
   /** Move an object to another GameObjectManager. */
@@ -258,6 +262,29 @@ public:
   
   void update_solid(TileMap* solid);
 
+  /** Called by tilemaps, after their tiles, size, offset or tileset have changed. */
+  void on_tilemap_changed(const TileMap& tilemap);
+
+  /** Called by tilemaps, after a single tile has changed. */
+  void on_tilemap_tile_changed(const TileMap& tilemap, int x, int y);
+
+  /** Registers a listener, which gets notified about changes to tilemaps.
+      It has to be removed again, before it's destroyed. */
+  void add_tilemap_listener(TileMapListener* listener);
+  void remove_tilemap_listener(TileMapListener* listener);
+
+  /** Called by objects, after they have possibly been modified in the editor. */
+  void on_object_changed(GameObject& object);
+
+  /** Registers a listener, which gets notified about objects being added,
+      removed or changed. It has to be removed again, before it's destroyed. */
+  void add_object_listener(ObjectListener* listener);
+  void remove_object_listener(ObjectListener* listener);
+
+  /** Returns a bitmap, merging the tiles of all static solid tilemaps.
+      It is rebuilt lazily, after tilemaps have been changed. */
+  const SolidTileBitmap& get_solid_tile_bitmap() const;
+
   /** Toggle object change tracking for undo/redo. */
   void toggle_undo_tracking(bool enabled);
   bool undo_tracking_enabled() const { return m_undo_tracking; }
@@ -277,12 +304,19 @@ public:
       Used to save an object's previous state before a change had occurred. */
   void save_object_change(GameObject& object, const std::string& data);
 
+  /** Save a change to the tiles of a tilemap in the undo stack.
+      On undo/redo, it is applied to the tilemap in place. */
+  void save_tile_change(GameObject& tilemap, TileMapDelta delta);
+
   /** Clear undo/redo stacks. */
   void clear_undo_stack();
 
   /** Indicate if there are any object changes in the undo stack. */
   bool has_object_changes() const;
 
+  /** Returns the approximate amount of memory used by the undo and redo stacks, in bytes. */
+  size_t get_undo_stack_memory() const;
+
   /** Called on editor level save. */
   void on_editor_save();
 
@@ -292,10 +326,21 @@ protected:
                                              const Vector& pos, const std::string& direction,
                                              const std::string& data);
 
-  void update_tilemaps();
+  /** Inserts a tilemap into the solid tilemaps, keeping the order of all tilemaps. */
+  void insert_solid_tilemap(TileMap* tilemap);
 
   void process_resolve_requests();
 
+  static void update_parallel_object(GameObject& object, float dt_sec);
+
+  /** Updates the collected parallel-safe objects, on the thread pool if enabled. */
+  void update_parallel_batch(float dt_sec);
+
+  /** Updates the collected parallel-safe objects serially, warning if
+      any of them changes another one, which would make their result
+      depend on the update order. */
+  void check_parallel_batch(float dt_sec);
+
   /** Same as process_resolve_requests(), but those it can't find will be kept in the buffer */
   void try_process_resolve_requests();
 
@@ -317,6 +362,7 @@ private:
     UID uid;
     std::string data;
     bool creation; // If the change represents an object creation.
+    TileMapDelta tiles; // If not empty, only the tiles of a tilemap have changed.
   };
   struct ObjectChanges
   {
@@ -341,8 +387,6 @@ protected:
   bool m_initialized;
 
 private:
-  UIDGenerator m_uid_generator;
-
   /** Undo/redo variables */
   UIDGenerator m_change_uid_generator;
   bool m_undo_tracking;
@@ -363,12 +407,21 @@ private:
   /** Fast access to all tilemaps */
   std::vector<TileMap*> m_all_tilemaps;
 
+  mutable SolidTileBitmap m_solid_tile_bitmap;
+  mutable bool m_solid_tile_bitmap_dirty;
+
+  std::vector<TileMapListener*> m_tilemap_listeners;
+  std::vector<ObjectListener*> m_object_listeners;
+
   std::unordered_map<std::string, GameObject*> m_objects_by_name;
-  std::unordered_map<UID, GameObject*> m_objects_by_uid;
+  UIDTable<GameObject> m_objects_by_uid;
   std::unordered_map<std::type_index, std::vector<GameObject*> > m_objects_by_type_index;
 
   std::vector<NameResolveRequest> m_name_resolve_requests;
 
+  /** Parallel-safe objects to update in the next batch, reused between frames */
+  std::vector<GameObject*> m_parallel_update_objects;
+
 private:
   GameObjectManager(const GameObjectManager&) = delete;
   GameObjectManager& operator=(const GameObjectManager&) = delete;
@@ -16,6 +16,7 @@
 
 #include "supertux/game_session.hpp"
 
+#include <algorithm>
 #include <cfloat>
 
 #include "audio/sound_manager.hpp"
@@ -44,16 +45,63 @@
 #include "supertux/screen_manager.hpp"
 #include "supertux/sector.hpp"
 #include "supertux/shrinkfade.hpp"
+#include "sprite/sprite_manager.hpp"
 #include "util/file_system.hpp"
+#include "util/reader_document.hpp"
+#include "util/string_util.hpp"
 #include "video/compositor.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
+#include "video/texture_manager.hpp"
 #include "worldmap/worldmap.hpp"
 
 static const float SAFE_TIME = 1.0f;
 static const int SHRINKFADE_LAYER = LAYER_LIGHTMAP - 1;
 static const float TELEPORT_FADE_TIME = 1.0f;
 
+static void collect_sprite_files(const sexp::Value& value,
+                                 std::vector<std::string>& sprites,
+                                 std::vector<std::string>& images)
+{
+  if (value.is_array())
+  {
+    for (const auto& item : value.as_array())
+      collect_sprite_files(item, sprites, images);
+  }
+  else if (value.is_string())
+  {
+    const std::string& str = value.as_string();
+    if (StringUtil::has_suffix(str, ".sprite"))
+      sprites.push_back(str);
+    else if (StringUtil::has_suffix(str, ".png") || StringUtil::has_suffix(str, ".jpg"))
+      images.push_back(str);
+  }
+}
+
+/** Returns the images used by the sprites and images referenced by a level.
+    This runs in the background, while the level is loaded on the main thread. */
+static std::vector<std::string> get_level_images(const std::string& levelfile)
+{
+  std::vector<std::string> sprites;
+  std::vector<std::string> images;
+  const auto doc = ReaderDocument::from_file(levelfile);
+  collect_sprite_files(doc.get_sexp(), sprites, images);
+
+  std::sort(sprites.begin(), sprites.end());
+  sprites.erase(std::unique(sprites.begin(), sprites.end()), sprites.end());
+  for (const auto& sprite : sprites)
+  {
+    try
+    {
+      SpriteManager::get_images(sprite, images);
+    }
+    catch (const std::exception&)
+    {
+      // The error is reported once the sprite is actually loaded.
+    }
+  }
+  return images;
+}
 
 GameSession::GameSession(const std::string& levelfile_, Savegame& savegame, Statistics* statistics,
                          bool preserve_music) :
@@ -168,6 +216,15 @@ GameSession::restart_level(bool after_death, bool preserve_music)
     m_levelfile = FileSystem::basename(m_levelfile);
   }
 
+  // Find and decode the images of the level in the background, while
+  // its objects are created and the level intro is shown.
+  if (!m_levelintro_shown)
+  {
+    TextureManager::current()->prefetch_from([levelfile = m_levelfile] {
+        return get_level_images(levelfile);
+      });
+  }
+
   try {
     m_level = LevelParser::from_file(m_levelfile, false, false);
 
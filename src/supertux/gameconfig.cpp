@@ -65,6 +65,9 @@ Config::Config() :
   flash_intensity(50),
   random_seed(0), // Set by time(), by default (unless in config).
   enable_script_debugger(false),
+  cache_compiled_scripts(false),
+  cache_tilesets(true),
+  write_caches(true),
   tux_spawn_pos(),
   locale(),
   keyboard_config(),
@@ -111,6 +114,8 @@ Config::Config() :
   editor_undo_tracking(true),
   editor_undo_stack_size(20),
   editor_show_deprecated_tiles(false),
+  editor_show_minimap(true),
+  editor_progressive_loading(true),
   multiplayer_auto_manage_players(true),
   multiplayer_multibind(false),
 #if SDL_VERSION_ATLEAST(2, 0, 9)
@@ -246,6 +251,8 @@ Config::load()
       editor_undo_stack_size = 1;
     }
     editor_mapping->get("show_deprecated_tiles", editor_show_deprecated_tiles);
+    editor_mapping->get("show_minimap", editor_show_minimap);
+    editor_mapping->get("progressive_loading", editor_progressive_loading);
   }
 
   if (is_christmas()) {
@@ -254,6 +261,8 @@ Config::load()
   config_mapping.get("transitions_enabled", transitions_enabled);
   config_mapping.get("locale", locale);
   config_mapping.get("random_seed", random_seed);
+  config_mapping.get("cache_compiled_scripts", cache_compiled_scripts);
+  config_mapping.get("cache_tilesets", cache_tilesets);
   config_mapping.get("repository_url", repository_url);
 
   config_mapping.get("multiplayer_auto_manage_players", multiplayer_auto_manage_players);
@@ -402,6 +411,8 @@ Config::save()
   }
   writer.write("transitions_enabled", transitions_enabled);
   writer.write("locale", locale);
+  writer.write("cache_compiled_scripts", cache_compiled_scripts);
+  writer.write("cache_tilesets", cache_tilesets);
   writer.write("repository_url", repository_url);
   writer.write("multiplayer_auto_manage_players", multiplayer_auto_manage_players);
   writer.write("multiplayer_multibind", multiplayer_multibind);
@@ -500,6 +511,8 @@ Config::save()
     writer.write("undo_tracking", editor_undo_tracking);
     writer.write("undo_stack_size", editor_undo_stack_size);
     writer.write("show_deprecated_tiles", editor_show_deprecated_tiles);
+    writer.write("show_minimap", editor_show_minimap);
+    writer.write("progressive_loading", editor_progressive_loading);
   }
   writer.end_list("editor");
 
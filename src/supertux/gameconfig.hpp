@@ -80,6 +80,19 @@ public:
 
   bool enable_script_debugger;
 
+  /** write the bytecode of compiled scripts to the user directory and
+      reuse it on the next start */
+  bool cache_compiled_scripts;
+
+  /** write tilesets to the user directory in a binary form, which
+      is faster to load than parsing them, as long as they're unchanged */
+  bool cache_tilesets;
+
+  /** allow writing the caches above, as well as the add-on checksum cache.
+      Not saved, only disabled for processes which must not modify the
+      user directory. */
+  bool write_caches;
+
   /** this variable is set if tux should spawn somewhere which isn't the "main" spawn point*/
   std::optional<Vector> tux_spawn_pos;
 
@@ -145,6 +158,8 @@ public:
   bool editor_undo_tracking;
   int editor_undo_stack_size;
   bool editor_show_deprecated_tiles;
+  bool editor_show_minimap;
+  bool editor_progressive_loading;
 
   bool multiplayer_auto_manage_players;
   bool multiplayer_multibind;
@@ -111,6 +111,14 @@ Level::save(std::ostream& stream)
   save(writer);
 }
 
+void
+Level::save(std::string& data, std::vector<Writer::DeferredTiles>& deferred_tiles)
+{
+  Writer writer(data);
+  writer.set_deferred_tiles(&deferred_tiles);
+  save(writer);
+}
+
 void
 Level::save(const std::string& filepath, bool retry)
 {
@@ -18,11 +18,11 @@
 #define HEADER_SUPERTUX_SUPERTUX_LEVEL_HPP
 
 #include "supertux/statistics.hpp"
+#include "util/writer.hpp"
 
 class Player;
 class ReaderMapping;
 class Sector;
-class Writer;
 
 /** Represents a collection of Sectors running in a single GameSession.
 
@@ -44,6 +44,9 @@ public:
   // saves to a levelfile
   void save(const std::string& filename, bool retry = false);
   void save(std::ostream& stream);
+  /** Saves into the string, with tile arrays copied into the list
+      instead of formatted. See Writer::write_deferred(). */
+  void save(std::string& data, std::vector<Writer::DeferredTiles>& deferred_tiles);
 
   void add_sector(std::unique_ptr<Sector> sector);
   const std::string& get_name() const { return m_name; }
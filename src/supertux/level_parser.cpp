@@ -16,6 +16,7 @@
 
 #include "supertux/level_parser.hpp"
 
+#include <chrono>
 #include <physfs.h>
 #include <sstream>
 
@@ -72,6 +73,18 @@ LevelParser::from_file(const std::string& filename, bool worldmap, bool editable
   return level;
 }
 
+std::unique_ptr<Level>
+LevelParser::from_document_deferred(const ReaderDocument& doc, bool worldmap, bool editable,
+                                    std::vector<DeferredObjects>& deferred_objects)
+{
+  auto level = std::make_unique<Level>(worldmap);
+  LevelParser parser(*level, worldmap, editable, &deferred_objects);
+  level->m_filename = doc.get_filename();
+  register_translation_directory(doc.get_filename());
+  parser.load(doc);
+  return level;
+}
+
 std::unique_ptr<Level>
 LevelParser::from_nothing(const std::string& basedir)
 {
@@ -115,10 +128,12 @@ LevelParser::from_nothing_worldmap(const std::string& basedir, const std::string
   return level;
 }
 
-LevelParser::LevelParser(Level& level, bool worldmap, bool editable) :
+LevelParser::LevelParser(Level& level, bool worldmap, bool editable,
+                         std::vector<DeferredObjects>* deferred_objects) :
   m_level(level),
   m_worldmap(worldmap),
-  m_editable(editable)
+  m_editable(editable),
+  m_deferred_objects(deferred_objects)
 {
 }
 
@@ -135,7 +150,11 @@ LevelParser::load(const std::string& filepath)
   m_level.m_filename = filepath;
   register_translation_directory(filepath);
   try {
+    const auto start = std::chrono::steady_clock::now();
     auto doc = ReaderDocument::from_file(filepath);
+    log_debug << "Parsed level '" << filepath << "' in "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+              << "ms" << std::endl;
     load(doc);
   } catch(std::exception& e) {
     std::stringstream msg;
@@ -178,8 +197,19 @@ LevelParser::load(const ReaderDocument& doc)
     {
       if (iter.get_key() == "sector")
       {
-        auto sector = SectorParser::from_reader(m_level, iter.as_mapping(), m_editable);
-        m_level.add_sector(std::move(sector));
+        if (m_deferred_objects)
+        {
+          std::vector<ReaderObject> objects;
+          auto sector = SectorParser::from_reader_deferred(m_level, iter.as_mapping(), m_editable, objects);
+          Sector* sector_ptr = sector.get();
+          m_level.add_sector(std::move(sector));
+          m_deferred_objects->push_back({ sector_ptr, std::move(objects) });
+        }
+        else
+        {
+          auto sector = SectorParser::from_reader(m_level, iter.as_mapping(), m_editable);
+          m_level.add_sector(std::move(sector));
+        }
       }
     }
 
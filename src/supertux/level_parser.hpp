@@ -19,23 +19,42 @@
 
 #include <memory>
 #include <string>
+#include <vector>
+
+#include "util/reader_object.hpp"
 
 class Level;
 class ReaderDocument;
 class ReaderMapping;
+class Sector;
 
 class LevelParser final
 {
+public:
+  /** Objects of a sector, whose construction has been deferred */
+  struct DeferredObjects
+  {
+    Sector* sector;
+    std::vector<ReaderObject> objects;
+  };
+
 public:
   static std::unique_ptr<Level> from_stream(std::istream& stream, const std::string& context, bool worldmap, bool editable);
   static std::unique_ptr<Level> from_file(const std::string& filename, bool worldmap, bool editable);
+
+  /** Loads a level from an already parsed file. The construction of objects, which
+      aren't needed to display the sectors, is deferred (see SectorParser::from_reader_deferred()).
+      The document has to be kept around until all deferred objects have been constructed. */
+  static std::unique_ptr<Level> from_document_deferred(const ReaderDocument& doc, bool worldmap, bool editable,
+                                                       std::vector<DeferredObjects>& deferred_objects);
   static std::unique_ptr<Level> from_nothing(const std::string& basedir);
   static std::unique_ptr<Level> from_nothing_worldmap(const std::string& basedir, const std::string& name);
 
   static std::string get_level_name(const std::string& filename);
 
 private:
-  LevelParser(Level& level, bool worldmap, bool editable);
+  LevelParser(Level& level, bool worldmap, bool editable,
+              std::vector<DeferredObjects>* deferred_objects = nullptr);
 
   void load(const ReaderDocument& doc);
   void load(std::istream& stream, const std::string& context);
@@ -47,6 +66,7 @@ private:
   Level& m_level;
   bool m_worldmap;
   bool m_editable;
+  std::vector<DeferredObjects>* m_deferred_objects;
 
 private:
   LevelParser(const LevelParser&) = delete;
@@ -0,0 +1,259 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/level_resaver.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <fmt/format.h>
+
+#include "editor/editor.hpp"
+#include "supertux/game_object.hpp"
+#include "supertux/level.hpp"
+#include "supertux/level_parser.hpp"
+#include "supertux/sector.hpp"
+#include "util/log.hpp"
+#include "util/reader_collection.hpp"
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
+#include "util/reader_object.hpp"
+#include "util/string_util.hpp"
+#include "util/writer.hpp"
+
+namespace {
+
+float get_elapsed_ms(const std::chrono::steady_clock::time_point& start)
+{
+  return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+LevelResaver::Result::Result() :
+  filename(),
+  parse_time(0.0f),
+  save_time(0.0f),
+  changed(false),
+  outdated_objects(),
+  versions_updated(false),
+  error()
+{
+}
+
+LevelResaver::Result
+LevelResaver::resave(const std::string& filename, bool update_versions)
+{
+  Result result;
+  result.filename = filename;
+  result.versions_updated = update_versions;
+
+  Editor::s_resaving_in_progress = true;
+  try
+  {
+    std::string original;
+    {
+      std::ifstream in(filename, std::ios::binary);
+      if (!in)
+        throw std::runtime_error("Couldn't open file for reading");
+
+      std::ostringstream buffer;
+      buffer << in.rdbuf();
+      original = buffer.str();
+    }
+
+    log_info << "loading level: " << filename << std::endl;
+
+    auto start = std::chrono::steady_clock::now();
+    std::istringstream in(original);
+    auto level = LevelParser::from_stream(in, filename, StringUtil::has_suffix(filename, ".stwm"), true);
+    result.parse_time = get_elapsed_ms(start);
+
+    for (const auto& sector : level->get_sectors())
+    {
+      for (const auto& object : sector->get_objects())
+      {
+        if (object->is_up_to_date())
+          continue;
+
+        result.outdated_objects.push_back(fmt::format("{}: {} '{}' v{} -> v{}", sector->get_name(),
+                                                      object->get_class_name(), object->get_name(),
+                                                      object->get_version(), object->get_latest_version()));
+        if (update_versions)
+          object->update_version();
+      }
+    }
+
+    log_info << "saving level: " << filename << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    std::ostringstream out;
+    level->save(out);
+
+    const std::string data = out.str();
+    result.changed = (data != original);
+    if (result.changed)
+    {
+      std::ofstream file(filename, std::ios::binary);
+      file << data;
+      if (!file)
+        throw std::runtime_error("Couldn't write file");
+    }
+    result.save_time = get_elapsed_ms(start);
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << filename << ": couldn't resave level: " << err.what() << std::endl;
+    result.error = err.what();
+  }
+  Editor::s_resaving_in_progress = false;
+
+  return result;
+}
+
+void
+LevelResaver::save_results(const std::string& filename, const std::vector<Result>& results)
+{
+  // The results are saved again after each level, so they are written to a
+  // temporary file first. A crash while writing then keeps the previous ones.
+  const std::string part_filename = filename + ".part";
+  {
+    std::ofstream file(part_filename);
+    if (!file)
+      throw std::runtime_error("Couldn't open '" + part_filename + "' for writing");
+
+    Writer writer(file);
+    writer.start_list("supertux-resave-results");
+    for (const auto& result : results)
+    {
+      writer.start_list("level");
+      writer.write("file", result.filename);
+      writer.write("parse-time", result.parse_time);
+      writer.write("save-time", result.save_time);
+      writer.write("changed", result.changed);
+      writer.write("outdated-objects", result.outdated_objects);
+      writer.write("versions-updated", result.versions_updated);
+      if (!result.error.empty())
+        writer.write("error", result.error);
+      writer.end_list("level");
+    }
+    writer.end_list("supertux-resave-results");
+
+    file.flush();
+    if (!file)
+      throw std::runtime_error("Couldn't write '" + part_filename + "'");
+  }
+
+  std::error_code ec;
+  std::filesystem::rename(part_filename, filename, ec);
+  if (ec)
+    throw std::runtime_error("Couldn't rename '" + part_filename + "' to '" + filename + "': " + ec.message());
+}
+
+std::vector<LevelResaver::Result>
+LevelResaver::load_results(const std::string& filename)
+{
+  std::ifstream file(filename);
+  if (!file)
+    throw std::runtime_error("Couldn't open '" + filename + "' for reading");
+
+  auto doc = ReaderDocument::from_stream(file, filename);
+  auto root = doc.get_root();
+  if (root.get_name() != "supertux-resave-results")
+    throw std::runtime_error(filename + ": not a 'supertux-resave-results' file");
+
+  std::vector<Result> results;
+  for (const auto& object : root.get_collection().get_objects())
+  {
+    if (object.get_name() != "level")
+      continue;
+
+    const auto mapping = object.get_mapping();
+
+    Result result;
+    mapping.get("file", result.filename);
+    mapping.get("parse-time", result.parse_time);
+    mapping.get("save-time", result.save_time);
+    mapping.get("changed", result.changed);
+    mapping.get("outdated-objects", result.outdated_objects);
+    mapping.get("versions-updated", result.versions_updated);
+    mapping.get("error", result.error);
+    results.push_back(std::move(result));
+  }
+  return results;
+}
+
+void
+LevelResaver::write_report(std::ostream& out, const std::vector<Result>& results)
+{
+  size_t changed = 0;
+  size_t outdated = 0;
+  size_t failed = 0;
+  float parse_time = 0.0f;
+  float save_time = 0.0f;
+  for (const auto& result : results)
+  {
+    if (!result.error.empty())
+    {
+      failed += 1;
+      continue;
+    }
+
+    changed += result.changed ? 1 : 0;
+    outdated += result.outdated_objects.empty() ? 0 : 1;
+    parse_time += result.parse_time;
+    save_time += result.save_time;
+  }
+
+  out << "SuperTux level resave report\n"
+      << fmt::format("Levels: {}, changed: {}, with outdated objects: {}, failed: {}\n",
+                     results.size(), changed, outdated, failed)
+      << fmt::format("Total parse time: {:.1f}ms, total save time: {:.1f}ms\n", parse_time, save_time)
+      << "\n";
+
+  for (const auto& result : results)
+  {
+    if (!result.error.empty())
+    {
+      out << result.filename << ": failed: " << result.error << "\n";
+      continue;
+    }
+
+    out << fmt::format("{}: parsed in {:.1f}ms, saved in {:.1f}ms, {}\n", result.filename,
+                       result.parse_time, result.save_time, result.changed ? "changed" : "unchanged");
+    for (const auto& object : result.outdated_objects)
+      out << "  " << (result.versions_updated ? "updated " : "outdated ") << object << "\n";
+  }
+}
+
+void
+LevelResaver::write_report_file(const std::string& filename, const std::vector<Result>& results)
+{
+  std::ofstream out(filename);
+  if (!out)
+  {
+    log_warning << filename << ": couldn't open file for writing" << std::endl;
+  }
+  else
+  {
+    write_report(out, results);
+  }
+}
+
+/* EOF */
@@ -0,0 +1,77 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_LEVEL_RESAVER_HPP
+#define HEADER_SUPERTUX_SUPERTUX_LEVEL_RESAVER_HPP
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/** Loads levels and saves them again, migrating them to the current
+    file format, and records what has been done for a report. */
+class LevelResaver final
+{
+public:
+  struct Result
+  {
+    Result();
+
+    std::string filename;
+
+    /** Time taken to load and save the level, in milliseconds */
+    float parse_time;
+    float save_time;
+
+    /** True, if the saved level differs from the original file */
+    bool changed;
+
+    /** Objects, which weren't on their latest version, e.g.
+        "main: weak_block 'ice' v1 -> v2". */
+    std::vector<std::string> outdated_objects;
+    bool versions_updated;
+
+    /** Non-empty, if the level couldn't be resaved */
+    std::string error;
+  };
+
+public:
+  /** Resaves the level at the given path on the native filesystem.
+      The file is only written, if its contents have changed. If requested,
+      outdated objects are updated to their latest version first. */
+  static Result resave(const std::string& filename, bool update_versions);
+
+  /** Saves and loads results, to pass them on between processes.
+      Saving replaces the file atomically, so it can be repeated after
+      each level, without a crash leaving a truncated file behind. */
+  static void save_results(const std::string& filename, const std::vector<Result>& results);
+  static std::vector<Result> load_results(const std::string& filename);
+
+  /** Writes a human-readable report of the results. */
+  static void write_report(std::ostream& out, const std::vector<Result>& results);
+
+  /** Writes the report to a file on the native filesystem. If the file
+      can't be opened, a warning is logged instead. */
+  static void write_report_file(const std::string& filename, const std::vector<Result>& results);
+
+private:
+  LevelResaver() = delete;
+};
+
+#endif
+
+/* EOF */
@@ -56,6 +56,7 @@ extern "C" {
 #include "sdk/integration.hpp"
 #include "sprite/sprite_data.hpp"
 #include "sprite/sprite_manager.hpp"
+#include "supertux/batch_resaver.hpp"
 #include "supertux/command_line_arguments.hpp"
 #include "supertux/constants.hpp"
 #include "supertux/console.hpp"
@@ -69,6 +70,7 @@ extern "C" {
 #include "supertux/player_status.hpp"
 #include "supertux/resources.hpp"
 #include "supertux/savegame.hpp"
+#include "supertux/savegame_writer.hpp"
 #include "supertux/screen_fade.hpp"
 #include "supertux/screen_manager.hpp"
 #include "supertux/sector.hpp"
@@ -92,8 +94,9 @@ extern "C" {
 
 static Timelog s_timelog;
 
-ConfigSubsystem::ConfigSubsystem() :
-  m_config()
+ConfigSubsystem::ConfigSubsystem(bool save_on_exit) :
+  m_config(),
+  m_save_on_exit(save_on_exit)
 {
   g_config = &m_config;
   try {
@@ -113,6 +116,9 @@ ConfigSubsystem::ConfigSubsystem() :
 
 ConfigSubsystem::~ConfigSubsystem()
 {
+  if (!m_save_on_exit)
+    return;
+
   try
   {
     m_config.save();
@@ -128,6 +134,8 @@ Main::Main() :
   m_config_subsystem(),
   m_sdl_subsystem(),
   m_console_buffer(),
+  m_thread_pool(),
+  m_savegame_writer(),
   m_input_manager(),
   m_video_system(),
   m_ttf_surface_manager(),
@@ -475,26 +483,19 @@ Main::init_video()
 }
 
 void
-Main::resave(const std::string& input_filename, const std::string& output_filename)
+Main::write_resave_results(const CommandLineArguments& args, const std::vector<LevelResaver::Result>& results)
 {
-  Editor::s_resaving_in_progress = true;
-  std::ifstream in(input_filename);
-  if (!in) {
-    log_fatal << input_filename << ": couldn't open file for reading" << std::endl;
-  } else {
-    log_info << "loading level: " << input_filename << std::endl;
-    auto level = LevelParser::from_stream(in, input_filename, StringUtil::has_suffix(input_filename, ".stwm"), true);
-    in.close();
-
-    std::ofstream out(output_filename);
-    if (!out) {
-      log_fatal << output_filename << ": couldn't open file for writing" << std::endl;
-    } else {
-      log_info << "saving level: " << output_filename << std::endl;
-      level->save(out);
-    }
+  if (!args.resave_results)
+    return;
+
+  try
+  {
+    LevelResaver::save_results(*args.resave_results, results);
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't save resave results: " << err.what() << std::endl;
   }
-  Editor::s_resaving_in_progress = false;
 }
 
 void
@@ -509,6 +510,8 @@ Main::launch_game(const CommandLineArguments& args)
 
   m_sdl_subsystem.reset(new SDLSubsystem());
   m_console_buffer.reset(new ConsoleBuffer());
+  m_thread_pool.reset(new ThreadPool());
+  m_savegame_writer.reset(new SavegameWriter());
 #ifdef ENABLE_TOUCHSCREEN_SUPPORT
   if (getenv("ANDROID_TV")) {
     g_config->mobile_controls = false;
@@ -570,6 +573,7 @@ Main::launch_game(const CommandLineArguments& args)
 
   if (!args.filenames.empty())
   {
+    std::vector<LevelResaver::Result> resave_results;
     for(const auto& start_level : args.filenames)
     {
       // we have a normal path specified at commandline, not a physfs path.
@@ -586,7 +590,11 @@ Main::launch_game(const CommandLineArguments& args)
 
       if (args.resave && *args.resave)
       {
-        resave(start_level, start_level);
+        resave_results.push_back(LevelResaver::resave(start_level, args.update_versions.value_or(false)));
+
+        // The results are written after each level, so if a later level
+        // crashes the worker, only that level is reported as failed.
+        write_resave_results(args, resave_results);
       }
       else if (args.editor)
       {
@@ -636,6 +644,9 @@ Main::launch_game(const CommandLineArguments& args)
         m_screen_manager->push_screen(std::move(session));
       }
     }
+
+    if (args.resave && *args.resave && args.resave_report)
+      LevelResaver::write_report_file(*args.resave_report, resave_results);
   }
   else
   {
@@ -714,8 +725,12 @@ Main::run(int argc, char** argv)
     m_physfs_subsystem->print_search_path();
 
     s_timelog.log("config");
-    m_config_subsystem.reset(new ConfigSubsystem());
+    // Worker processes of a batch resave run in parallel, so they must not overwrite the config,
+    // nor any of the cache files in the user directory.
+    m_config_subsystem.reset(new ConfigSubsystem(!args.resave_results));
     args.merge_into(*g_config);
+    if (args.resave_results)
+      g_config->write_caches = false;
 
     s_timelog.log("tinygettext");
     init_tinygettext();
@@ -738,7 +753,16 @@ Main::run(int argc, char** argv)
         return 0;
 
       default:
-        launch_game(args);
+        if (args.resave_directory)
+        {
+          // Levels are resaved by worker processes, so nothing else has to be set up.
+          if (!BatchResaver::run(argv[0], args))
+            result = 1;
+        }
+        else
+        {
+          launch_game(args);
+        }
         break;
     }
   }
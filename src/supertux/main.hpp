@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "addon/addon_manager.hpp"
 #include "audio/sound_manager.hpp"
@@ -30,23 +31,27 @@
 #include "supertux/console.hpp"
 #include "supertux/game_manager.hpp"
 #include "supertux/gameconfig.hpp"
+#include "supertux/level_resaver.hpp"
 #include "supertux/player_status.hpp"
 #include "supertux/profile_manager.hpp"
 #include "supertux/resources.hpp"
 #include "supertux/savegame.hpp"
+#include "supertux/savegame_writer.hpp"
 #include "supertux/screen_manager.hpp"
 #include "supertux/tile_manager.hpp"
 #include "supertux/tile_set.hpp"
+#include "util/thread_pool.hpp"
 #include "video/ttf_surface_manager.hpp"
 
 class ConfigSubsystem final
 {
 public:
-  ConfigSubsystem();
+  ConfigSubsystem(bool save_on_exit = true);
   ~ConfigSubsystem();
 
 private:
   Config m_config;
+  bool m_save_on_exit;
 };
 
 class PhysfsSubsystem final
@@ -98,7 +103,7 @@ private:
   void init_video();
 
   void launch_game(const CommandLineArguments& args);
-  void resave(const std::string& input_filename, const std::string& output_filename);
+  void write_resave_results(const CommandLineArguments& args, const std::vector<LevelResaver::Result>& results);
   void release_check();
 
 private:
@@ -107,6 +112,8 @@ private:
   std::unique_ptr<ConfigSubsystem> m_config_subsystem;
   std::unique_ptr<SDLSubsystem> m_sdl_subsystem;
   std::unique_ptr<ConsoleBuffer> m_console_buffer;
+  std::unique_ptr<ThreadPool> m_thread_pool;
+  std::unique_ptr<SavegameWriter> m_savegame_writer;
   std::unique_ptr<InputManager> m_input_manager;
   std::unique_ptr<VideoSystem> m_video_system;
   std::unique_ptr<TTFSurfaceManager> m_ttf_surface_manager;
@@ -66,6 +66,9 @@ AddonBrowseMenu::refresh()
 void
 AddonBrowseMenu::rebuild_menu()
 {
+  // The checksums of installed add-ons are needed to detect updates.
+  m_addon_manager.finish_md5_updates();
+
   clear();
   add_label(m_langpacks_only ? _("Browse Language Packs") : _("Browse Add-ons"));
   add_hl();
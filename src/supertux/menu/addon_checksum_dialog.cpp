@@ -0,0 +1,59 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/menu/addon_checksum_dialog.hpp"
+
+#include <fmt/format.h>
+
+#include "addon/addon_manager.hpp"
+#include "gui/menu.hpp"
+#include "gui/menu_manager.hpp"
+
+AddonChecksumDialog::AddonChecksumDialog() :
+  m_addon_manager(*AddonManager::current())
+{
+  add_cancel_button(_("Back"), []() {
+    MenuManager::instance().pop_menu();
+  });
+
+  update_text();
+}
+
+void
+AddonChecksumDialog::update()
+{
+  if (m_addon_manager.is_computing_md5s())
+  {
+    update_text();
+    return;
+  }
+
+  if (Menu* menu = MenuManager::instance().current_menu())
+    menu->refresh();
+
+  // Closing the dialog may destroy it, so this has to come last.
+  MenuManager::instance().set_dialog({});
+}
+
+void
+AddonChecksumDialog::update_text()
+{
+  const int percent = static_cast<int>(m_addon_manager.get_md5_progress() * 100.0f);
+  set_text(fmt::format(fmt::runtime(_("Checking installed add-ons...\n{}%")), percent));
+}
+
+/* EOF */
@@ -0,0 +1,48 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_MENU_ADDON_CHECKSUM_DIALOG_HPP
+#define HEADER_SUPERTUX_SUPERTUX_MENU_ADDON_CHECKSUM_DIALOG_HPP
+
+#include "gui/dialog.hpp"
+
+class AddonManager;
+
+/** Shows the progress of computing the checksums of installed add-ons
+    in the background. Once done, it closes and refreshes the current
+    menu, which needs the checksums to detect updates. */
+class AddonChecksumDialog final : public Dialog
+{
+public:
+  AddonChecksumDialog();
+
+  void update() override;
+
+private:
+  void update_text();
+
+private:
+  AddonManager& m_addon_manager;
+
+private:
+  AddonChecksumDialog(const AddonChecksumDialog&) = delete;
+  AddonChecksumDialog& operator=(const AddonChecksumDialog&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -24,6 +24,7 @@
 #include "gui/menu_item.hpp"
 #include "gui/menu_manager.hpp"
 #include "supertux/menu/addon_browse_menu.hpp"
+#include "supertux/menu/addon_checksum_dialog.hpp"
 #include "supertux/menu/addon_file_install_menu.hpp"
 #include "supertux/menu/addon_preview_menu.hpp"
 #include "supertux/menu/download_dialog.hpp"
@@ -65,6 +66,23 @@ void
 AddonMenu::rebuild_menu()
 {
   clear();
+
+  // The checksums of installed add-ons are needed to detect updates.
+  // While they are computed, their progress is shown instead, and the
+  // menu is rebuilt once they are done.
+  if (m_addon_manager.is_computing_md5s())
+  {
+    add_label(m_langpacks_only ? _("Installed Language Packs") : _("Installed Add-ons"));
+    add_hl();
+    add_inactive(_("Checking installed add-ons..."));
+    add_hl();
+    add_back(_("Back"));
+
+    MenuManager::instance().set_dialog(std::make_unique<AddonChecksumDialog>());
+    return;
+  }
+  m_addon_manager.finish_md5_updates();
+
   add_label(m_langpacks_only ? _("Installed Language Packs") : _("Installed Add-ons"));
   add_hl();
 
@@ -21,6 +21,8 @@
 
 #include "editor/editor.hpp"
 #include "gui/item_stringselect.hpp"
+#include "squirrel/squirrel_script_cache.hpp"
+#include "squirrel/squirrel_virtual_machine.hpp"
 #include "supertux/debug.hpp"
 #include "supertux/gameconfig.hpp"
 #include "supertux/globals.hpp"
@@ -72,7 +74,10 @@ DebugMenu::DebugMenu() :
              []{ return g_debug.get_use_bitmap_fonts(); },
              [](bool value){ g_debug.set_use_bitmap_fonts(value); });
   add_toggle(-1, _("Show Tile IDs in Editor Toolbox"), &g_debug.show_toolbox_tile_ids);
+  add_toggle(-1, _("Parallel Object Updates"), &g_debug.parallel_object_updates);
+  add_toggle(-1, _("Check Parallel Update Order"), &g_debug.check_parallel_update_order);
   add_entry(_("Dump Texture Cache"), []{ TextureManager::current()->debug_print(get_logging_instance()); });
+  add_entry(_("Dump Script Cache"), []{ SquirrelVirtualMachine::current()->get_script_cache().debug_print(get_logging_instance()); });
 
   add_hl();
   add_back(_("Back"));
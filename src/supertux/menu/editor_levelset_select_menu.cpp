@@ -45,7 +45,7 @@ EditorLevelsetSelectMenu::~EditorLevelsetSelectMenu()
   if (editor == nullptr) {
     return;
   }
-  if (!editor->is_level_loaded() && !editor->m_reload_request) {
+  if (!editor->is_level_loaded() && !editor->m_reload_request && !editor->is_loading_level()) {
     editor->m_quit_request = true;
   } else {
     editor->m_reactivate_request = true;
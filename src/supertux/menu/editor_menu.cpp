@@ -16,10 +16,13 @@
 
 #include "supertux/menu/editor_menu.hpp"
 
+#include <fmt/format.h>
 #include <physfs.h>
 
 #include "editor/editor.hpp"
+#include "editor/object_search_menu.hpp"
 #include "gui/dialog.hpp"
+#include "gui/item_intfield.hpp"
 #include "gui/item_action.hpp"
 #include "gui/item_goto.hpp"
 #include "gui/item_toggle.hpp"
@@ -84,6 +87,8 @@ EditorMenu::refresh()
 
   add_submenu(_("Convert Tiles"), MenuStorage::EDITOR_CONVERTERS_MENU)
     .set_help(_("Convert all tiles in the level using converters."));
+  add_entry(MNID_FINDOBJECTS, _("Find Objects"))
+    .set_help(_("Search the objects of the current sector by class, name and position."));
 
   add_hl();
 
@@ -92,12 +97,17 @@ EditorMenu::refresh()
   add_toggle(-1, _("Grid Snapping"), &(g_config->editor_snap_to_grid));
   add_toggle(-1, _("Render Background"), &(g_config->editor_render_background));
   add_toggle(-1, _("Render Light"), &(Compositor::s_render_lighting));
+  add_toggle(-1, _("Show Minimap"), &(g_config->editor_show_minimap));
+  add_toggle(-1, _("Load Levels Progressively"), &(g_config->editor_progressive_loading))
+    .set_help(_("Show levels while their objects are still being loaded."));
   add_toggle(-1, _("Autotile Mode"), &(g_config->editor_autotile_mode));
   add_toggle(-1, _("Enable Autotile Help"), &(g_config->editor_autotile_help));
   add_toggle(-1, _("Enable Object Undo Tracking"), &(g_config->editor_undo_tracking));
   if (g_config->editor_undo_tracking)
   {
-    add_intfield(_("Undo Stack Size"), &(g_config->editor_undo_stack_size), -1, true);
+    add_intfield(_("Undo Stack Size"), &(g_config->editor_undo_stack_size), -1, true)
+      .set_help(fmt::format(fmt::runtime(_("Memory used by the undo history: {} KiB")),
+                            (Editor::current()->get_undo_stack_memory() + 1023) / 1024));
   }
   add_intfield(_("Autosave Frequency"), &(g_config->editor_autosave_frequency));
 
@@ -191,6 +201,10 @@ EditorMenu::menu_action(MenuItem& item)
       MenuManager::instance().push_menu(MenuStorage::OPTIONS_MENU);
       break;
 
+    case MNID_FINDOBJECTS:
+      MenuManager::instance().push_menu(std::make_unique<ObjectSearchMenu>());
+      break;
+
     case MNID_SHARE:
     {
       Dialog::show_confirmation(_("We encourage you to share your levels in the SuperTux forum.\nTo find your level, click the\n\"Open Level directory\" menu item.\nDo you want to go to the forum now?"), [] {
@@ -202,7 +216,7 @@ EditorMenu::menu_action(MenuItem& item)
 	case MNID_HELP:
     {
       auto dialog = std::make_unique<Dialog>();
-      dialog->set_text(_("Keyboard Shortcuts:\n---------------------\nEsc = Open Menu\nCtrl+S = Save\nCtrl+T = Test\nCtrl+Z = Undo\nCtrl+Y = Redo\nF6 = Render Light\nF7 = Grid Snapping\nF8 = Show Grid\nCtrl++ or Ctrl+Scroll Up = Zoom In\nCtrl+- or Ctrl+Scroll Down = Zoom Out\nCtrl+D = Reset Zoom\n\nScripting Shortcuts:\n    -------------    \nHome = Go to beginning of line\nEnd = Go to end of line\nLeft arrow = Go back in text\nRight arrow = Go forward in text\nBackspace = Delete in front of text cursor\nDelete = Delete behind text cursor\nCtrl+X = Cut whole line\nCtrl+C = Copy whole line\nCtrl+V = Paste\nCtrl+D = Duplicate line\nCtrl+Z = Undo\nCtrl+Y = Redo"));
+      dialog->set_text(_("Keyboard Shortcuts:\n---------------------\nEsc = Open Menu\nCtrl+S = Save\nCtrl+T = Test\nCtrl+Z = Undo\nCtrl+Y = Redo\nCtrl+F = Find Objects\nF3 / Shift+F3 = Next / Previous Match\nF6 = Render Light\nF7 = Grid Snapping\nF8 = Show Grid\nCtrl++ or Ctrl+Scroll Up = Zoom In\nCtrl+- or Ctrl+Scroll Down = Zoom Out\nCtrl+D = Reset Zoom\n\nScripting Shortcuts:\n    -------------    \nHome = Go to beginning of line\nEnd = Go to end of line\nLeft arrow = Go back in text\nRight arrow = Go forward in text\nBackspace = Delete in front of text cursor\nDelete = Delete behind text cursor\nCtrl+X = Cut whole line\nCtrl+C = Copy whole line\nCtrl+V = Paste\nCtrl+D = Duplicate line\nCtrl+Z = Undo\nCtrl+Y = Redo"));
       dialog->add_cancel_button(_("Got it!"));
       MenuManager::instance().set_dialog(std::move(dialog));
     }
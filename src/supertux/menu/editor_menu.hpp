@@ -36,7 +36,8 @@ private:
     MNID_LEVELSETSEL,
 	  MNID_HELP,
     MNID_QUITEDITOR,
-    MNID_CHECKDEPRECATEDTILES
+    MNID_CHECKDEPRECATEDTILES,
+    MNID_FINDOBJECTS
   };
 
 public:
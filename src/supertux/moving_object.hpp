@@ -73,6 +73,7 @@ public:
   virtual void move(const Vector& dist)
   {
     m_col.m_bbox.move(dist);
+    m_col.invalidate_spatial_index();
   }
 
   virtual bool listener_is_valid() const override { return is_valid(); }
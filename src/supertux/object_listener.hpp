@@ -0,0 +1,43 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_OBJECT_LISTENER_HPP
+#define HEADER_SUPERTUX_SUPERTUX_OBJECT_LISTENER_HPP
+
+class GameObject;
+
+/** Gets notified about the objects of a GameObjectManager. */
+class ObjectListener
+{
+public:
+  virtual ~ObjectListener()
+  {}
+
+  /** Called when an object is added to the manager. */
+  virtual void object_added(GameObject& object) = 0;
+
+  /** Called when an object is removed, before it's destroyed. */
+  virtual void object_removed(GameObject& object) = 0;
+
+  /** Called after an object has possibly been modified in the editor,
+      i.e. whenever GameObject::check_state() is called. */
+  virtual void object_changed(GameObject& object) = 0;
+};
+
+#endif
+
+/* EOF */
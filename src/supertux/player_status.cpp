@@ -115,8 +115,14 @@ PlayerStatus::add_coins(int count, bool play_sound)
   }
 }
 
+std::unique_ptr<PlayerStatus>
+PlayerStatus::clone() const
+{
+  return std::unique_ptr<PlayerStatus>(new PlayerStatus(*this));
+}
+
 void
-PlayerStatus::write(Writer& writer)
+PlayerStatus::write(Writer& writer) const
 {
   writer.write("num_players", m_num_players);
 
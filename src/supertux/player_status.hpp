@@ -44,7 +44,11 @@ public:
   void add_coins(int count, bool play_sound = true);
   void take_checkpoint_coins();
 
-  void write(Writer& writer);
+  /** Returns a copy, which doesn't preload any sounds on creation
+      and can thus be written from another thread. */
+  std::unique_ptr<PlayerStatus> clone() const;
+
+  void write(Writer& writer) const;
   void read(const ReaderMapping& mapping);
 
   int get_max_coins() const;
@@ -74,7 +78,7 @@ public:
   std::string title_level; /**< level to be used for the title screen, overrides the value of the same property for the world */
 
 private:
-  PlayerStatus(const PlayerStatus&) = delete;
+  PlayerStatus(const PlayerStatus&) = default;
   PlayerStatus& operator=(const PlayerStatus&) = delete;
 };
 
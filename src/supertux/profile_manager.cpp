@@ -21,6 +21,7 @@
 #include "physfs/util.hpp"
 #include "supertux/gameconfig.hpp"
 #include "supertux/globals.hpp"
+#include "supertux/savegame_writer.hpp"
 
 ProfileManager::ProfileManager() :
   m_profiles()
@@ -68,6 +69,10 @@ ProfileManager::get_profiles()
 void
 ProfileManager::reset_profile(int id)
 {
+  // Don't let a pending save recreate the removed savegames.
+  if (SavegameWriter::current())
+    SavegameWriter::current()->flush();
+
   physfsutil::remove_content("profile" + std::to_string(id));
 
   get_profile(id).reset();
@@ -76,6 +81,10 @@ ProfileManager::reset_profile(int id)
 void
 ProfileManager::delete_profile(int id)
 {
+  // Don't let a pending save recreate the removed savegames.
+  if (SavegameWriter::current())
+    SavegameWriter::current()->flush();
+
   physfsutil::remove_with_content("profile" + std::to_string(id));
 
   auto it = m_profiles.find(id);
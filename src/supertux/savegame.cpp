@@ -27,11 +27,11 @@
 #include "squirrel/squirrel_virtual_machine.hpp"
 #include "supertux/player_status.hpp"
 #include "supertux/profile_manager.hpp"
+#include "supertux/savegame_writer.hpp"
 #include "util/file_system.hpp"
 #include "util/log.hpp"
 #include "util/reader_document.hpp"
 #include "util/reader_mapping.hpp"
-#include "util/writer.hpp"
 #include "worldmap/worldmap.hpp"
 
 namespace {
@@ -154,6 +154,11 @@ Savegame::load(bool base_data)
 
   const std::string filename = get_filename();
 
+  // Make sure a save still in progress doesn't get lost.
+  if (SavegameWriter::current())
+    SavegameWriter::current()->flush();
+  SavegameWriter::recover(filename);
+
   if (!PHYSFS_exists(filename.c_str()))
   {
     log_info << filename << " doesn't exist, not loading state" << std::endl;
@@ -240,10 +245,10 @@ Savegame::save()
 
   m_profile.save(); // Make sure profile directory exists, save profile info
 
-  Writer writer(filename);
-
-  writer.start_list("supertux-savegame");
-  writer.write("version", 1);
+  // Only capture the state here, as it can't be accessed from another thread.
+  // Serializing and writing it is left to the SavegameWriter.
+  auto snapshot = std::make_unique<SavegameWriter::Snapshot>();
+  snapshot->filename = filename;
 
   using namespace worldmap;
   if (WorldMap::current() != nullptr)
@@ -252,24 +257,26 @@ Savegame::save()
     title << WorldMap::current()->get_title();
     title << " (" << WorldMap::current()->solved_level_count()
           << "/" << WorldMap::current()->level_count() << ")";
-    writer.write("title", title.str());
+    snapshot->title = title.str();
   }
 
-  writer.start_list("tux");
-  m_player_status->write(writer);
-  writer.end_list("tux");
+  snapshot->player_status = m_player_status->clone();
 
-  writer.start_list("state");
   try
   {
-    save_squirrel_table(m_state_table, writer);
+    snapshot->state = snapshot_squirrel_table(m_state_table);
   }
-  catch(const std::exception&)
+  catch(const std::exception& err)
   {
+    // Keep the previous savegame, rather than replacing it with a partial state.
+    log_warning << "Couldn't capture savegame state: " << err.what() << std::endl;
+    return;
   }
-  writer.end_list("state");
 
-  writer.end_list("supertux-savegame");
+  if (SavegameWriter::current())
+    SavegameWriter::current()->queue(std::move(snapshot));
+  else
+    SavegameWriter::write(*snapshot);
 }
 
 std::vector<std::string>
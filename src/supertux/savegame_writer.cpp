@@ -0,0 +1,181 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/savegame_writer.hpp"
+
+#include <algorithm>
+#include <physfs.h>
+
+#include "physfs/util.hpp"
+#include "squirrel/serialize.hpp"
+#include "util/log.hpp"
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
+#include "util/writer.hpp"
+
+void
+SavegameWriter::write(const Snapshot& snapshot)
+{
+  // The journal only replaces the savegame, once it has been written
+  // completely. Otherwise, the old savegame is kept.
+  const bool written = physfsutil::write_file_replacing(snapshot.filename, get_journal_filename(snapshot.filename),
+    [&snapshot](std::ostream& out) {
+      Writer writer(out);
+
+      writer.start_list("supertux-savegame");
+      writer.write("version", 1);
+
+      if (snapshot.title)
+        writer.write("title", *snapshot.title);
+
+      writer.start_list("tux");
+      snapshot.player_status->write(writer);
+      writer.end_list("tux");
+
+      writer.start_list("state");
+      write_squirrel_snapshot(snapshot.state, writer);
+      writer.end_list("state");
+
+      writer.end_list("supertux-savegame");
+    });
+
+  if (!written)
+  {
+    log_warning << "Couldn't write savegame " << snapshot.filename << ", keeping the previous one" << std::endl;
+  }
+}
+
+void
+SavegameWriter::recover(const std::string& filename)
+{
+  const std::string journal = get_journal_filename(filename);
+  if (!PHYSFS_exists(journal.c_str()))
+    return;
+
+  try
+  {
+    // A journal cut off while writing doesn't parse, as lists are left open.
+    auto doc = ReaderDocument::from_file(journal);
+    if (doc.get_root().get_name() != "supertux-savegame")
+      throw std::runtime_error("file is not a supertux-savegame file");
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Discarding incomplete savegame journal " << journal << ": " << err.what() << std::endl;
+    physfsutil::remove(journal);
+    return;
+  }
+
+  log_info << "Recovering savegame " << filename << " from its journal" << std::endl;
+  commit(journal, filename);
+}
+
+std::string
+SavegameWriter::get_journal_filename(const std::string& filename)
+{
+  return filename + ".journal";
+}
+
+bool
+SavegameWriter::commit(const std::string& journal, const std::string& filename)
+{
+  // Renaming replaces the savegame atomically, unlike rewriting it.
+  return physfsutil::rename(journal, filename);
+}
+
+SavegameWriter::SavegameWriter() :
+  m_thread(),
+  m_mutex(),
+  m_queue_condition(),
+  m_done_condition(),
+  m_queue(),
+  m_writing(false),
+  m_quit(false)
+{
+#ifndef __EMSCRIPTEN__
+  // Threads are not available in the browser build, so savegames
+  // are written as soon as they are queued there.
+  m_thread = std::thread(&SavegameWriter::writer_main, this);
+#endif
+}
+
+SavegameWriter::~SavegameWriter()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_queue_condition.notify_all();
+
+  // The thread writes all queued snapshots before quitting.
+  if (m_thread.joinable())
+    m_thread.join();
+}
+
+void
+SavegameWriter::queue(std::unique_ptr<Snapshot> snapshot)
+{
+  if (!m_thread.joinable())
+  {
+    write(*snapshot);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.erase(std::remove_if(m_queue.begin(), m_queue.end(),
+                                 [&snapshot](const std::unique_ptr<Snapshot>& queued) {
+                                   return queued->filename == snapshot->filename;
+                                 }),
+                  m_queue.end());
+    m_queue.push_back(std::move(snapshot));
+  }
+  m_queue_condition.notify_one();
+}
+
+void
+SavegameWriter::flush()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done_condition.wait(lock, [this] { return m_queue.empty() && !m_writing; });
+}
+
+void
+SavegameWriter::writer_main()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (true)
+  {
+    m_queue_condition.wait(lock, [this] { return m_quit || !m_queue.empty(); });
+    if (m_queue.empty())
+      return;
+
+    std::unique_ptr<Snapshot> snapshot = std::move(m_queue.front());
+    m_queue.pop_front();
+    m_writing = true;
+
+    lock.unlock();
+    write(*snapshot);
+    snapshot.reset();
+    lock.lock();
+
+    m_writing = false;
+    m_done_condition.notify_all();
+  }
+}
+
+/* EOF */
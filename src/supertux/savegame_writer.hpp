@@ -0,0 +1,108 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_SAVEGAME_WRITER_HPP
+#define HEADER_SUPERTUX_SUPERTUX_SAVEGAME_WRITER_HPP
+
+#include "util/currenton.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+#include <sexp/value.hpp>
+
+#include "supertux/player_status.hpp"
+
+/**
+ * Writes savegames on a background thread.
+
+   Savegames are queued as snapshots, which don't reference the Squirrel
+   VM or any game objects, so they can be serialized while the game goes
+   on. A snapshot is first written to a journal next to the savegame,
+   which is then renamed over the savegame, so the savegame is always
+   either the old or the new one, even if the game crashes in between.
+   A complete journal left behind by a crash is recovered on next load.
+ */
+class SavegameWriter final : public Currenton<SavegameWriter>
+{
+public:
+  struct Snapshot
+  {
+    Snapshot() :
+      filename(),
+      title(),
+      player_status(),
+      state()
+    {}
+
+    std::string filename;
+    std::optional<std::string> title;
+    std::unique_ptr<PlayerStatus> player_status;
+
+    /** See snapshot_squirrel_table() */
+    sexp::Value state;
+  };
+
+public:
+  /** Writes the snapshot on the calling thread. */
+  static void write(const Snapshot& snapshot);
+
+  /** Moves a complete journal of the given savegame, left behind by an
+      interrupted save, into place and discards an incomplete one.
+      Must not be called while a save of the file is queued. */
+  static void recover(const std::string& filename);
+
+private:
+  static std::string get_journal_filename(const std::string& filename);
+  static bool commit(const std::string& journal, const std::string& filename);
+
+public:
+  SavegameWriter();
+  ~SavegameWriter() override;
+
+  /** Queues the snapshot for writing. A snapshot of the same file,
+      which is still queued, is dropped, as it would be overwritten. */
+  void queue(std::unique_ptr<Snapshot> snapshot);
+
+  /** Waits until all queued snapshots have been written. */
+  void flush();
+
+private:
+  void writer_main();
+
+private:
+  std::thread m_thread;
+  std::mutex m_mutex;
+  std::condition_variable m_queue_condition;
+  std::condition_variable m_done_condition;
+  std::deque<std::unique_ptr<Snapshot>> m_queue;
+  bool m_writing;
+  bool m_quit;
+
+private:
+  SavegameWriter(const SavegameWriter&) = delete;
+  SavegameWriter& operator=(const SavegameWriter&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -44,7 +44,6 @@
 #include "object/text_object.hpp"
 #include "object/tilemap.hpp"
 #include "object/vertical_stripes.hpp"
-#include "physfs/ifile_stream.hpp"
 #include "squirrel/squirrel_environment.hpp"
 #include "supertux/colorscheme.hpp"
 #include "supertux/constants.hpp"
@@ -170,6 +169,34 @@ Sector::finish_construction(bool editable)
   m_fully_constructed = true;
 }
 
+std::vector<GameObject*>
+Sector::add_loaded_objects(std::vector<std::unique_ptr<GameObject>> objects, bool finished)
+{
+  std::vector<UID> uids;
+  uids.reserve(objects.size());
+
+  m_initialized = false;
+  for (auto& object : objects)
+    uids.push_back(add_object(std::move(object)).get_uid());
+  flush_game_objects();
+
+  m_foremost_layer = calculate_foremost_layer(false);
+  m_foremost_opaque_layer = calculate_foremost_layer();
+
+  if (finished)
+    process_resolve_requests();
+
+  // Objects, which couldn't be added (e.g. a second instance of a singleton), are gone by now.
+  std::vector<GameObject*> added_objects;
+  for (const auto& uid : uids)
+  {
+    auto* object = get_object_by_uid<GameObject>(uid);
+    if (object)
+      added_objects.push_back(object);
+  }
+  return added_objects;
+}
+
 SpawnPointMarker*
 Sector::get_spawn_point(const std::string& spawnpoint)
 {
@@ -279,8 +306,7 @@ Sector::activate(const Vector& player_pos)
   std::string basedir = FileSystem::dirname(get_level().m_filename);
   if (PHYSFS_exists((basedir + "/info").c_str())) {
     try {
-      IFileStream in(basedir + "/default.nut");
-      m_squirrel_environment->run_script(in, "default.nut");
+      m_squirrel_environment->run_script_file(basedir + "/default.nut", "default.nut");
     } catch(std::exception& ) {
       // doesn't exist or erroneous; do nothing
     }
@@ -742,20 +768,6 @@ Sector::get_nearest_player (const Vector& pos) const
   return nearest_player;
 }
 
-std::vector<MovingObject*>
-Sector::get_nearby_objects(const Vector& center, float max_distance) const
-{
-  std::vector<MovingObject*> result;
-  for (auto& object : m_collision_system->get_nearby_objects(center, max_distance))
-  {
-    auto* moving_object = dynamic_cast<MovingObject*>(&object->get_listener());
-    if (moving_object) {
-      result.push_back(moving_object);
-    }
-  }
-  return result;
-}
-
 void
 Sector::stop_looping_sounds()
 {
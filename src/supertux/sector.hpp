@@ -22,6 +22,7 @@
 #include <vector>
 #include <stdint.h>
 
+#include "collision/collision_listener.hpp"
 #include "collision/collision_system.hpp"
 #include "math/anchor_point.hpp"
 #include "math/easing.hpp"
@@ -80,6 +81,13 @@ public:
 
   void finish_construction(bool editable) override;
 
+  /** Adds objects, whose construction has been deferred on loading the sector
+      (see SectorParser::from_reader_deferred()). They are added the same way as
+      the objects loaded with the sector, so they are not tracked for undo.
+      If "finished" is true, no more objects will be added, so names which
+      still can't be resolved are reported. Returns the added objects. */
+  std::vector<GameObject*> add_loaded_objects(std::vector<std::unique_ptr<GameObject>> objects, bool finished);
+
   std::string get_exposed_class_name() const override { return "Sector"; }
 
   Level& get_level() const { return m_level; }
@@ -188,7 +196,21 @@ public:
     return (get_nearest_player (get_anchor_pos (pos, ANCHOR_MIDDLE)));
   }
 
-  std::vector<MovingObject*> get_nearby_objects (const Vector& center, float max_distance) const;
+  /** Calls visitor(T&) for every object of type T, whose bounding box center
+      is within max_distance of the given point. Only objects in one of the
+      collision groups in group_mask are visited. This does not allocate
+      and does not scan the whole sector. */
+  template<class T = MovingObject, typename F>
+  void for_each_nearby_object(const Vector& center, float max_distance, F&& visitor,
+                              uint32_t group_mask = COLGROUP_MASK_ALL) const
+  {
+    m_collision_system->for_each_nearby_object(center, max_distance,
+      [&visitor](CollisionObject& object) {
+        if (auto* typed_object = dynamic_cast<T*>(&object.get_listener()))
+          visitor(*typed_object);
+      },
+      group_mask);
+  }
 
   Rectf get_active_region() const;
 
@@ -48,6 +48,8 @@ public:
   void set_init_script(const std::string& init_script) { m_init_script = init_script; }
   void run_script(const std::string& script, const std::string& sourcename);
 
+  SquirrelEnvironment& get_squirrel_environment() const { return *m_squirrel_environment; }
+
 protected:
   virtual bool before_object_add(GameObject& object) override;
   virtual void before_object_remove(GameObject& object) override;
@@ -19,6 +19,7 @@
 
 #include <iostream>
 #include <physfs.h>
+#include <unordered_set>
 #include <sexp/value.hpp>
 
 #include "badguy/fish_jumping.hpp"
@@ -42,10 +43,26 @@
 #include "supertux/tile.hpp"
 #include "util/reader_collection.hpp"
 #include "util/reader_mapping.hpp"
+#include "util/reader_object.hpp"
 #include "worldmap/spawn_point.hpp"
 
 static const std::string DEFAULT_BG = "images/background/antarctic/arctis2.png";
 
+/** Objects, which are always constructed right away by from_reader_deferred() */
+static const std::unordered_set<std::string> IMMEDIATE_OBJECTS = {
+  "tilemap",
+  "path",
+  "background",
+  "gradient",
+  "camera",
+  "particles-clouds",
+  "particles-custom",
+  "particles-custom-file",
+  "particles-ghosts",
+  "particles-rain",
+  "particles-snow"
+};
+
 std::unique_ptr<Sector>
 SectorParser::from_reader(Level& level, const ReaderMapping& reader, bool editable)
 {
@@ -76,9 +93,30 @@ SectorParser::from_nothing(Level& level)
   return sector;
 }
 
+std::unique_ptr<Sector>
+SectorParser::from_reader_deferred(Level& level, const ReaderMapping& reader, bool editable,
+                                   std::vector<ReaderObject>& deferred_objects)
+{
+  auto sector = std::make_unique<Sector>(level);
+  BIND_SECTOR(*sector);
+  SectorParser parser(*sector, editable);
+  parser.m_deferred_objects = &deferred_objects;
+  parser.parse(reader);
+  return sector;
+}
+
+std::unique_ptr<GameObject>
+SectorParser::parse_deferred_object(Sector& sector, const ReaderObject& object, bool editable)
+{
+  BIND_SECTOR(sector);
+  SectorParser parser(sector, editable);
+  return parser.parse_object(object.get_name(), object.get_mapping());
+}
+
 SectorParser::SectorParser(Base::Sector& sector, bool editable) :
   m_sector(sector),
-  m_editable(editable)
+  m_editable(editable),
+  m_deferred_objects(nullptr)
 {
 }
 
@@ -161,6 +199,10 @@ SectorParser::parse(const ReaderMapping& reader)
         m_sector.add<AmbientLight>(iter.as_mapping());
       }
     }
+    else if (m_deferred_objects && IMMEDIATE_OBJECTS.find(iter.get_key()) == IMMEDIATE_OBJECTS.end())
+    {
+      m_deferred_objects->emplace_back(reader.get_doc(), iter.get_sexp());
+    }
     else
     {
       auto object = parse_object(iter.get_key(), iter.as_mapping());
@@ -20,10 +20,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 class GameObject;
 class Level;
 class ReaderMapping;
+class ReaderObject;
 class Sector;
 
 namespace Base {
@@ -37,6 +39,14 @@ public:
   static std::unique_ptr<Sector> from_reader_old_format(Level& level, const ReaderMapping& sector, bool editable);
   static std::unique_ptr<Sector> from_nothing(Level& level);
 
+  /** Parses a sector, constructing only the objects needed to display it (tilemaps,
+      backgrounds and the paths they may follow) and those which would otherwise be
+      added by default. All other objects are put into "deferred_objects", to be
+      constructed with parse_deferred_object() and added with Sector::add_loaded_objects(). */
+  static std::unique_ptr<Sector> from_reader_deferred(Level& level, const ReaderMapping& sector, bool editable,
+                                                      std::vector<ReaderObject>& deferred_objects);
+  static std::unique_ptr<GameObject> parse_deferred_object(Sector& sector, const ReaderObject& object, bool editable);
+
 protected:
   SectorParser(Base::Sector& sector, bool editable);
   virtual ~SectorParser() {}
@@ -54,6 +64,7 @@ protected:
 protected:
   Base::Sector& m_sector;
   bool m_editable;
+  std::vector<ReaderObject>* m_deferred_objects;
 
 private:
   SectorParser(const SectorParser&) = delete;
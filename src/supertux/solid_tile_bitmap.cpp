@@ -0,0 +1,222 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "supertux/solid_tile_bitmap.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "object/tilemap.hpp"
+
+namespace {
+
+/** Upper limit for the amount of cells in the bitmap (8 MiB).
+    If the merged tilemaps are spread wider, none are merged. */
+const long long MAX_CELLS = 1LL << 26;
+
+int tile_offset(float offset)
+{
+  return static_cast<int>(offset / 32.0f);
+}
+
+} // namespace
+
+SolidTileBitmap::SolidTileBitmap() :
+  m_tilemaps(),
+  m_left(0),
+  m_top(0),
+  m_width(0),
+  m_height(0),
+  m_words_per_row(0),
+  m_bits()
+{
+}
+
+void
+SolidTileBitmap::rebuild(const std::vector<TileMap*>& tilemaps)
+{
+  m_tilemaps.clear();
+  m_bits.clear();
+  m_left = m_top = 0;
+  m_width = m_height = 0;
+  m_words_per_row = 0;
+
+  int left = std::numeric_limits<int>::max();
+  int top = std::numeric_limits<int>::max();
+  int right = std::numeric_limits<int>::min();
+  int bottom = std::numeric_limits<int>::min();
+  for (const auto* tilemap : tilemaps)
+  {
+    if (!is_mergeable(*tilemap))
+      continue;
+
+    const int x = tile_offset(tilemap->get_offset().x);
+    const int y = tile_offset(tilemap->get_offset().y);
+    left = std::min(left, x);
+    top = std::min(top, y);
+    right = std::max(right, x + tilemap->get_width());
+    bottom = std::max(bottom, y + tilemap->get_height());
+
+    m_tilemaps.push_back(tilemap);
+  }
+
+  if (m_tilemaps.empty())
+    return;
+
+  if (static_cast<long long>(right - left) * (bottom - top) > MAX_CELLS)
+  {
+    m_tilemaps.clear();
+    return;
+  }
+
+  m_left = left;
+  m_top = top;
+  m_width = right - left;
+  m_height = bottom - top;
+  m_words_per_row = (m_width + 63) / 64;
+  m_bits.assign(static_cast<size_t>(m_words_per_row) * m_height, 0);
+
+  for (const auto* tilemap : m_tilemaps)
+  {
+    const int offset_x = tile_offset(tilemap->get_offset().x) - m_left;
+    const int offset_y = tile_offset(tilemap->get_offset().y) - m_top;
+    for (int y = 0; y < tilemap->get_height(); ++y)
+      for (int x = 0; x < tilemap->get_width(); ++x)
+        if (has_attributes(*tilemap, x, y))
+          set_cell(offset_x + x, offset_y + y, true);
+  }
+}
+
+void
+SolidTileBitmap::update_tile(const TileMap& tilemap, int x, int y)
+{
+  if (!contains(tilemap))
+    return;
+
+  // The cell is shared with the other merged tilemaps covering it.
+  const int cell_x = tile_offset(tilemap.get_offset().x) + x;
+  const int cell_y = tile_offset(tilemap.get_offset().y) + y;
+
+  bool value = false;
+  for (const auto* other : m_tilemaps)
+  {
+    const int other_x = cell_x - tile_offset(other->get_offset().x);
+    const int other_y = cell_y - tile_offset(other->get_offset().y);
+    if (other_x < 0 || other_x >= other->get_width() ||
+        other_y < 0 || other_y >= other->get_height())
+      continue;
+
+    if (has_attributes(*other, other_x, other_y))
+    {
+      value = true;
+      break;
+    }
+  }
+
+  set_cell(cell_x - m_left, cell_y - m_top, value);
+}
+
+bool
+SolidTileBitmap::contains(const TileMap& tilemap) const
+{
+  return std::find(m_tilemaps.begin(), m_tilemaps.end(), &tilemap) != m_tilemaps.end();
+}
+
+bool
+SolidTileBitmap::is_free(const Rectf& rect) const
+{
+  if (!std::isfinite(rect.get_left()) || !std::isfinite(rect.get_top()) ||
+      !std::isfinite(rect.get_right()) || !std::isfinite(rect.get_bottom()))
+    return false;
+
+  const Rect cells = get_cells(rect);
+  if (cells.left >= cells.right || cells.top >= cells.bottom)
+    return true;
+
+  const int first_word = cells.left / 64;
+  const int last_word = (cells.right - 1) / 64;
+  const uint64_t first_mask = ~uint64_t(0) << (cells.left % 64);
+  const uint64_t last_mask = ~uint64_t(0) >> (63 - (cells.right - 1) % 64);
+
+  for (int y = cells.top; y < cells.bottom; ++y)
+  {
+    const uint64_t* row = m_bits.data() + static_cast<size_t>(y) * m_words_per_row;
+    for (int word = first_word; word <= last_word; ++word)
+    {
+      uint64_t mask = ~uint64_t(0);
+      if (word == first_word)
+        mask &= first_mask;
+      if (word == last_word)
+        mask &= last_mask;
+
+      if (row[word] & mask)
+        return false;
+    }
+  }
+
+  return true;
+}
+
+bool
+SolidTileBitmap::is_mergeable(const TileMap& tilemap)
+{
+  // Tilemaps following a path change their offset every frame.
+  if (tilemap.get_walker())
+    return false;
+
+  const Vector& offset = tilemap.get_offset();
+  return std::abs(offset.x) < 1e8f && std::abs(offset.y) < 1e8f &&
+         std::fmod(offset.x, 32.0f) == 0.0f && std::fmod(offset.y, 32.0f) == 0.0f;
+}
+
+bool
+SolidTileBitmap::has_attributes(const TileMap& tilemap, int x, int y)
+{
+  return tilemap.get_collision_tile(x, y).attributes != 0;
+}
+
+Rect
+SolidTileBitmap::get_cells(const Rectf& rect) const
+{
+  // Same rounding as TileMap::get_tiles_overlapping(), clamped to the bitmap.
+  const auto to_cell = [](float value, int origin, int count) {
+    const float cell = value - static_cast<float>(origin);
+    return static_cast<int>(std::max(0.0f, std::min(static_cast<float>(count), cell)));
+  };
+
+  const int left = to_cell(floorf(rect.get_left() / 32), m_left, m_width);
+  const int right = to_cell(ceilf(rect.get_right() / 32), m_left, m_width);
+  const int top = to_cell(floorf(rect.get_top() / 32), m_top, m_height);
+  const int bottom = to_cell(ceilf(rect.get_bottom() / 32), m_top, m_height);
+  if (left >= right || top >= bottom)
+    return Rect(0, 0, 0, 0);
+
+  return Rect(left, top, right, bottom);
+}
+
+void
+SolidTileBitmap::set_cell(int x, int y, bool value)
+{
+  uint64_t& word = m_bits[static_cast<size_t>(y) * m_words_per_row + x / 64];
+  const uint64_t bit = uint64_t(1) << (x % 64);
+  if (value)
+    word |= bit;
+  else
+    word &= ~bit;
+}
+
+/* EOF */
@@ -0,0 +1,84 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_SOLID_TILE_BITMAP_HPP
+#define HEADER_SUPERTUX_SUPERTUX_SOLID_TILE_BITMAP_HPP
+
+#include <stdint.h>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "math/rectf.hpp"
+
+class TileMap;
+
+/**
+ * Merges the solid tilemaps of a sector into a single bitmap on the
+   sector's 32px tile grid, with a bit set for every cell, in which at
+   least one of the tilemaps has a tile with any attributes.
+
+   Tilemaps which follow a path, or are not aligned to the tile grid,
+   are not merged and have to be checked separately.
+ */
+class SolidTileBitmap final
+{
+public:
+  SolidTileBitmap();
+
+  /** Rebuilds the bitmap from the given solid tilemaps. */
+  void rebuild(const std::vector<TileMap*>& tilemaps);
+
+  /** Recomputes the cell of the given tile, after it has been changed. */
+  void update_tile(const TileMap& tilemap, int x, int y);
+
+  /** Returns true, if the tilemap has been merged into the bitmap. */
+  bool contains(const TileMap& tilemap) const;
+
+  /** Returns true, if no merged tilemap has a tile with attributes
+      within the tiles overlapping the given rectangle. */
+  bool is_free(const Rectf& rect) const;
+
+private:
+  static bool is_mergeable(const TileMap& tilemap);
+  static bool has_attributes(const TileMap& tilemap, int x, int y);
+
+  /** Returns the range of cells overlapping the rectangle, relative
+      to the bitmap origin, or an empty range if there are none. */
+  Rect get_cells(const Rectf& rect) const;
+
+  void set_cell(int x, int y, bool value);
+
+private:
+  std::vector<const TileMap*> m_tilemaps;
+
+  /** Position of the top-left cell, in tiles */
+  int m_left;
+  int m_top;
+
+  int m_width;
+  int m_height;
+  int m_words_per_row;
+
+  std::vector<uint64_t> m_bits;
+
+private:
+  SolidTileBitmap(const SolidTileBitmap&) = delete;
+  SolidTileBitmap& operator=(const SolidTileBitmap&) = delete;
+};
+
+#endif
+
+/* EOF */
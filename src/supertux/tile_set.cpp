@@ -16,15 +16,19 @@
 
 #include "supertux/tile_set.hpp"
 
+#include <chrono>
+
 #include "editor/editor.hpp"
 #include "supertux/autotile_parser.hpp"
 #include "supertux/resources.hpp"
 #include "supertux/tile.hpp"
+#include "supertux/tile_set_cache.hpp"
 #include "supertux/tile_set_parser.hpp"
 #include "util/gettext.hpp"
 #include "util/log.hpp"
 #include "video/drawing_context.hpp"
 #include "video/surface.hpp"
+#include "video/texture_manager.hpp"
 
 Tilegroup::Tilegroup() :
   developers_group(),
@@ -36,10 +40,28 @@ Tilegroup::Tilegroup() :
 std::unique_ptr<TileSet>
 TileSet::from_file(const std::string& filename)
 {
-  auto tileset = std::make_unique<TileSet>();
+  const auto start = std::chrono::steady_clock::now();
+  const auto get_elapsed_ms = [start] {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  };
+
+  auto tileset = TileSetCache::load(filename);
+  if (tileset)
+  {
+    log_info << "Loaded tileset '" << filename << "' from its cache file in " << get_elapsed_ms() << "ms" << std::endl;
+  }
+  else
+  {
+    tileset = std::make_unique<TileSet>();
 
-  TileSetParser parser(*tileset, filename);
-  parser.parse();
+    TileSetCache::Data cache_data;
+    TileSetParser parser(*tileset, filename, &cache_data);
+    parser.parse();
+
+    log_info << "Parsed tileset '" << filename << "' in " << get_elapsed_ms() << "ms" << std::endl;
+
+    TileSetCache::save(filename, cache_data, *tileset);
+  }
 
   tileset->print_debug_info(filename);
 
@@ -50,7 +72,8 @@ TileSet::TileSet() :
   m_autotilesets(),
   m_thunderstorm_tiles(),
   m_tiles(1),
-  m_tilegroups()
+  m_tilegroups(),
+  m_average_colors()
 {
   m_tiles[0] = std::make_unique<Tile>();
 }
@@ -67,6 +90,8 @@ TileSet::add_tile(int id, std::unique_ptr<Tile> tile)
   } else {
     m_tiles[id] = std::move(tile);
   }
+
+  m_average_colors.clear();
 }
 
 const Tile&
@@ -87,6 +112,35 @@ TileSet::get(const uint32_t id) const
   }
 }
 
+const std::vector<uint32_t>&
+TileSet::get_average_colors() const
+{
+  if (!m_average_colors.empty())
+    return m_average_colors;
+
+  const auto start = std::chrono::steady_clock::now();
+
+  m_average_colors.resize(m_tiles.size(), 0);
+  for (size_t id = 1; id < m_tiles.size(); ++id)
+  {
+    if (!m_tiles[id])
+      continue;
+
+    const SurfacePtr surface = m_tiles[id]->get_current_editor_surface();
+    if (!surface || !surface->get_texture())
+      continue;
+
+    m_average_colors[id] = TextureManager::current()->get_average_color(*surface->get_texture(),
+                                                                        surface->get_region()).rgba();
+  }
+
+  log_debug << "Computed average tile colors in "
+            << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count()
+            << "ms" << std::endl;
+
+  return m_average_colors;
+}
+
 AutotileSet*
 TileSet::get_autotileset_from_tile(uint32_t tile_id) const
 {
@@ -73,6 +73,10 @@ public:
     return m_tilegroups;
   }
 
+  /** Returns the average colors of the tile images in RGBA format,
+      indexed by tile ID. They are computed once, on the first call. */
+  const std::vector<uint32_t>& get_average_colors() const;
+
   void print_debug_info(const std::string& filename);
   
 public:
@@ -88,6 +92,8 @@ private:
   std::vector<std::unique_ptr<Tile> > m_tiles;
   std::vector<Tilegroup> m_tilegroups;
 
+  mutable std::vector<uint32_t> m_average_colors;
+
 private:
   TileSet(const TileSet&) = delete;
   TileSet& operator=(const TileSet&) = delete;
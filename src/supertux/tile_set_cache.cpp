@@ -0,0 +1,526 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/tile_set_cache.hpp"
+
+#include <iomanip>
+#include <physfs.h>
+#include <sstream>
+#include <stdexcept>
+#include <string.h>
+
+#include "physfs/mapped_file.hpp"
+#include "physfs/ofile_stream.hpp"
+#include "physfs/util.hpp"
+#include "supertux/autotile.hpp"
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "supertux/tile.hpp"
+#include "util/gettext.hpp"
+#include "util/log.hpp"
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
+#include "video/surface.hpp"
+
+namespace {
+
+const char* CACHE_DIRECTORY = "cache/tilesets";
+const char CACHE_FILE_MAGIC[4] = { 'S', 'T', 'T', 'C' };
+
+/** Has to be increased whenever the layout of cache files changes. */
+const uint32_t CACHE_FILE_VERSION = 1;
+
+class BinaryWriter final
+{
+public:
+  BinaryWriter(std::string& out) : m_out(out) {}
+
+  template<typename T>
+  void write(const T& value)
+  {
+    m_out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  void write_bool(bool value) { write(static_cast<uint8_t>(value ? 1 : 0)); }
+
+  void write_string(const std::string& value)
+  {
+    write(static_cast<uint32_t>(value.size()));
+    m_out.append(value);
+  }
+
+  void write_rect(const Rect& rect)
+  {
+    write(static_cast<int32_t>(rect.left));
+    write(static_cast<int32_t>(rect.top));
+    write(static_cast<int32_t>(rect.right));
+    write(static_cast<int32_t>(rect.bottom));
+  }
+
+  void write_images(const std::vector<TileSetCache::ImageSpec>& images)
+  {
+    write(static_cast<uint32_t>(images.size()));
+    for (const auto& image : images)
+    {
+      write_string(image.file);
+      write_bool(image.has_rect);
+      write_rect(image.rect);
+      write_string(image.surface);
+    }
+  }
+
+private:
+  std::string& m_out;
+
+private:
+  BinaryWriter(const BinaryWriter&) = delete;
+  BinaryWriter& operator=(const BinaryWriter&) = delete;
+};
+
+class BinaryReader final
+{
+public:
+  BinaryReader(const char* data, size_t size) : m_data(data), m_size(size), m_pos(0) {}
+
+  template<typename T>
+  T read()
+  {
+    check(sizeof(T));
+    T value;
+    memcpy(&value, m_data + m_pos, sizeof(T));
+    m_pos += sizeof(T);
+    return value;
+  }
+
+  bool read_bool() { return read<uint8_t>() != 0; }
+
+  std::string read_string()
+  {
+    const uint32_t size = read<uint32_t>();
+    check(size);
+    std::string value(m_data + m_pos, size);
+    m_pos += size;
+    return value;
+  }
+
+  Rect read_rect()
+  {
+    Rect rect;
+    rect.left = read<int32_t>();
+    rect.top = read<int32_t>();
+    rect.right = read<int32_t>();
+    rect.bottom = read<int32_t>();
+    return rect;
+  }
+
+  /** Reads the amount of the following elements, each taking up at least the given size. */
+  uint32_t read_count(size_t element_size)
+  {
+    const uint32_t count = read<uint32_t>();
+    check(static_cast<size_t>(count) * element_size);
+    return count;
+  }
+
+  std::vector<TileSetCache::ImageSpec> read_images()
+  {
+    std::vector<TileSetCache::ImageSpec> images(read_count(25));
+    for (auto& image : images)
+    {
+      image.file = read_string();
+      image.has_rect = read_bool();
+      image.rect = read_rect();
+      image.surface = read_string();
+    }
+    return images;
+  }
+
+  bool at_end() const { return m_pos == m_size; }
+
+private:
+  void check(size_t size) const
+  {
+    if (size > m_size - m_pos)
+      throw std::runtime_error("unexpected end of file");
+  }
+
+private:
+  const char* m_data;
+  size_t m_size;
+  size_t m_pos;
+
+private:
+  BinaryReader(const BinaryReader&) = delete;
+  BinaryReader& operator=(const BinaryReader&) = delete;
+};
+
+uint64_t fnv1a(const char* data, size_t size, uint64_t result = 14695981039346656037ULL)
+{
+  for (size_t i = 0; i < size; ++i)
+  {
+    result ^= static_cast<unsigned char>(data[i]);
+    result *= 1099511628211ULL;
+  }
+  return result;
+}
+
+/** Tilegroup names are translated while parsing, so the cache file is
+    only valid for the language it has been written in. */
+std::string get_language()
+{
+  return g_dictionary_manager ? g_dictionary_manager->get_language().str() : std::string();
+}
+
+} // namespace
+
+SurfacePtr
+TileSetCache::create_surface(const ImageSpec& spec)
+{
+  const std::optional<Rect> rect = spec.has_rect ? std::optional<Rect>(spec.rect) : std::nullopt;
+  if (spec.surface.empty())
+    return Surface::from_file(spec.file, rect);
+
+  std::istringstream stream(spec.surface);
+  const auto doc = ReaderDocument::from_stream(stream, spec.file);
+  return Surface::from_reader(doc.get_root().get_mapping(), rect);
+}
+
+std::vector<SurfacePtr>
+TileSetCache::create_surfaces(const std::vector<ImageSpec>& specs)
+{
+  std::vector<SurfacePtr> surfaces;
+  surfaces.reserve(specs.size());
+  for (const auto& spec : specs)
+    surfaces.push_back(create_surface(spec));
+  return surfaces;
+}
+
+std::unique_ptr<TileSet>
+TileSetCache::load(const std::string& filename)
+{
+  if (!enabled())
+    return nullptr;
+
+  const std::string cache_filename = get_cache_filename(filename);
+  if (!PHYSFS_exists(cache_filename.c_str()))
+    return nullptr;
+
+  Data data;
+  std::map<uint32_t, uint32_t> thunderstorm_tiles;
+  std::vector<std::unique_ptr<AutotileSet>> autotilesets;
+  try
+  {
+    MappedFile file(cache_filename);
+    BinaryReader in(file.get_data(), file.get_size());
+
+    char magic[sizeof(CACHE_FILE_MAGIC)];
+    for (char& c : magic)
+      c = in.read<char>();
+    if (memcmp(magic, CACHE_FILE_MAGIC, sizeof(magic)) != 0 ||
+        in.read<uint32_t>() != CACHE_FILE_VERSION ||
+        in.read_string() != filename ||
+        in.read_string() != get_language())
+      return nullptr;
+
+    data.sources.resize(in.read_count(12));
+    for (auto& source : data.sources)
+    {
+      source = in.read_string();
+      const uint64_t source_hash = in.read<uint64_t>();
+      if (!PHYSFS_exists(source.c_str()) || hash_file(source) != source_hash)
+      {
+        log_info << "Tileset '" << filename << "' changed, rebuilding its cache file." << std::endl;
+        return nullptr;
+      }
+    }
+
+    data.shared_images.resize(in.read_count(8));
+    for (auto& shared : data.shared_images)
+    {
+      shared.images = in.read_images();
+      shared.editor_images = in.read_images();
+    }
+
+    data.tiles.resize(in.read_count(49));
+    for (auto& tile : data.tiles)
+    {
+      tile.id = in.read<uint32_t>();
+      tile.attributes = in.read<uint32_t>();
+      tile.data = in.read<uint32_t>();
+      tile.fps = in.read<float>();
+      tile.deprecated = in.read_bool();
+      tile.object_name = in.read_string();
+      tile.object_data = in.read_string();
+      tile.images = in.read_images();
+      tile.editor_images = in.read_images();
+      tile.shared = in.read<int32_t>();
+      tile.shared_region = in.read_rect();
+
+      if (tile.shared >= static_cast<int32_t>(data.shared_images.size()))
+        throw std::runtime_error("invalid shared images");
+    }
+
+    data.tilegroups.resize(in.read_count(9));
+    for (auto& tilegroup : data.tilegroups)
+    {
+      tilegroup.name = in.read_string();
+      tilegroup.developers_group = in.read_bool();
+      tilegroup.tiles.resize(in.read_count(4));
+      for (int& tile : tilegroup.tiles)
+        tile = in.read<int32_t>();
+    }
+
+    const uint32_t thunderstorm_count = in.read_count(8);
+    for (uint32_t i = 0; i < thunderstorm_count; ++i)
+    {
+      const uint32_t tile = in.read<uint32_t>();
+      thunderstorm_tiles[tile] = in.read<uint32_t>();
+    }
+
+    const uint32_t autotileset_count = in.read_count(13);
+    for (uint32_t i = 0; i < autotileset_count; ++i)
+    {
+      const std::string name = in.read_string();
+      const uint32_t default_tile = in.read<uint32_t>();
+      const bool corner = in.read_bool();
+
+      std::vector<std::unique_ptr<Autotile>> autotiles(in.read_count(13));
+      for (auto& autotile : autotiles)
+      {
+        const uint32_t tile_id = in.read<uint32_t>();
+        const bool solid = in.read_bool();
+
+        std::vector<std::pair<uint32_t, float>> alt_tiles(in.read_count(8));
+        for (auto& alt_tile : alt_tiles)
+        {
+          alt_tile.first = in.read<uint32_t>();
+          alt_tile.second = in.read<float>();
+        }
+
+        std::vector<AutotileMask> masks;
+        const uint32_t mask_count = in.read_count(1);
+        masks.reserve(mask_count);
+        for (uint32_t j = 0; j < mask_count; ++j)
+          masks.push_back(AutotileMask(in.read<uint8_t>(), solid));
+
+        autotile = std::make_unique<Autotile>(tile_id, alt_tiles, masks, solid);
+      }
+
+      // The autotileset takes ownership of its autotiles.
+      std::vector<Autotile*> autotile_ptrs;
+      for (auto& autotile : autotiles)
+        autotile_ptrs.push_back(autotile.release());
+      autotilesets.push_back(std::make_unique<AutotileSet>(autotile_ptrs, default_tile, name, corner));
+    }
+
+    if (!in.at_end())
+      throw std::runtime_error("trailing data");
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't read tileset cache file '" << cache_filename << "': " << err.what() << std::endl;
+    return nullptr;
+  }
+
+  auto tileset = std::make_unique<TileSet>();
+  tileset->m_thunderstorm_tiles = std::move(thunderstorm_tiles);
+  tileset->m_autotilesets = std::move(autotilesets);
+  create_tiles(*tileset, data);
+  return tileset;
+}
+
+void
+TileSetCache::save(const std::string& filename, const Data& data, const TileSet& tileset)
+{
+  if (!enabled() || !g_config->write_caches)
+    return;
+
+  std::string buffer;
+  BinaryWriter out(buffer);
+
+  buffer.append(CACHE_FILE_MAGIC, sizeof(CACHE_FILE_MAGIC));
+  out.write(CACHE_FILE_VERSION);
+  out.write_string(filename);
+  out.write_string(get_language());
+
+  out.write(static_cast<uint32_t>(data.sources.size()));
+  for (const auto& source : data.sources)
+  {
+    out.write_string(source);
+    out.write(hash_file(source));
+  }
+
+  out.write(static_cast<uint32_t>(data.shared_images.size()));
+  for (const auto& shared : data.shared_images)
+  {
+    out.write_images(shared.images);
+    out.write_images(shared.editor_images);
+  }
+
+  out.write(static_cast<uint32_t>(data.tiles.size()));
+  for (const auto& tile : data.tiles)
+  {
+    out.write(tile.id);
+    out.write(tile.attributes);
+    out.write(tile.data);
+    out.write(tile.fps);
+    out.write_bool(tile.deprecated);
+    out.write_string(tile.object_name);
+    out.write_string(tile.object_data);
+    out.write_images(tile.images);
+    out.write_images(tile.editor_images);
+    out.write(tile.shared);
+    out.write_rect(tile.shared_region);
+  }
+
+  out.write(static_cast<uint32_t>(data.tilegroups.size()));
+  for (const auto& tilegroup : data.tilegroups)
+  {
+    out.write_string(tilegroup.name);
+    out.write_bool(tilegroup.developers_group);
+    out.write(static_cast<uint32_t>(tilegroup.tiles.size()));
+    for (const int tile : tilegroup.tiles)
+      out.write(static_cast<int32_t>(tile));
+  }
+
+  out.write(static_cast<uint32_t>(tileset.m_thunderstorm_tiles.size()));
+  for (const auto& it : tileset.m_thunderstorm_tiles)
+  {
+    out.write(it.first);
+    out.write(it.second);
+  }
+
+  out.write(static_cast<uint32_t>(tileset.m_autotilesets.size()));
+  for (const auto& autotileset : tileset.m_autotilesets)
+  {
+    out.write_string(autotileset->get_name());
+    out.write(autotileset->get_default_tile());
+    out.write_bool(autotileset->is_corner());
+
+    out.write(static_cast<uint32_t>(autotileset->get_autotiles().size()));
+    for (const auto* autotile : autotileset->get_autotiles())
+    {
+      out.write(autotile->get_tile_id());
+      out.write_bool(autotile->is_solid());
+
+      out.write(static_cast<uint32_t>(autotile->get_all_tile_ids().size()));
+      for (const auto& alt_tile : autotile->get_all_tile_ids())
+      {
+        out.write(alt_tile.first);
+        out.write(alt_tile.second);
+      }
+
+      out.write(static_cast<uint32_t>(autotile->get_masks().size()));
+      for (const auto& mask : autotile->get_masks())
+        out.write(mask.get_mask());
+    }
+  }
+
+  const std::string cache_filename = get_cache_filename(filename);
+  try
+  {
+    if (!PHYSFS_mkdir(CACHE_DIRECTORY))
+      throw std::runtime_error("Couldn't create cache directory");
+
+    // Written under another name first, so that a cache file is never
+    // seen half-written, e.g. by a concurrently running SuperTux.
+    const std::string part_filename = cache_filename + ".part";
+    {
+      OFileStream file(part_filename);
+      file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      file.flush();
+      if (!file)
+        throw std::runtime_error("Couldn't write '" + part_filename + "'");
+    }
+
+    if (!physfsutil::rename(part_filename, cache_filename))
+      physfsutil::remove(part_filename);
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't write tileset cache file '" << cache_filename << "': " << err.what() << std::endl;
+  }
+}
+
+bool
+TileSetCache::enabled()
+{
+  return g_config && g_config->cache_tilesets;
+}
+
+std::string
+TileSetCache::get_cache_filename(const std::string& filename)
+{
+  std::ostringstream out;
+  out << CACHE_DIRECTORY << "/" << std::hex << std::setw(16) << std::setfill('0')
+      << fnv1a(filename.data(), filename.size()) << ".sttc";
+  return out.str();
+}
+
+uint64_t
+TileSetCache::hash_file(const std::string& filename)
+{
+  MappedFile file(filename);
+  return fnv1a(file.get_data(), file.get_size());
+}
+
+void
+TileSetCache::create_tiles(TileSet& tileset, const Data& data)
+{
+  std::vector<std::vector<SurfacePtr>> shared_images;
+  std::vector<std::vector<SurfacePtr>> shared_editor_images;
+  for (const auto& shared : data.shared_images)
+  {
+    shared_images.push_back(create_surfaces(shared.images));
+    shared_editor_images.push_back(create_surfaces(shared.editor_images));
+  }
+
+  const auto get_regions = [](const std::vector<SurfacePtr>& surfaces, const Rect& region) {
+    std::vector<SurfacePtr> regions;
+    regions.reserve(surfaces.size());
+    for (const auto& surface : surfaces)
+      regions.push_back(surface->region(region));
+    return regions;
+  };
+
+  for (const auto& spec : data.tiles)
+  {
+    std::unique_ptr<Tile> tile;
+    if (spec.shared >= 0)
+    {
+      tile = std::make_unique<Tile>(get_regions(shared_images[spec.shared], spec.shared_region),
+                                    get_regions(shared_editor_images[spec.shared], spec.shared_region),
+                                    spec.attributes, spec.data, spec.fps, spec.deprecated,
+                                    spec.object_name, spec.object_data);
+    }
+    else
+    {
+      tile = std::make_unique<Tile>(create_surfaces(spec.images), create_surfaces(spec.editor_images),
+                                    spec.attributes, spec.data, spec.fps, spec.deprecated,
+                                    spec.object_name, spec.object_data);
+    }
+    tileset.add_tile(spec.id, std::move(tile));
+  }
+
+  for (const auto& tilegroup : data.tilegroups)
+    tileset.add_tilegroup(tilegroup);
+
+  tileset.remove_deprecated_tiles();
+  if (g_config->developer_mode)
+    tileset.add_unassigned_tilegroup();
+}
+
+/* EOF */
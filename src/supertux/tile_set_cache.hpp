@@ -0,0 +1,110 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_TILE_SET_CACHE_HPP
+#define HEADER_SUPERTUX_SUPERTUX_TILE_SET_CACHE_HPP
+
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "math/rect.hpp"
+#include "supertux/tile_set.hpp"
+#include "video/surface_ptr.hpp"
+
+/**
+ * Keeps a pre-baked, binary form of tileset files in the user directory,
+   so tilesets can be created without parsing their files.
+
+   The cache file of a tileset covers its imported tilesets and autotile
+   files as well. It's only used if the hashes of all of these files still
+   match, otherwise the tileset is parsed and its cache file is rewritten.
+ */
+class TileSetCache final
+{
+public:
+  /** An image of a tile, as specified in a tileset file */
+  struct ImageSpec
+  {
+    /** The image file, or the file the "surface" entry is from */
+    std::string file;
+    bool has_rect = false;
+    Rect rect;
+    /** A "(surface ...)" entry, for images with additional textures */
+    std::string surface;
+  };
+
+  /** Images of a "tiles" entry, which all of its tiles share regions of */
+  struct SharedImages
+  {
+    std::vector<ImageSpec> images;
+    std::vector<ImageSpec> editor_images;
+  };
+
+  struct TileSpec
+  {
+    uint32_t id = 0;
+    uint32_t attributes = 0;
+    uint32_t data = 0;
+    float fps = 10.0f;
+    bool deprecated = false;
+    std::string object_name;
+    std::string object_data;
+
+    std::vector<ImageSpec> images;
+    std::vector<ImageSpec> editor_images;
+
+    /** Index of the shared images of the tile, or -1 if it has its own */
+    int32_t shared = -1;
+    Rect shared_region;
+  };
+
+  /** Everything needed to create a tileset, as recorded while parsing it */
+  struct Data
+  {
+    std::vector<std::string> sources;
+    std::vector<SharedImages> shared_images;
+    std::vector<TileSpec> tiles;
+    std::vector<Tilegroup> tilegroups;
+  };
+
+public:
+  static SurfacePtr create_surface(const ImageSpec& spec);
+  static std::vector<SurfacePtr> create_surfaces(const std::vector<ImageSpec>& specs);
+
+  /** Creates the tileset from its cache file. Returns nullptr, if
+      there is no cache file, or if it's outdated. */
+  static std::unique_ptr<TileSet> load(const std::string& filename);
+
+  /** Writes the cache file of a tileset, which has just been parsed. */
+  static void save(const std::string& filename, const Data& data, const TileSet& tileset);
+
+private:
+  static bool enabled();
+  static std::string get_cache_filename(const std::string& filename);
+  static uint64_t hash_file(const std::string& filename);
+
+  static void create_tiles(TileSet& tileset, const Data& data);
+
+private:
+  TileSetCache() = delete;
+};
+
+#endif
+
+/* EOF */
@@ -31,10 +31,12 @@
 #include "util/file_system.hpp"
 #include "video/surface.hpp"
 
-TileSetParser::TileSetParser(TileSet& tileset, const std::string& filename) :
+TileSetParser::TileSetParser(TileSet& tileset, const std::string& filename,
+                             TileSetCache::Data* cache_data) :
   m_tileset(tileset),
   m_filename(filename),
-  m_tiles_path()
+  m_tiles_path(),
+  m_cache_data(cache_data)
 {
 }
 
@@ -62,6 +64,9 @@ TileSetParser::parse(int32_t start, int32_t end, int32_t offset, bool imported)
   auto doc = ReaderDocument::from_file(m_filename);
   auto root = doc.get_root();
 
+  if (m_cache_data)
+    m_cache_data->sources.push_back(m_filename);
+
   if (root.get_name() != "supertux-tiles") {
     throw std::runtime_error("file is not a supertux tiles file.");
   }
@@ -91,6 +96,8 @@ TileSetParser::parse(int32_t start, int32_t end, int32_t offset, bool imported)
           if (tile != 0) tile += tiles_offset;
 
       m_tileset.add_tilegroup(tilegroup);
+      if (m_cache_data)
+        m_cache_data->tilegroups.push_back(tilegroup);
     }
     else if (iter.get_key() == "tiles")
     {
@@ -109,9 +116,12 @@ TileSetParser::parse(int32_t start, int32_t end, int32_t offset, bool imported)
       }
       else
       {
-        AutotileParser parser(m_tileset.m_autotilesets,
-            FileSystem::normalize(m_tiles_path + autotile_filename));
+        const std::string autotile_path = FileSystem::normalize(m_tiles_path + autotile_filename);
+        AutotileParser parser(m_tileset.m_autotilesets, autotile_path);
         parser.parse();
+
+        if (m_cache_data)
+          m_cache_data->sources.push_back(autotile_path);
       }
     }
     else if (iter.get_key() == "import-tileset")
@@ -134,7 +144,7 @@ TileSetParser::parse(int32_t start, int32_t end, int32_t offset, bool imported)
         continue;
       }
       import_offset += offset;
-      TileSetParser import_parser(m_tileset, import_filename);
+      TileSetParser import_parser(m_tileset, import_filename, m_cache_data);
       import_parser.parse(import_start, import_end, import_offset, true);
     }
     else if (iter.get_key() == "additional")
@@ -246,25 +256,41 @@ TileSetParser::parse_tile(const ReaderMapping& reader, int32_t min, int32_t max,
     attributes |= Tile::SOLID | Tile::SLOPE;
   }
 
-  std::vector<SurfacePtr> editor_surfaces;
+  std::vector<TileSetCache::ImageSpec> editor_images;
   std::optional<ReaderMapping> editor_images_mapping;
   if (reader.get("editor-images", editor_images_mapping)) {
-    editor_surfaces = parse_imagespecs(*editor_images_mapping);
+    editor_images = parse_imagespecs(*editor_images_mapping);
   }
 
-  std::vector<SurfacePtr> surfaces;
+  std::vector<TileSetCache::ImageSpec> images;
   std::optional<ReaderMapping> images_mapping;
   if (reader.get("images", images_mapping)) {
-    surfaces = parse_imagespecs(*images_mapping);
+    images = parse_imagespecs(*images_mapping);
   }
 
   bool deprecated = false;
   reader.get("deprecated", deprecated);
 
-  auto tile = std::make_unique<Tile>(surfaces, editor_surfaces,
+  auto tile = std::make_unique<Tile>(TileSetCache::create_surfaces(images),
+                                     TileSetCache::create_surfaces(editor_images),
                                      attributes, data, fps,
                                      deprecated, object_name, object_data);
   m_tileset.add_tile(id, std::move(tile));
+
+  if (m_cache_data)
+  {
+    TileSetCache::TileSpec spec;
+    spec.id = id;
+    spec.attributes = attributes;
+    spec.data = data;
+    spec.fps = fps;
+    spec.deprecated = deprecated;
+    spec.object_name = object_name;
+    spec.object_data = object_data;
+    spec.images = std::move(images);
+    spec.editor_images = std::move(editor_images);
+    m_cache_data->tiles.push_back(std::move(spec));
+  }
 }
 
 void
@@ -350,19 +376,25 @@ TileSetParser::parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max
   {
     if (shared_surface)
     {
-      std::vector<SurfacePtr> editor_surfaces;
+      TileSetCache::SharedImages shared;
       std::optional<ReaderMapping> editor_surfaces_mapping;
       if (reader.get("editor-images", editor_surfaces_mapping)) {
-        editor_surfaces = parse_imagespecs(*editor_surfaces_mapping);
+        shared.editor_images = parse_imagespecs(*editor_surfaces_mapping);
       }
 
-      std::vector<SurfacePtr> surfaces;
       std::optional<ReaderMapping> surfaces_mapping;
       if (reader.get("image", surfaces_mapping) ||
          reader.get("images", surfaces_mapping)) {
-        surfaces = parse_imagespecs(*surfaces_mapping);
+        shared.images = parse_imagespecs(*surfaces_mapping);
       }
 
+      const std::vector<SurfacePtr> surfaces = TileSetCache::create_surfaces(shared.images);
+      const std::vector<SurfacePtr> editor_surfaces = TileSetCache::create_surfaces(shared.editor_images);
+
+      const int32_t shared_index = m_cache_data ? static_cast<int32_t>(m_cache_data->shared_images.size()) : -1;
+      if (m_cache_data)
+        m_cache_data->shared_images.push_back(std::move(shared));
+
       for (size_t i = 0; i < ids.size(); ++i)
       {
         if (!ids[i] || (max && (ids[i] < static_cast<uint32_t>(min) || ids[i] > static_cast<uint32_t>(max)))) continue;
@@ -392,6 +424,19 @@ TileSetParser::parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max
                                            fps, deprecated);
 
         m_tileset.add_tile(ids[i], std::move(tile));
+
+        if (m_cache_data)
+        {
+          TileSetCache::TileSpec spec;
+          spec.id = ids[i];
+          spec.attributes = has_attributes ? attributes[i] : 0;
+          spec.data = has_datas ? datas[i] : 0;
+          spec.fps = fps;
+          spec.deprecated = deprecated;
+          spec.shared = shared_index;
+          spec.shared_region = Rect(x, y, Size(32, 32));
+          m_cache_data->tiles.push_back(std::move(spec));
+        }
       }
     }
     else // (!shared_surface)
@@ -404,50 +449,76 @@ TileSetParser::parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max
         int x = static_cast<int>(32 * (i % width));
         int y = static_cast<int>(32 * (i / width));
 
-        std::vector<SurfacePtr> surfaces;
+        std::vector<TileSetCache::ImageSpec> images;
         std::optional<ReaderMapping> surfaces_mapping;
         if (reader.get("image", surfaces_mapping) ||
            reader.get("images", surfaces_mapping)) {
-          surfaces = parse_imagespecs(*surfaces_mapping, Rect(x, y, Size(32, 32)));
+          images = parse_imagespecs(*surfaces_mapping, Rect(x, y, Size(32, 32)));
         }
 
-        std::vector<SurfacePtr> editor_surfaces;
+        std::vector<TileSetCache::ImageSpec> editor_images;
         std::optional<ReaderMapping> editor_surfaces_mapping;
         if (reader.get("editor-images", editor_surfaces_mapping)) {
-          editor_surfaces = parse_imagespecs(*editor_surfaces_mapping, Rect(x, y, Size(32, 32)));
+          editor_images = parse_imagespecs(*editor_surfaces_mapping, Rect(x, y, Size(32, 32)));
         }
 
-        auto tile = std::make_unique<Tile>(surfaces,
-                                           editor_surfaces,
+        auto tile = std::make_unique<Tile>(TileSetCache::create_surfaces(images),
+                                           TileSetCache::create_surfaces(editor_images),
                                            (has_attributes ? attributes[i] : 0),
                                            (has_datas ? datas[i] : 0),
                                            fps, deprecated);
 
         m_tileset.add_tile(ids[i], std::move(tile));
+
+        if (m_cache_data)
+        {
+          TileSetCache::TileSpec spec;
+          spec.id = ids[i];
+          spec.attributes = has_attributes ? attributes[i] : 0;
+          spec.data = has_datas ? datas[i] : 0;
+          spec.fps = fps;
+          spec.deprecated = deprecated;
+          spec.images = std::move(images);
+          spec.editor_images = std::move(editor_images);
+          m_cache_data->tiles.push_back(std::move(spec));
+        }
       }
     }
   }
 }
 
-std::vector<SurfacePtr>
+std::vector<TileSetCache::ImageSpec>
   TileSetParser::parse_imagespecs(const ReaderMapping& images_mapping,
                                   const std::optional<Rect>& surface_region) const
 {
-  std::vector<SurfacePtr> surfaces;
+  std::vector<TileSetCache::ImageSpec> images;
 
   // (images "foo.png" "foo.bar" ...)
   // (images (region "foo.png" 0 0 32 32))
   auto iter = images_mapping.get_iter();
   while (iter.next())
   {
+    TileSetCache::ImageSpec image;
+    if (surface_region)
+    {
+      image.has_rect = true;
+      image.rect = *surface_region;
+    }
+
     if (iter.is_string())
     {
       std::string file = iter.as_string_item();
-      surfaces.push_back(Surface::from_file(FileSystem::join(m_tiles_path, file), surface_region));
+      image.file = FileSystem::join(m_tiles_path, file);
+      images.push_back(std::move(image));
     }
     else if (iter.is_pair() && iter.get_key() == "surface")
     {
-      surfaces.push_back(Surface::from_reader(iter.as_mapping(), surface_region));
+      // Kept as text, so the cache file can recreate it with all of its options.
+      std::ostringstream out;
+      out << iter.as_mapping().get_sexp();
+      image.file = m_filename;
+      image.surface = out.str();
+      images.push_back(std::move(image));
     }
     else if (iter.is_pair() && iter.get_key() == "region")
     {
@@ -476,8 +547,10 @@ std::vector<SurfacePtr>
           rect.bottom = rect.top + surface_region->get_height();
         }
 
-        surfaces.push_back(Surface::from_file(FileSystem::join(m_tiles_path, file),
-                                              rect));
+        image.file = FileSystem::join(m_tiles_path, file);
+        image.has_rect = true;
+        image.rect = rect;
+        images.push_back(std::move(image));
       }
     }
     else
@@ -486,7 +559,7 @@ std::vector<SurfacePtr>
     }
   }
 
-  return surfaces;
+  return images;
 }
 
 /* EOF */
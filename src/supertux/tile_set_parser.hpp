@@ -24,6 +24,7 @@
 
 #include "math/rect.hpp"
 #include "supertux/tile.hpp"
+#include "supertux/tile_set_cache.hpp"
 
 class ReaderMapping;
 class TileSet;
@@ -35,16 +36,20 @@ private:
   std::string m_filename;
   std::string m_tiles_path;
 
+  /** Records everything parsed for the cache file of the tileset, if set */
+  TileSetCache::Data* m_cache_data;
+
 public:
-  TileSetParser(TileSet& tileset, const std::string& filename);
+  TileSetParser(TileSet& tileset, const std::string& filename,
+                TileSetCache::Data* cache_data = nullptr);
 
   void parse(int32_t start = 0, int32_t end = 0, int32_t offset = 0, bool imported = false);
 
 private:
   void parse_tile(const ReaderMapping& reader, int32_t min, int32_t max, int32_t offset);
   void parse_tiles(const ReaderMapping& reader, int32_t min, int32_t max, int32_t offset);
-  std::vector<SurfacePtr> parse_imagespecs(const ReaderMapping& cur,
-                                           const std::optional<Rect>& region = std::nullopt) const;
+  std::vector<TileSetCache::ImageSpec> parse_imagespecs(const ReaderMapping& cur,
+                                                        const std::optional<Rect>& region = std::nullopt) const;
 
 private:
   TileSetParser(const TileSetParser&) = delete;
@@ -0,0 +1,40 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef HEADER_SUPERTUX_SUPERTUX_TILEMAP_LISTENER_HPP
+#define HEADER_SUPERTUX_SUPERTUX_TILEMAP_LISTENER_HPP
+
+class TileMap;
+
+/** Gets notified about changes to the tilemaps of a GameObjectManager. */
+class TileMapListener
+{
+public:
+  virtual ~TileMapListener()
+  {}
+
+  /** Called after a tilemap has been added or removed, or its tiles,
+      size, offset or tileset have changed. */
+  virtual void tilemap_changed(const TileMap& tilemap) = 0;
+
+  /** Called after a single tile of a tilemap has changed. */
+  virtual void tilemap_tile_changed(const TileMap& tilemap, int x, int y) = 0;
+};
+
+#endif
+
+/* EOF */
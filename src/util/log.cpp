@@ -18,6 +18,8 @@
 #include "util/log.hpp"
 
 #include <iostream>
+#include <sstream>
+#include <thread>
 #ifdef __ANDROID__
 #include <android/log.h>
 #endif
@@ -99,10 +101,56 @@ static std::ostream android_logcat(new _android_debugbuf());
 
 LogLevel g_log_level = LOG_WARNING;
 
+namespace {
+
+const std::thread::id s_main_thread_id = std::this_thread::get_id();
+
+bool is_main_thread()
+{
+  return std::this_thread::get_id() == s_main_thread_id;
+}
+
+/** Collects messages logged on a thread other than the main one, and
+    hands each one over to the console buffer as a whole once flushed. */
+class ThreadLogStreamBuffer final : public std::stringbuf
+{
+public:
+  virtual int sync() override
+  {
+    int result = std::stringbuf::sync();
+
+    std::string s = str();
+    if (s.empty() || (s.back() != '\n' && s.back() != '\r'))
+      return result;
+
+    while (!s.empty() && (s.back() == '\n' || s.back() == '\r'))
+      s.pop_back();
+
+    if (ConsoleBuffer::current())
+      ConsoleBuffer::current()->queue_lines(s);
+    else
+      std::cerr << s << std::endl;
+
+    str("");
+    return result;
+  }
+};
+
+} // namespace
+
 std::ostream& get_logging_instance(bool use_console_buffer)
 {
   if (ConsoleBuffer::current() && use_console_buffer)
-    return (ConsoleBuffer::output);
+  {
+    if (is_main_thread())
+      return (ConsoleBuffer::output);
+
+    // The console isn't thread-safe, so messages from other threads are
+    // queued, to be added to it on the main thread.
+    thread_local ThreadLogStreamBuffer thread_buffer;
+    thread_local std::ostream thread_output(&thread_buffer);
+    return thread_output;
+  }
   else
 #ifdef __ANDROID__
     return android_logcat;
@@ -129,7 +177,7 @@ std::ostream& log_info_f(const char* file, int line)
 
 std::ostream& log_warning_f(const char* file, int line)
 {
-  if (g_config && g_config->developer_mode &&
+  if (g_config && g_config->developer_mode && is_main_thread() &&
      Console::current() && !Console::current()->hasFocus()) {
     Console::current()->open();
   }
@@ -138,7 +186,7 @@ std::ostream& log_warning_f(const char* file, int line)
 
 std::ostream& log_fatal_f(const char* file, int line)
 {
-  if (g_config && g_config->developer_mode &&
+  if (g_config && g_config->developer_mode && is_main_thread() &&
      Console::current() && !Console::current()->hasFocus()) {
     Console::current()->open();
   }
@@ -0,0 +1,230 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/thread_pool.hpp"
+
+#include <algorithm>
+#include <assert.h>
+
+#include "util/log.hpp"
+
+namespace {
+
+/** Amount of ranges queued per thread. More ranges give more
+    opportunities for stealing, but increase the locking overhead. */
+const size_t RANGES_PER_THREAD = 4;
+
+} // namespace
+
+thread_local bool ThreadPool::s_in_job = false;
+
+ThreadPool::ThreadPool(int worker_count) :
+  m_workers(),
+  m_queues(),
+  m_mutex(),
+  m_wake_condition(),
+  m_done_condition(),
+  m_job(nullptr),
+  m_job_generation(0),
+  m_remaining(0),
+  m_exception(),
+  m_quit(false)
+{
+#ifdef __EMSCRIPTEN__
+  // Threads are not available in the browser build.
+  worker_count = 0;
+#else
+  if (worker_count < 0)
+    worker_count = std::max(static_cast<int>(std::thread::hardware_concurrency()) - 1, 0);
+#endif
+
+  for (int i = 0; i < worker_count + 1; ++i)
+    m_queues.push_back(std::make_unique<Queue>());
+
+  for (int i = 0; i < worker_count; ++i)
+    m_workers.emplace_back(&ThreadPool::worker_main, this, static_cast<size_t>(i));
+
+  log_info << "Started thread pool with " << worker_count << " worker threads." << std::endl;
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_wake_condition.notify_all();
+
+  for (auto& worker : m_workers)
+    worker.join();
+}
+
+void
+ThreadPool::parallel_for(size_t count, const std::function<void (size_t)>& func)
+{
+  assert(!s_in_job);
+
+  if (count == 0)
+    return;
+
+  const size_t caller_queue = m_workers.size();
+  if (m_workers.empty() || count == 1)
+  {
+    s_in_job = true;
+    try
+    {
+      for (size_t i = 0; i < count; ++i)
+        func(i);
+    }
+    catch (...)
+    {
+      s_in_job = false;
+      throw;
+    }
+    s_in_job = false;
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_job = &func;
+    m_remaining = count;
+    m_exception = nullptr;
+  }
+
+  // Split the indices into ranges and distribute them over all queues.
+  // The job has to be set up first, as threads still busy with stealing
+  // might pick up the ranges as soon as they are queued.
+  const size_t range_count = std::min(count, m_queues.size() * RANGES_PER_THREAD);
+  const size_t range_size = count / range_count;
+  const size_t range_remainder = count % range_count;
+  size_t begin = 0;
+  for (size_t i = 0; i < range_count; ++i)
+  {
+    const size_t end = begin + range_size + (i < range_remainder ? 1 : 0);
+
+    Queue& queue = *m_queues[i % m_queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.ranges.push_back({ begin, end });
+
+    begin = end;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_job_generation += 1;
+  }
+  m_wake_condition.notify_all();
+
+  run_ranges(caller_queue);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done_condition.wait(lock, [this] { return m_remaining == 0; });
+    m_job = nullptr;
+    exception = m_exception;
+    m_exception = nullptr;
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+void
+ThreadPool::worker_main(size_t queue_idx)
+{
+  size_t last_generation = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake_condition.wait(lock, [this, last_generation] {
+          return m_quit || m_job_generation != last_generation;
+        });
+
+      if (m_quit)
+        return;
+
+      last_generation = m_job_generation;
+    }
+
+    run_ranges(queue_idx);
+  }
+}
+
+void
+ThreadPool::run_ranges(size_t queue_idx)
+{
+  s_in_job = true;
+
+  Range range;
+  while (pop_range(queue_idx, range) || steal_range(queue_idx, range))
+  {
+    try
+    {
+      for (size_t i = range.begin; i < range.end; ++i)
+        (*m_job)(i);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (!m_exception)
+        m_exception = std::current_exception();
+    }
+
+    if (m_remaining.fetch_sub(range.end - range.begin) == range.end - range.begin)
+    {
+      // This was the last range of the job, wake up the calling thread.
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_done_condition.notify_all();
+    }
+  }
+
+  s_in_job = false;
+}
+
+bool
+ThreadPool::pop_range(size_t queue_idx, Range& range)
+{
+  Queue& queue = *m_queues[queue_idx];
+  std::lock_guard<std::mutex> lock(queue.mutex);
+  if (queue.ranges.empty())
+    return false;
+
+  range = queue.ranges.front();
+  queue.ranges.pop_front();
+  return true;
+}
+
+bool
+ThreadPool::steal_range(size_t queue_idx, Range& range)
+{
+  for (size_t i = 1; i < m_queues.size(); ++i)
+  {
+    Queue& queue = *m_queues[(queue_idx + i) % m_queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.ranges.empty())
+      continue;
+
+    range = queue.ranges.back();
+    queue.ranges.pop_back();
+    return true;
+  }
+  return false;
+}
+
+/* EOF */
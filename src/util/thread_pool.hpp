@@ -0,0 +1,111 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_THREAD_POOL_HPP
+#define HEADER_SUPERTUX_UTIL_THREAD_POOL_HPP
+
+#include "util/currenton.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A pool of worker threads for splitting short, CPU-bound jobs,
+   which have to finish within the current frame.
+
+   Each thread, including the one calling parallel_for(), owns a queue
+   of index ranges. Threads work through their own queue first and
+   steal ranges from the other queues once it runs empty, so uneven
+   work per index is balanced out.
+ */
+class ThreadPool final : public Currenton<ThreadPool>
+{
+private:
+  struct Range
+  {
+    size_t begin;
+    size_t end;
+  };
+
+  struct Queue
+  {
+    Queue() : mutex(), ranges() {}
+
+    std::mutex mutex;
+    std::deque<Range> ranges;
+  };
+
+public:
+  /** Returns true, if the current thread is executing a parallel_for() job. */
+  static bool in_job() { return s_in_job; }
+
+private:
+  static thread_local bool s_in_job;
+
+public:
+  /** Creates a pool with the given amount of worker threads.
+      If negative, one less than the amount of hardware threads is used. */
+  ThreadPool(int worker_count = -1);
+  ~ThreadPool() override;
+
+  /** Calls func(i) for every i in [0, count) and returns once all calls
+      have finished. The calls are distributed over the worker threads and
+      the calling thread. If any call throws, the first exception is
+      rethrown here. Must not be called from within a job. */
+  void parallel_for(size_t count, const std::function<void (size_t)>& func);
+
+  int get_worker_count() const { return static_cast<int>(m_workers.size()); }
+
+private:
+  void worker_main(size_t queue_idx);
+
+  /** Runs ranges from the given queue, and stolen ones, until no ranges are left. */
+  void run_ranges(size_t queue_idx);
+
+  bool pop_range(size_t queue_idx, Range& range);
+  bool steal_range(size_t queue_idx, Range& range);
+
+private:
+  std::vector<std::thread> m_workers;
+
+  /** One queue per worker, followed by the queue of the calling thread. */
+  std::vector<std::unique_ptr<Queue>> m_queues;
+
+  std::mutex m_mutex;
+  std::condition_variable m_wake_condition;
+  std::condition_variable m_done_condition;
+
+  const std::function<void (size_t)>* m_job;
+  size_t m_job_generation;
+  std::atomic<size_t> m_remaining;
+  std::exception_ptr m_exception;
+  bool m_quit;
+
+private:
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+};
+
+#endif
+
+/* EOF */
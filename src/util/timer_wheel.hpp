@@ -0,0 +1,205 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_TIMER_WHEEL_HPP
+#define HEADER_SUPERTUX_UTIL_TIMER_WHEEL_HPP
+
+#include <algorithm>
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+/**
+ * A hierarchical timer wheel, scheduling values for integer ticks.
+
+   Each level has 64 slots, with a slot of a level spanning all slots of
+   the level below it. Values are put in the lowest level their tick
+   fits in, and moved down a level whenever the wheel passes the start
+   of their slot, so inserting and expiring values doesn't depend on the
+   amount of scheduled values. Values scheduled further ahead than the
+   highest level reaches are kept in its last slot until they fit.
+ */
+template<class T>
+class TimerWheel final
+{
+private:
+  struct Entry
+  {
+    uint64_t tick;
+    T value;
+  };
+
+  using Slot = std::vector<Entry>;
+
+  static constexpr int SLOT_BITS = 6;
+  static constexpr uint64_t SLOT_COUNT = 1 << SLOT_BITS;
+  static constexpr uint64_t SLOT_MASK = SLOT_COUNT - 1;
+  static constexpr int LEVEL_COUNT = 4;
+
+public:
+  TimerWheel(uint64_t tick = 0) :
+    m_current_tick(tick),
+    m_levels(),
+    m_level_sizes(),
+    m_size(0)
+  {}
+
+  /** Schedules the value for the given tick. Values scheduled for the
+      current tick or earlier expire on the next advance(). */
+  void insert(uint64_t tick, T value)
+  {
+    if (tick <= m_current_tick)
+      tick = m_current_tick + 1;
+
+    place({ tick, std::move(value) });
+    m_size += 1;
+  }
+
+  /** Advances the wheel to the given tick and calls func() with every
+      value that expired on the way, in order of their ticks. func() is
+      only called once the wheel has reached the tick, so values inserted
+      by it expire on a later advance(). */
+  template<class F>
+  void advance(uint64_t tick, F func)
+  {
+    std::vector<T> expired;
+    while (m_current_tick < tick)
+    {
+      if (m_size == 0)
+      {
+        m_current_tick = tick;
+        break;
+      }
+
+      // With the lower levels empty, nothing happens until the next slot
+      // of the lowest level with entries starts.
+      int level = 0;
+      while (level < LEVEL_COUNT - 1 && m_level_sizes[level] == 0)
+        level += 1;
+
+      if (level > 0)
+      {
+        const uint64_t span = uint64_t(1) << (level * SLOT_BITS);
+        const uint64_t next_slot = (m_current_tick / span + 1) * span;
+        m_current_tick = std::max(m_current_tick, std::min(tick, next_slot - 1));
+        if (m_current_tick == tick)
+          break;
+      }
+
+      m_current_tick += 1;
+      cascade();
+
+      Slot& slot = m_levels[0][m_current_tick & SLOT_MASK];
+      for (auto& entry : slot)
+        expired.push_back(std::move(entry.value));
+      m_level_sizes[0] -= slot.size();
+      m_size -= slot.size();
+      slot.clear();
+    }
+
+    for (auto& value : expired)
+      func(value);
+  }
+
+  /** Removes all values, calling func() with each of them. */
+  template<class F>
+  void take_all(F func)
+  {
+    std::vector<T> values;
+    values.reserve(m_size);
+    m_level_sizes.fill(0);
+    for (auto& level : m_levels)
+    {
+      for (auto& slot : level)
+      {
+        for (auto& entry : slot)
+          values.push_back(std::move(entry.value));
+        slot.clear();
+      }
+    }
+    m_size = 0;
+
+    for (auto& value : values)
+      func(value);
+  }
+
+  uint64_t get_current_tick() const { return m_current_tick; }
+  size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+
+private:
+  void place(Entry entry)
+  {
+    const uint64_t delta = entry.tick - m_current_tick;
+    for (int level = 0; level < LEVEL_COUNT; ++level)
+    {
+      if (delta < (SLOT_COUNT << (level * SLOT_BITS)))
+      {
+        m_levels[level][(entry.tick >> (level * SLOT_BITS)) & SLOT_MASK].push_back(std::move(entry));
+        m_level_sizes[level] += 1;
+        return;
+      }
+    }
+
+    // Too far ahead, park the entry in the slot which is reached last.
+    const int level = LEVEL_COUNT - 1;
+    const uint64_t last_tick = m_current_tick + (SLOT_COUNT << (level * SLOT_BITS)) - 1;
+    m_levels[level][(last_tick >> (level * SLOT_BITS)) & SLOT_MASK].push_back(std::move(entry));
+    m_level_sizes[level] += 1;
+  }
+
+  /** Moves the entries of the slots starting at the current tick down. */
+  void cascade()
+  {
+    // A slot of a level starts at the current tick, if all bits of the
+    // levels below it are zero.
+    int top_level = 0;
+    while (top_level + 1 < LEVEL_COUNT &&
+           (m_current_tick & ((uint64_t(1) << ((top_level + 1) * SLOT_BITS)) - 1)) == 0)
+      top_level += 1;
+
+    // Higher levels go first, as their entries might end up in the slots
+    // of the lower levels, which start at the current tick as well.
+    for (int level = top_level; level > 0; --level)
+    {
+      Slot& slot = m_levels[level][(m_current_tick >> (level * SLOT_BITS)) & SLOT_MASK];
+      Slot entries = std::move(slot);
+      slot.clear();
+      m_level_sizes[level] -= entries.size();
+
+      // Entries due now end up in the current slot of the lowest level,
+      // which is expired right after cascading.
+      for (auto& entry : entries)
+        place(std::move(entry));
+    }
+  }
+
+private:
+  uint64_t m_current_tick;
+  std::array<std::array<Slot, SLOT_COUNT>, LEVEL_COUNT> m_levels;
+  std::array<size_t, LEVEL_COUNT> m_level_sizes;
+  size_t m_size;
+
+private:
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+};
+
+#endif
+
+/* EOF */
@@ -34,6 +34,12 @@ struct hash<UID>
 
 } // namespace std {
 
+/**
+ * A unique identifier for objects. Consists of the magic number of the
+   generator that created it, and a slot index and generation, which
+   allow for constant time lookups in a UIDTable. UIDs that are not
+   created for a table slot use a counter as the index instead.
+ */
 class UID
 {
   friend class UIDGenerator;
@@ -44,7 +50,7 @@ public:
   using Magic = uint8_t;
 
 private:
-  explicit UID(uint32_t value) :
+  explicit UID(uint64_t value) :
     m_value(value)
   {
     assert(m_value != 0);
@@ -71,10 +77,12 @@ public:
     return m_value != other.m_value;
   }
 
-  inline Magic get_magic() const { return static_cast<Magic>((m_value & 0xffff0000u) >> 16); }
+  inline Magic get_magic() const { return static_cast<Magic>(m_value >> 56); }
+  inline uint32_t get_generation() const { return static_cast<uint32_t>(m_value >> 32) & 0xffffffu; }
+  inline uint32_t get_index() const { return static_cast<uint32_t>(m_value); }
 
 protected:
-  uint32_t m_value;
+  uint64_t m_value;
 };
 
 std::ostream& operator<<(std::ostream& os, const UID& uid);
@@ -35,13 +35,21 @@ UIDGenerator::next()
 {
   m_id_counter += 1;
 
-  if (m_id_counter > 0xffffff)
+  if (m_id_counter == 0)
   {
     log_warning << "UIDGenerator overflow" << std::endl;
-    m_id_counter = 0;
+    m_id_counter = 1;
   }
 
-  return UID((m_magic << 24) | m_id_counter);
+  return make(0, m_id_counter);
+}
+
+UID
+UIDGenerator::make(uint32_t generation, uint32_t index) const
+{
+  return UID((static_cast<uint64_t>(m_magic) << 56) |
+             (static_cast<uint64_t>(generation & 0xffffffu) << 32) |
+             index);
 }
 
 /* EOF */
@@ -29,6 +29,12 @@ public:
 
   UID next();
 
+  /** Returns the UID for the given generation of a UIDTable slot. */
+  UID make(uint32_t generation, uint32_t index) const;
+
+  /** Returns true, if the UID might have been created by this generator. */
+  bool owns(const UID& uid) const { return uid.get_magic() == m_magic; }
+
 private:
   uint8_t m_magic;
   uint32_t m_id_counter;
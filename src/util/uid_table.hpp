@@ -0,0 +1,176 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef HEADER_SUPERTUX_UTIL_UID_TABLE_HPP
+#define HEADER_SUPERTUX_UTIL_UID_TABLE_HPP
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "util/uid.hpp"
+#include "util/uid_generator.hpp"
+
+/**
+ * A generational slot table, mapping UIDs to objects.
+
+   UIDs created by the table encode the index of their slot, so lookups
+   don't need any hashing. Each slot has a generation, which is increased
+   once its object is removed, so UIDs of removed objects don't resolve
+   to objects that reuse the slot later on.
+
+   Objects added with a UID created elsewhere (e.g. moved from another
+   table) are kept in a hash map instead. Objects re-added with their
+   old UID (e.g. on undo/redo) get their old slot back, if it's free.
+ */
+template<class T>
+class UIDTable final
+{
+private:
+  struct Slot
+  {
+    T* object;
+    UID uid;
+    uint32_t generation;
+  };
+
+  static constexpr uint32_t MAX_GENERATION = 0xffffffu;
+
+public:
+  UIDTable() :
+    m_generator(),
+    m_slots(),
+    m_free_slots(),
+    m_foreign_objects()
+  {}
+
+  /** Adds an object and returns a newly created UID for it. */
+  UID insert(T* object)
+  {
+    uint32_t index;
+    if (m_free_slots.empty())
+    {
+      index = static_cast<uint32_t>(m_slots.size());
+      m_slots.push_back({ nullptr, UID(), 1 });
+    }
+    else
+    {
+      index = m_free_slots.back();
+      m_free_slots.pop_back();
+    }
+
+    Slot& slot = m_slots[index];
+    slot.object = object;
+    slot.uid = m_generator.make(slot.generation, index);
+    return slot.uid;
+  }
+
+  /** Adds an object with an existing UID. */
+  void insert(const UID& uid, T* object)
+  {
+    assert(uid);
+
+    const uint32_t index = uid.get_index();
+    if (m_generator.owns(uid) && index < m_slots.size() && !m_slots[index].object)
+    {
+      auto it = std::find(m_free_slots.begin(), m_free_slots.end(), index);
+      if (it != m_free_slots.end())
+      {
+        m_free_slots.erase(it);
+
+        Slot& slot = m_slots[index];
+        slot.object = object;
+        slot.uid = uid;
+        // Don't hand out generations again, which have been used since.
+        slot.generation = std::max(slot.generation, uid.get_generation());
+        return;
+      }
+    }
+
+    m_foreign_objects[uid] = object;
+  }
+
+  /** Removes the object with the given UID. */
+  void erase(const UID& uid)
+  {
+    Slot* slot = find_slot(uid);
+    if (!slot)
+    {
+      m_foreign_objects.erase(uid);
+      return;
+    }
+
+    slot->object = nullptr;
+    slot->uid = UID();
+    slot->generation = slot->generation % MAX_GENERATION + 1;
+    m_free_slots.push_back(uid.get_index());
+  }
+
+  /** Returns the object with the given UID, or nullptr if there is none. */
+  T* get(const UID& uid) const
+  {
+    const Slot* slot = find_slot(uid);
+    if (slot)
+      return slot->object;
+
+    if (m_foreign_objects.empty())
+      return nullptr;
+
+    auto it = m_foreign_objects.find(uid);
+    return it == m_foreign_objects.end() ? nullptr : it->second;
+  }
+
+  /** Removes all objects. The slots are kept with increased generations,
+      so UIDs of the removed objects don't resolve to objects added later. */
+  void clear()
+  {
+    for (auto& slot : m_slots)
+    {
+      if (slot.object)
+        erase(slot.uid);
+    }
+    m_foreign_objects.clear();
+  }
+
+private:
+  const Slot* find_slot(const UID& uid) const
+  {
+    const uint32_t index = uid.get_index();
+    if (index >= m_slots.size() || !m_slots[index].object || m_slots[index].uid != uid)
+      return nullptr;
+
+    return &m_slots[index];
+  }
+
+  Slot* find_slot(const UID& uid)
+  {
+    return const_cast<Slot*>(static_cast<const UIDTable*>(this)->find_slot(uid));
+  }
+
+private:
+  UIDGenerator m_generator;
+  std::vector<Slot> m_slots;
+  std::vector<uint32_t> m_free_slots;
+  std::unordered_map<UID, T*> m_foreign_objects;
+
+private:
+  UIDTable(const UIDTable&) = delete;
+  UIDTable& operator=(const UIDTable&) = delete;
+};
+
+#endif
+
+/* EOF */
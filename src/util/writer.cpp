@@ -16,30 +16,76 @@
 
 #include "util/writer.hpp"
 
+#include <assert.h>
+#include <fmt/format.h>
+#include <iterator>
 #include <sexp/value.hpp>
-#include <sexp/io.hpp>
 
 #include "physfs/ofile_stream.hpp"
 #include "util/log.hpp"
 
+namespace {
+
+/** The buffer is passed on to the stream, once it has grown this large. */
+const size_t FLUSH_SIZE = 65536;
+
+} // namespace
+
+void
+Writer::write_deferred(std::ostream& out, const std::string& data,
+                       const std::vector<DeferredTiles>& deferred_tiles)
+{
+  Writer writer(out);
+
+  size_t pos = 0;
+  for (const auto& tiles : deferred_tiles)
+  {
+    writer.m_buffer->append(data, pos, tiles.offset - pos);
+    pos = tiles.offset;
+
+    writer.indent_depth = tiles.indent_depth;
+    writer.write(tiles.name, tiles.values.data(), tiles.values.size(), tiles.width);
+  }
+  writer.m_buffer->append(data, pos, std::string::npos);
+  writer.indent_depth = 0;
+}
+
 Writer::Writer(const std::string& filename) :
   m_filename(filename),
   out(new OFileStream(filename)),
   out_owned(true),
+  m_own_buffer(),
+  m_buffer(&m_own_buffer),
+  m_deferred_tiles(nullptr),
   indent_depth(0),
   lists()
 {
-  out->precision(7);
+  m_own_buffer.reserve(FLUSH_SIZE);
 }
 
 Writer::Writer(std::ostream& newout) :
   m_filename("<stream>"),
   out(&newout),
   out_owned(false),
+  m_own_buffer(),
+  m_buffer(&m_own_buffer),
+  m_deferred_tiles(nullptr),
+  indent_depth(0),
+  lists()
+{
+  m_own_buffer.reserve(FLUSH_SIZE);
+}
+
+Writer::Writer(std::string& newout) :
+  m_filename("<string>"),
+  out(nullptr),
+  out_owned(false),
+  m_own_buffer(),
+  m_buffer(&newout),
+  m_deferred_tiles(nullptr),
   indent_depth(0),
   lists()
 {
-  out->precision(7);
 }
 
 Writer::~Writer()
@@ -47,6 +93,7 @@ Writer::~Writer()
   if (lists.size() > 0) {
     log_warning << m_filename << ": Not all sections closed in Writer" << std::endl;
   }
+  flush();
   if (out_owned)
     delete out;
 }
@@ -54,19 +101,19 @@ Writer::~Writer()
 void
 Writer::write_comment(const std::string& comment)
 {
-  *out << "; " << comment << "\n";
+  m_buffer->append("; ").append(comment).push_back('\n');
 }
 
 void
 Writer::start_list(const std::string& listname, bool string)
 {
   indent();
-  *out << '(';
+  m_buffer->push_back('(');
   if (string)
     write_escaped_string(listname);
   else
-    *out << listname;
-  *out << '\n';
+    m_buffer->append(listname);
+  m_buffer->push_back('\n');
   indent_depth += 2;
 
   lists.push_back(listname);
@@ -87,21 +134,27 @@ Writer::end_list(const std::string& listname)
 
   indent_depth -= 2;
   indent();
-  *out << ")\n";
+  m_buffer->append(")\n");
 }
 
 void
 Writer::write(const std::string& name, int value)
 {
   indent();
-  *out << '(' << name << ' ' << value << ")\n";
+  m_buffer->push_back('(');
+  m_buffer->append(name).push_back(' ');
+  write_int(value);
+  m_buffer->append(")\n");
 }
 
 void
 Writer::write(const std::string& name, float value)
 {
   indent();
-  *out << '(' << name << ' ' << value << ")\n";
+  m_buffer->push_back('(');
+  m_buffer->append(name).push_back(' ');
+  write_float(value);
+  m_buffer->append(")\n");
 }
 
 /** This function is needed to properly resolve the overloaded write()
@@ -118,15 +171,16 @@ Writer::write(const std::string& name, const std::string& value,
               bool translatable)
 {
   indent();
-  *out << '(' << name;
+  m_buffer->push_back('(');
+  m_buffer->append(name);
   if (translatable) {
-    *out << " (_ ";
+    m_buffer->append(" (_ ");
     write_escaped_string(value);
-    *out << "))\n";
+    m_buffer->append("))\n");
   } else {
-    *out << " ";
+    m_buffer->push_back(' ');
     write_escaped_string(value);
-    *out << ")\n";
+    m_buffer->append(")\n");
   }
 }
 
@@ -134,7 +188,8 @@ void
 Writer::write(const std::string& name, bool value)
 {
   indent();
-  *out << '(' << name << ' ' << (value ? "#t" : "#f") << ")\n";
+  m_buffer->push_back('(');
+  m_buffer->append(name).append(value ? " #t)\n" : " #f)\n");
 }
 
 void
@@ -142,10 +197,13 @@ Writer::write(const std::string& name,
               const std::vector<int>& value)
 {
   indent();
-  *out << '(' << name;
-  for (const auto& i : value)
-    *out << " " << i;
-  *out << ")\n";
+  m_buffer->push_back('(');
+  m_buffer->append(name);
+  for (const auto& i : value) {
+    m_buffer->push_back(' ');
+    write_int(i);
+  }
+  m_buffer->append(")\n");
 }
 
 void
@@ -153,31 +211,54 @@ Writer::write(const std::string& name,
               const std::vector<unsigned int>& value,
               int width)
 {
+  write(name, value.data(), value.size(), width);
+}
+
+void
+Writer::write(const std::string& name,
+              const unsigned int* values, size_t count,
+              int width)
+{
+  if (m_deferred_tiles && width)
+  {
+    m_deferred_tiles->push_back({ m_buffer->size(), indent_depth, name,
+                                  std::vector<unsigned int>(values, values + count), width });
+    return;
+  }
+
   indent();
-  *out << '(' << name;
+  m_buffer->push_back('(');
+  m_buffer->append(name);
   if (!width)
   {
-    for (const auto& i : value)
-      *out << " " << i;
+    for (size_t i = 0; i < count; ++i) {
+      m_buffer->push_back(' ');
+      write_int(values[i]);
+    }
   }
   else
   {
-    *out << "\n";
+    // Reserve enough space for most tile IDs, so the buffer is grown only once.
+    const size_t rows = count / static_cast<size_t>(width) + 1;
+    m_buffer->reserve(m_buffer->size() + count * 5 + rows * (indent_depth + 1) + 2);
+
+    m_buffer->push_back('\n');
     indent();
-    int count = 0;
-    for (const auto& i : value) {
-      *out << i;
-      count += 1;
-      if (count >= width) {
-        *out << "\n";
+    int column = 0;
+    for (size_t i = 0; i < count; ++i) {
+      const fmt::format_int text(values[i]);
+      m_buffer->append(text.data(), text.size());
+      column += 1;
+      if (column >= width) {
+        m_buffer->push_back('\n');
         indent();
-        count = 0;
+        column = 0;
       } else {
-        *out << " ";
+        m_buffer->push_back(' ');
       }
     }
   }
-  *out << ")\n";
+  m_buffer->append(")\n");
 }
 
 void
@@ -185,10 +266,13 @@ Writer::write(const std::string& name,
               const std::vector<float>& value)
 {
   indent();
-  *out << '(' << name;
-  for (const auto& i : value)
-    *out << " " << i;
-  *out << ")\n";
+  m_buffer->push_back('(');
+  m_buffer->append(name);
+  for (const auto& i : value) {
+    m_buffer->push_back(' ');
+    write_float(i);
+  }
+  m_buffer->append(")\n");
 }
 
 void
@@ -196,12 +280,13 @@ Writer::write(const std::string& name,
               const std::vector<std::string>& value)
 {
   indent();
-  *out << '(' << name;
+  m_buffer->push_back('(');
+  m_buffer->append(name);
   for (const auto& i : value) {
-    *out << " ";
+    m_buffer->push_back(' ');
     write_escaped_string(i);
   }
-  *out << ")\n";
+  m_buffer->append(")\n");
 }
 
 void
@@ -215,17 +300,17 @@ Writer::write_sexp(const sexp::Value& value, bool fudge)
     } else {
       indent();
     }
-    *out << "(";
+    m_buffer->push_back('(');
     auto& arr = value.as_array();
     for(size_t i = 0; i < arr.size(); ++i) {
       write_sexp(arr[i], false);
       if (i != arr.size() - 1) {
-        *out << " ";
+        m_buffer->push_back(' ');
       }
     }
-    *out << ")\n";
+    m_buffer->append(")\n");
   } else {
-    *out << value;
+    m_buffer->append(value.str());
   }
 }
 
@@ -233,34 +318,74 @@ void
 Writer::write(const std::string& name, const sexp::Value& value)
 {
   indent();
-  *out << '(' << name << "\n";
+  m_buffer->push_back('(');
+  m_buffer->append(name).push_back('\n');
   indent_depth += 4;
   write_sexp(value, true);
   indent_depth -= 4;
   indent();
-  *out << ")\n";
+  m_buffer->append(")\n");
+}
+
+void
+Writer::set_deferred_tiles(std::vector<DeferredTiles>* deferred_tiles)
+{
+  assert(!out);
+  m_deferred_tiles = deferred_tiles;
 }
 
 void
 Writer::write_escaped_string(const std::string& str)
 {
-  *out << '"';
-  for (const char* c = str.c_str(); *c != 0; ++c) {
-    if (*c == '\"')
-      *out << "\\\"";
-    else if (*c == '\\')
-      *out << "\\\\";
-    else
-      *out << *c;
+  m_buffer->push_back('"');
+  size_t start = 0;
+  while (true) {
+    const size_t pos = str.find_first_of("\"\\", start);
+    if (pos == std::string::npos)
+      break;
+
+    m_buffer->append(str, start, pos - start);
+    m_buffer->push_back('\\');
+    m_buffer->push_back(str[pos]);
+    start = pos + 1;
   }
-  *out << '"';
+  m_buffer->append(str, start, std::string::npos);
+  m_buffer->push_back('"');
+}
+
+void
+Writer::write_int(long long value)
+{
+  const fmt::format_int text(value);
+  m_buffer->append(text.data(), text.size());
+}
+
+void
+Writer::write_float(float value)
+{
+  // Same as the default formatting of streams with a precision of 7.
+  fmt::format_to(std::back_inserter(*m_buffer), "{:.7g}", value);
 }
 
 void
 Writer::indent()
 {
-  for (int i = 0; i<indent_depth; ++i)
-    *out << ' ';
+  // Every entry starts with its indentation, so this is where
+  // the buffer is checked for being full.
+  if (m_buffer->size() >= FLUSH_SIZE)
+    flush();
+
+  m_buffer->append(static_cast<size_t>(indent_depth), ' ');
+}
+
+void
+Writer::flush()
+{
+  if (!out || m_buffer->empty())
+    return;
+
+  out->write(m_buffer->data(), static_cast<std::streamsize>(m_buffer->size()));
+  m_buffer->clear();
 }
 
 /* EOF */
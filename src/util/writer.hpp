@@ -17,6 +17,7 @@
 #ifndef HEADER_SUPERTUX_UTIL_WRITER_HPP
 #define HEADER_SUPERTUX_UTIL_WRITER_HPP
 
+#include <stddef.h>
 #include <string>
 #include <vector>
 
@@ -24,11 +25,33 @@ namespace sexp {
 class Value;
 } // namespace sexp
 
+/** Writes S-expressions. The output is formatted into a memory buffer,
+    which is passed on to the stream in large blocks, or is the target
+    string itself, so no stream operations are involved per entry. */
 class Writer final
 {
+public:
+  /** A tile array, which has been copied instead of formatted. */
+  struct DeferredTiles
+  {
+    /** Position in the output, at which the array belongs */
+    size_t offset;
+    int indent_depth;
+    std::string name;
+    std::vector<unsigned int> values;
+    int width;
+  };
+
+  /** Writes output, which has been created with deferred tile arrays,
+      formatting the arrays in place. See set_deferred_tiles(). */
+  static void write_deferred(std::ostream& out, const std::string& data,
+                             const std::vector<DeferredTiles>& deferred_tiles);
+
 public:
   Writer(const std::string& filename);
   Writer(std::ostream& out);
+  /** Appends the output to the given string. */
+  Writer(std::string& out);
   ~Writer();
 
   void write_comment(const std::string& comment);
@@ -42,6 +65,8 @@ public:
   void write(const std::string& name, const std::string& value, bool translatable = false);
   void write(const std::string& name, const std::vector<int>& value);
   void write(const std::string& name, const std::vector<unsigned int>& value, int width = 0);
+  /** Writes an array of tiles in one go, in rows of the given width, if not 0. */
+  void write(const std::string& name, const unsigned int* values, size_t count, int width = 0);
   void write(const std::string& name, const std::vector<float>& value);
   void write(const std::string& name, const std::vector<std::string>& value);
   void write(const std::string& name, const sexp::Value& value);
@@ -49,15 +74,27 @@ public:
 
   void end_list(const std::string& listname);
 
+  /** Copies tile arrays with a width into the given list, instead of
+      formatting them, which can then be done later on, e.g. on another
+      thread, by write_deferred(). Only for output into a string. */
+  void set_deferred_tiles(std::vector<DeferredTiles>* deferred_tiles);
+
 private:
   void write_escaped_string(const std::string& str);
   void write_sexp(const sexp::Value& value, bool fudge);
+  void write_int(long long value);
+  void write_float(float value);
   void indent();
+  void flush();
 
 private:
   std::string m_filename;
   std::ostream* out;
   bool out_owned;
+  /** Formatted output, which hasn't been written to the stream yet */
+  std::string m_own_buffer;
+  std::string* m_buffer;
+  std::vector<DeferredTiles>* m_deferred_tiles;
   int indent_depth;
   std::vector<std::string> lists;
 
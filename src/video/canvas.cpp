@@ -97,6 +97,10 @@ Canvas::render(Renderer& renderer, Filter filter)
         painter.draw_line(static_cast<const LineRequest&>(request));
         break;
 
+      case RequestType::LINES:
+        painter.draw_lines(static_cast<const LinesRequest&>(request));
+        break;
+
       case RequestType::TRIANGLE:
         painter.draw_triangle(static_cast<const TriangleRequest&>(request));
         break;
@@ -315,6 +319,27 @@ Canvas::draw_line(const Vector& pos1, const Vector& pos2, const Color& color, in
   m_requests.push_back(request);
 }
 
+void
+Canvas::draw_lines(const std::vector<Vector>& points, const Color& color, int layer)
+{
+  assert(points.size() % 2 == 0);
+
+  if (points.empty())
+    return;
+
+  auto request = new(m_obst) LinesRequest(m_context.transform());
+
+  request->layer = layer;
+
+  request->points.reserve(points.size());
+  for (const auto& point : points)
+    request->points.push_back(apply_translate(point) * scale());
+  request->color = color;
+  request->color.alpha = color.alpha * m_context.transform().alpha;
+
+  m_requests.push_back(request);
+}
+
 void
 Canvas::draw_triangle(const Vector& pos1, const Vector& pos2, const Vector& pos3, const Color& color, int layer)
 {
@@ -80,6 +80,9 @@ public:
   void draw_inverse_ellipse(const Vector& pos, const Vector& size, const Color& color, int layer);
 
   void draw_line(const Vector& pos1, const Vector& pos2, const Color& color, int layer);
+  /** Draw multiple lines of the same color in a single request.
+      Each pair of points gives the start and end of a line. */
+  void draw_lines(const std::vector<Vector>& points, const Color& color, int layer);
   void draw_triangle(const Vector& pos1, const Vector& pos2, const Vector& pos3, const Color& color, int layer);
 
   /** on next update, set color to lightmap's color at position */
@@ -33,7 +33,7 @@ class Surface;
 
 enum class RequestType
 {
-  TEXTURE, GRADIENT, FILLRECT, INVERSEELLIPSE, GETPIXEL, LINE, TRIANGLE
+  TEXTURE, GRADIENT, FILLRECT, INVERSEELLIPSE, GETPIXEL, LINE, LINES, TRIANGLE
 };
 
 struct DrawingRequest
@@ -153,6 +153,25 @@ struct LineRequest : public DrawingRequest
   Color color;
 };
 
+struct LinesRequest : public DrawingRequest
+{
+  LinesRequest(const DrawingTransform& transform) :
+    DrawingRequest(transform),
+    points(),
+    color()
+  {}
+
+  RequestType get_type() const override { return RequestType::LINES; }
+
+  /** Start and end points of each line */
+  std::vector<Vector> points;
+  Color color;
+
+private:
+  LinesRequest(const LinesRequest&) = delete;
+  LinesRequest& operator=(const LinesRequest&) = delete;
+};
+
 struct TriangleRequest : public DrawingRequest
 {
   TriangleRequest(const DrawingTransform& transform) :
@@ -57,6 +57,26 @@ inline GLenum dfactor(Blend blend)
   return std::get<1>(blend_factor(blend));
 }
 
+/** A line, widened to a quad of one pixel width. */
+struct LineQuad
+{
+  float x1, y1;
+  float x2, y2;
+  float x_step, y_step;
+};
+
+LineQuad get_line_quad(const Vector& pos1, const Vector& pos2, const Vector& viewport_scale)
+{
+  float x_step = (pos2.y - pos1.y);
+  float y_step = -(pos2.x - pos1.x);
+
+  const float step_norm = sqrtf(x_step * x_step + y_step * y_step);
+  x_step /= step_norm * viewport_scale.x;
+  y_step /= step_norm * viewport_scale.y;
+
+  return { pos1.x, pos1.y, pos2.x, pos2.y, x_step * 0.5f, y_step * 0.5f };
+}
+
 } // namespace
 
 GLPainter::GLPainter(GLVideoSystem& video_system, GLRenderer& renderer) :
@@ -398,29 +418,16 @@ GLPainter::draw_line(const LineRequest& request)
 {
   assert_gl();
 
-  Vector viewport_scale = m_video_system.get_viewport().get_scale();
-  const float& x1 = request.pos.x;
-  const float& y1 = request.pos.y;
-  const float& x2 = request.dest_pos.x;
-  const float& y2 = request.dest_pos.y;
-
   // OpenGL3.3 doesn't have GL_LINES anymore, so instead we transform
   // the line into a quad and draw it as triangle strip.
-  float x_step = (y2 - y1);
-  float y_step = -(x2 - x1);
-
-  const float step_norm = sqrtf(x_step * x_step + y_step * y_step);
-  x_step /= step_norm * viewport_scale.x;
-  y_step /= step_norm * viewport_scale.y;
-
-  x_step *= 0.5f;
-  y_step *= 0.5f;
+  const LineQuad quad = get_line_quad(request.pos, request.dest_pos,
+                                      m_video_system.get_viewport().get_scale());
 
   const float vertices[] = {
-    (x1 - x_step), (y1 - y_step),
-    (x2 - x_step), (y2 - y_step),
-    (x1 + x_step), (y1 + y_step),
-    (x2 + x_step), (y2 + y_step),
+    quad.x1 - quad.x_step, quad.y1 - quad.y_step,
+    quad.x2 - quad.x_step, quad.y2 - quad.y_step,
+    quad.x1 + quad.x_step, quad.y1 + quad.y_step,
+    quad.x2 + quad.x_step, quad.y2 + quad.y_step,
   };
 
   GLContext& context = m_video_system.get_context();
@@ -436,6 +443,46 @@ GLPainter::draw_line(const LineRequest& request)
   assert_gl();
 }
 
+void
+GLPainter::draw_lines(const LinesRequest& request)
+{
+  assert_gl();
+
+  const Vector viewport_scale = m_video_system.get_viewport().get_scale();
+  const size_t line_count = request.points.size() / 2;
+
+  // Same as draw_line(), but with all quads drawn as triangles at once.
+  m_vertices.clear();
+  m_vertices.reserve(line_count * 12);
+  for (size_t i = 0; i < line_count; ++i)
+  {
+    const LineQuad quad = get_line_quad(request.points[i * 2], request.points[i * 2 + 1], viewport_scale);
+
+    const float vertices[] = {
+      quad.x1 - quad.x_step, quad.y1 - quad.y_step,
+      quad.x2 - quad.x_step, quad.y2 - quad.y_step,
+      quad.x1 + quad.x_step, quad.y1 + quad.y_step,
+
+      quad.x2 - quad.x_step, quad.y2 - quad.y_step,
+      quad.x1 + quad.x_step, quad.y1 + quad.y_step,
+      quad.x2 + quad.x_step, quad.y2 + quad.y_step,
+    };
+    m_vertices.insert(m_vertices.end(), std::begin(vertices), std::end(vertices));
+  }
+
+  GLContext& context = m_video_system.get_context();
+
+  context.blend_func(sfactor(request.blend), dfactor(request.blend));
+  context.bind_no_texture();
+  context.set_positions(m_vertices.data(), sizeof(float) * m_vertices.size());
+  context.set_texcoord(0.0f, 0.0f);
+  context.set_color(request.color);
+
+  context.draw_arrays(GL_TRIANGLES, 0, static_cast<GLsizei>(line_count * 6));
+
+  assert_gl();
+}
+
 void
 GLPainter::draw_triangle(const TriangleRequest& request)
 {
@@ -35,6 +35,7 @@ public:
   virtual void draw_filled_rect(const FillRectRequest& request) override;
   virtual void draw_inverse_ellipse(const InverseEllipseRequest& request) override;
   virtual void draw_line(const LineRequest& request) override;
+  virtual void draw_lines(const LinesRequest& request) override;
   virtual void draw_triangle(const TriangleRequest& request) override;
 
   virtual void clear(const Color& color) override;
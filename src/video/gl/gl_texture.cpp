@@ -194,6 +194,25 @@ GLTexture::~GLTexture()
   glDeleteTextures(1, &m_handle);
 }
 
+void
+GLTexture::update(const Rect& rect, const uint32_t* pixels)
+{
+  assert(Rect(0, 0, m_image_width, m_image_height).contains(rect));
+
+  assert_gl();
+
+  glBindTexture(GL_TEXTURE_2D, m_handle);
+  glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+#if defined(GL_UNPACK_ROW_LENGTH) || defined(USE_GLBINDING)
+  glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+#endif
+
+  glTexSubImage2D(GL_TEXTURE_2D, 0, rect.left, rect.top, rect.get_width(), rect.get_height(),
+                  GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+
+  assert_gl();
+}
+
 void
 GLTexture::set_texture_params()
 {
@@ -57,6 +57,12 @@ NullPainter::draw_line(const LineRequest& request)
   log_info << "NullPainter::draw_line()" << std::endl;
 }
 
+void
+NullPainter::draw_lines(const LinesRequest& request)
+{
+  log_info << "NullPainter::draw_lines()" << std::endl;
+}
+
 void
 NullPainter::draw_triangle(const TriangleRequest& request)
 {
@@ -50,4 +50,9 @@ NullTexture::get_image_height() const
   return m_image_size.height;
 }
 
+void
+NullTexture::update(const Rect& rect, const uint32_t* pixels)
+{
+}
+
 /* EOF */
@@ -29,6 +29,7 @@ struct GetPixelRequest;
 struct GradientRequest;
 struct InverseEllipseRequest;
 struct LineRequest;
+struct LinesRequest;
 struct TextureBatchRequest;
 struct TextureRequest;
 struct TriangleRequest;
@@ -44,6 +45,7 @@ public:
   virtual void draw_filled_rect(const FillRectRequest& request) = 0;
   virtual void draw_inverse_ellipse(const InverseEllipseRequest& request) = 0;
   virtual void draw_line(const LineRequest& request) = 0;
+  virtual void draw_lines(const LinesRequest& request) = 0;
   virtual void draw_triangle(const TriangleRequest& request) = 0;
 
   virtual void clear(const Color& color) = 0;
@@ -488,6 +488,23 @@ SDLPainter::draw_line(const LineRequest& request)
                                       request.dest_pos.x, request.dest_pos.y);
 }
 
+void
+SDLPainter::draw_lines(const LinesRequest& request)
+{
+  Uint8 r = static_cast<Uint8>(request.color.red * 255);
+  Uint8 g = static_cast<Uint8>(request.color.green * 255);
+  Uint8 b = static_cast<Uint8>(request.color.blue * 255);
+  Uint8 a = static_cast<Uint8>(request.color.alpha * 255);
+
+  SDL_SetRenderDrawBlendMode(m_sdl_renderer, SDL_BLENDMODE_BLEND);
+  SDL_SetRenderDrawColor(m_sdl_renderer, r, g, b, a);
+  for (size_t i = 0; i + 1 < request.points.size(); i += 2)
+  {
+    SDL_RenderDrawLineF(m_sdl_renderer, request.points[i].x, request.points[i].y,
+                                        request.points[i + 1].x, request.points[i + 1].y);
+  }
+}
+
 namespace {
 
 using Edge = std::pair<const Vector&, const Vector&>;
@@ -18,6 +18,7 @@
 
 #include <SDL.h>
 #include <sstream>
+#include <vector>
 
 #include "video/sdl/sdl_screen_renderer.hpp"
 #include "video/video_system.hpp"
@@ -54,4 +55,23 @@ SDLTexture::~SDLTexture()
   SDL_DestroyTexture(m_texture);
 }
 
+void
+SDLTexture::update(const Rect& rect, const uint32_t* pixels)
+{
+  Uint32 format;
+  if (SDL_QueryTexture(m_texture, &format, nullptr, nullptr, nullptr) != 0)
+    return;
+
+  // The pixels have to be in the format of the texture.
+  const int pitch = rect.get_width() * 4;
+  const int converted_pitch = rect.get_width() * SDL_BYTESPERPIXEL(format);
+  std::vector<uint8_t> converted(static_cast<size_t>(converted_pitch) * rect.get_height());
+  if (SDL_ConvertPixels(rect.get_width(), rect.get_height(), SDL_PIXELFORMAT_RGBA32, pixels, pitch,
+                        format, converted.data(), converted_pitch) != 0)
+    return;
+
+  const SDL_Rect sdl_rect = rect.to_sdl();
+  SDL_UpdateTexture(m_texture, &sdl_rect, converted.data(), converted_pitch);
+}
+
 /* EOF */
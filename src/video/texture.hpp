@@ -17,6 +17,7 @@
 #ifndef HEADER_SUPERTUX_VIDEO_TEXTURE_HPP
 #define HEADER_SUPERTUX_VIDEO_TEXTURE_HPP
 
+#include <stdint.h>
 #include <string>
 #include <tuple>
 #include <optional>
@@ -47,6 +48,10 @@ public:
   virtual int get_image_width() const = 0;
   virtual int get_image_height() const = 0;
 
+  /** Replaces the pixels within the given rectangle of the image. The
+      pixels are in RGBA byte order, row by row, without any padding. */
+  virtual void update(const Rect& rect, const uint32_t* pixels) = 0;
+
 private:
   std::optional<Key> m_cache_key;
 
@@ -17,8 +17,10 @@
 #include "video/texture_manager.hpp"
 
 #include <SDL_image.h>
+#include <algorithm>
 #include <assert.h>
 #include <sstream>
+#include <string.h>
 
 #include <physfs.h>
 
@@ -86,19 +88,57 @@ SDLSurfacePtr create_image_surface(const std::string& filename)
                                FileSystem::extension(filename));
 }
 
+size_t get_surface_size(const SDL_Surface& surface)
+{
+  return static_cast<size_t>(surface.pitch) * static_cast<size_t>(surface.h);
+}
+
 } // namespace
 
 const std::string TextureManager::s_dummy_texture = "images/engine/missing.png";
+const size_t TextureManager::s_default_surface_budget = 256 * 1024 * 1024;
 
 TextureManager::TextureManager() :
   m_image_textures(),
   m_surfaces(),
-  m_load_successful(false)
+  m_surfaces_lru(),
+  m_surfaces_size(0),
+  m_surface_budget(s_default_surface_budget),
+  m_placeholder(),
+  m_load_successful(false),
+  m_decode_thread(),
+  m_decode_mutex(),
+  m_decode_condition(),
+  m_decoded_condition(),
+  m_find_queue(),
+  m_found(),
+  m_decode_queue(),
+  m_decoding(),
+  m_decoded(),
+  m_decoded_size(0),
+  m_decode_budget(s_default_surface_budget),
+  m_decode_failures(),
+  m_decode_quit(false)
 {
+#ifndef __EMSCRIPTEN__
+  // Threads are not available in the browser build, so images are
+  // only decoded on first use there.
+  m_decode_thread = std::thread(&TextureManager::decode_main, this);
+#endif
 }
 
 TextureManager::~TextureManager()
 {
+  {
+    std::lock_guard<std::mutex> lock(m_decode_mutex);
+    m_decode_quit = true;
+  }
+  m_decode_condition.notify_all();
+  if (m_decode_thread.joinable())
+    m_decode_thread.join();
+
+  m_placeholder.reset();
+
   for (const auto& texture : m_image_textures)
   {
     if (!texture.second.expired())
@@ -108,6 +148,8 @@ TextureManager::~TextureManager()
   }
   m_image_textures.clear();
   m_surfaces.clear();
+  m_surfaces_lru.clear();
+  m_decoded.clear();
 }
 
 TexturePtr
@@ -287,15 +329,363 @@ TextureManager::create_image_texture(const std::string& filename, const Rect& re
 
 const SDL_Surface&
 TextureManager::get_surface(const std::string& filename)
+{
+  const SDL_Surface* surface = find_surface(filename);
+  if (surface)
+  {
+    return *surface;
+  }
+
+  // The newly added surface is never evicted right away, so it stays valid.
+  add_surface(filename, create_image_surface(filename));
+  return *m_surfaces[filename].surface;
+}
+
+const SDL_Surface*
+TextureManager::find_surface(const std::string& filename)
+{
+  cancel_decode(filename);
+  collect_decoded();
+
+  auto i = m_surfaces.find(filename);
+  if (i == m_surfaces.end())
+    return nullptr;
+
+  m_surfaces_lru.splice(m_surfaces_lru.begin(), m_surfaces_lru, i->second.lru_pos);
+  return i->second.surface.get();
+}
+
+SDLSurfacePtr
+TextureManager::take_surface(const std::string& filename)
+{
+  cancel_decode(filename);
+  collect_decoded();
+
+  auto i = m_surfaces.find(filename);
+  if (i == m_surfaces.end())
+    return SDLSurfacePtr();
+
+  SDLSurfacePtr surface = std::move(i->second.surface);
+  m_surfaces_size -= get_surface_size(*surface);
+  m_surfaces_lru.erase(i->second.lru_pos);
+  m_surfaces.erase(i);
+  return surface;
+}
+
+void
+TextureManager::add_surface(const std::string& filename, SDLSurfacePtr surface)
 {
   auto i = m_surfaces.find(filename);
   if (i != m_surfaces.end())
   {
-    return *i->second;
+    m_surfaces_size -= get_surface_size(*i->second.surface);
+    m_surfaces_lru.erase(i->second.lru_pos);
+    m_surfaces.erase(i);
+  }
+
+  m_surfaces_size += get_surface_size(*surface);
+  m_surfaces_lru.push_front(filename);
+  m_surfaces[filename] = { std::move(surface), m_surfaces_lru.begin() };
+
+  evict_surfaces();
+}
+
+void
+TextureManager::evict_surfaces()
+{
+  size_t decoded_size;
+  {
+    std::lock_guard<std::mutex> lock(m_decode_mutex);
+    decoded_size = m_decoded_size;
+  }
+
+  // The most recently used surface is kept, even if it exceeds the budget on its own.
+  while (m_surfaces_size + decoded_size > m_surface_budget && m_surfaces_lru.size() > 1)
+  {
+    auto i = m_surfaces.find(m_surfaces_lru.back());
+    assert(i != m_surfaces.end());
+
+    m_surfaces_size -= get_surface_size(*i->second.surface);
+    m_surfaces.erase(i);
+    m_surfaces_lru.pop_back();
+  }
+}
+
+void
+TextureManager::set_surface_budget(size_t bytes)
+{
+  m_surface_budget = bytes;
+  {
+    std::lock_guard<std::mutex> lock(m_decode_mutex);
+    m_decode_budget = bytes;
+  }
+  m_decode_condition.notify_one();
+
+  evict_surfaces();
+}
+
+void
+TextureManager::cancel_decode(const std::string& filename)
+{
+  std::unique_lock<std::mutex> lock(m_decode_mutex);
+
+  auto i = std::find(m_decode_queue.begin(), m_decode_queue.end(), filename);
+  if (i != m_decode_queue.end())
+  {
+    // Decoding the image right away is faster than waiting for the images queued before it.
+    m_decode_queue.erase(i);
+    return;
+  }
+
+  m_decoded_condition.wait(lock, [this, &filename] { return m_decoding != filename; });
+}
+
+void
+TextureManager::collect_decoded()
+{
+  std::map<std::string, SDLSurfacePtr> decoded;
+  std::vector<std::string> found;
+  {
+    std::lock_guard<std::mutex> lock(m_decode_mutex);
+    if (m_decoded.empty() && m_found.empty())
+      return;
+
+    decoded.swap(m_decoded);
+    found.swap(m_found);
+    m_decoded_size = 0;
+  }
+  // Decoding may have been paused, while the decoded images exceeded the budget.
+  m_decode_condition.notify_one();
+
+  for (auto& it : decoded)
+    add_surface(it.first, std::move(it.second));
+
+  if (!found.empty())
+    prefetch(found);
+}
+
+void
+TextureManager::decode_main()
+{
+  std::unique_lock<std::mutex> lock(m_decode_mutex);
+  while (true)
+  {
+    m_decode_condition.wait(lock, [this] {
+        return m_decode_quit || !m_find_queue.empty() ||
+               (!m_decode_queue.empty() && m_decoded_size < m_decode_budget);
+      });
+    if (m_decode_quit)
+      return;
+
+    if (!m_find_queue.empty())
+    {
+      const auto get_filenames = std::move(m_find_queue.front());
+      m_find_queue.pop_front();
+      lock.unlock();
+
+      std::vector<std::string> filenames;
+      try
+      {
+        filenames = get_filenames();
+      }
+      catch (const std::exception& err)
+      {
+        log_debug << "Couldn't find images to prefetch: " << err.what() << std::endl;
+      }
+
+      // The images are filtered and queued on the main thread, which knows the loaded ones.
+      lock.lock();
+      m_found.insert(m_found.end(), filenames.begin(), filenames.end());
+      continue;
+    }
+
+    const std::string filename = m_decode_queue.front();
+    m_decode_queue.pop_front();
+    m_decoding = filename;
+    lock.unlock();
+
+    SDLSurfacePtr surface;
+    try
+    {
+      surface = create_image_surface(filename);
+    }
+    catch (const std::exception& err)
+    {
+      // The error is reported again, once the texture is actually loaded.
+      log_debug << "Couldn't decode image '" << filename << "' in the background: " << err.what() << std::endl;
+    }
+
+    lock.lock();
+    if (surface)
+    {
+      m_decoded_size += get_surface_size(*surface);
+      m_decoded[filename] = std::move(surface);
+    }
+    else
+      m_decode_failures.insert(filename);
+    m_decoding.clear();
+    m_decoded_condition.notify_all();
+  }
+}
+
+TexturePtr
+TextureManager::get_async(const std::string& filename)
+{
+  if (is_ready(filename))
+    return get(filename);
+
+  prefetch({ filename });
+  return get_placeholder();
+}
+
+bool
+TextureManager::is_ready(const std::string& _filename)
+{
+  const std::string filename = FileSystem::normalize(_filename);
+
+  auto i = m_image_textures.find(Texture::Key(filename, Rect(0, 0, 0, 0)));
+  if (i != m_image_textures.end() && !i->second.expired())
+    return true;
+
+  collect_decoded();
+  if (m_surfaces.find(filename) != m_surfaces.end())
+    return true;
+
+  // Missing images, and images failed to decode, are ready to be replaced
+  // by the dummy texture.
+  if (!PHYSFS_exists(filename.c_str()))
+    return true;
+
+  std::lock_guard<std::mutex> lock(m_decode_mutex);
+  return !m_decode_thread.joinable() || m_decode_failures.find(filename) != m_decode_failures.end();
+}
+
+void
+TextureManager::prefetch(const std::vector<std::string>& filenames)
+{
+  if (!m_decode_thread.joinable())
+    return;
+
+  std::vector<std::string> missing;
+  for (const auto& _filename : filenames)
+  {
+    std::string filename = FileSystem::normalize(_filename);
+
+    auto i = m_image_textures.find(Texture::Key(filename, Rect(0, 0, 0, 0)));
+    if ((i != m_image_textures.end() && !i->second.expired()) ||
+        m_surfaces.find(filename) != m_surfaces.end() ||
+        !PHYSFS_exists(filename.c_str()))
+      continue;
+
+    missing.push_back(std::move(filename));
+  }
+
+  if (missing.empty())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_decode_mutex);
+    for (auto& filename : missing)
+    {
+      if (filename == m_decoding ||
+          m_decoded.find(filename) != m_decoded.end() ||
+          m_decode_failures.find(filename) != m_decode_failures.end() ||
+          std::find(m_decode_queue.begin(), m_decode_queue.end(), filename) != m_decode_queue.end())
+        continue;
+
+      m_decode_queue.push_back(std::move(filename));
+    }
+  }
+  m_decode_condition.notify_one();
+}
+
+void
+TextureManager::prefetch_from(std::function<std::vector<std::string> ()> get_filenames)
+{
+  if (!m_decode_thread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_decode_mutex);
+    m_find_queue.push_back(std::move(get_filenames));
   }
+  m_decode_condition.notify_one();
+}
+
+Color
+TextureManager::get_average_color(const Texture& texture, const Rect& region)
+{
+  if (!texture.m_cache_key)
+    return Color(0.0f, 0.0f, 0.0f, 0.0f);
 
-  SDLSurfacePtr surface = create_image_surface(filename);
-  return *(m_surfaces[filename] = std::move(surface));
+  const std::string& filename = std::get<0>(*texture.m_cache_key);
+  const Rect& texture_rect = std::get<1>(*texture.m_cache_key);
+
+  const SDL_Surface* surface;
+  try
+  {
+    surface = &get_surface(filename);
+  }
+  catch (const std::exception& err)
+  {
+    log_warning << "Couldn't read image '" << filename << "': " << err.what() << std::endl;
+    return Color(0.0f, 0.0f, 0.0f, 0.0f);
+  }
+
+  // The region is relative to the part of the image the texture was loaded from.
+  const int left = std::max(0, texture_rect.left + region.left);
+  const int top = std::max(0, texture_rect.top + region.top);
+  const int right = std::min(surface->w, texture_rect.left + region.right);
+  const int bottom = std::min(surface->h, texture_rect.top + region.bottom);
+  if (left >= right || top >= bottom)
+    return Color(0.0f, 0.0f, 0.0f, 0.0f);
+
+  SDL_Surface* image = const_cast<SDL_Surface*>(surface);
+  if (SDL_MUSTLOCK(image))
+    SDL_LockSurface(image);
+
+  const int bpp = image->format->BytesPerPixel;
+  uint64_t red = 0, green = 0, blue = 0, alpha = 0;
+  for (int y = top; y < bottom; ++y)
+  {
+    const uint8_t* row = static_cast<const uint8_t*>(image->pixels) + y * image->pitch;
+    for (int x = left; x < right; ++x)
+    {
+      Uint32 pixel = 0;
+      memcpy(&pixel, row + x * bpp, bpp);
+
+      Uint8 r, g, b, a;
+      SDL_GetRGBA(pixel, image->format, &r, &g, &b, &a);
+      red += r * a;
+      green += g * a;
+      blue += b * a;
+      alpha += a;
+    }
+  }
+
+  if (SDL_MUSTLOCK(image))
+    SDL_UnlockSurface(image);
+
+  if (alpha == 0)
+    return Color(0.0f, 0.0f, 0.0f, 0.0f);
+
+  const uint64_t count = static_cast<uint64_t>(right - left) * (bottom - top);
+  return Color::from_rgba8888(static_cast<uint8_t>(red / alpha),
+                              static_cast<uint8_t>(green / alpha),
+                              static_cast<uint8_t>(blue / alpha),
+                              static_cast<uint8_t>(alpha / count));
+}
+
+TexturePtr
+TextureManager::get_placeholder()
+{
+  if (!m_placeholder)
+  {
+    // SDL clears new surfaces, so the placeholder is fully transparent.
+    SDLSurfacePtr image = SDLSurface::create_rgba(1, 1);
+    m_placeholder = VideoSystem::current()->new_texture(*image);
+  }
+  return m_placeholder;
 }
 
 TexturePtr
@@ -380,7 +770,11 @@ TextureManager::create_image_texture(const std::string& filename, const Sampler&
 TexturePtr
 TextureManager::create_image_texture_raw(const std::string& filename, const Sampler& sampler)
 {
-  SDLSurfacePtr surface = create_image_surface(filename);
+  // Textures of whole images don't need the image afterwards, so it's
+  // not kept in the cache, unless it's there already.
+  SDLSurfacePtr surface = take_surface(filename);
+  if (!surface)
+    surface = create_image_surface(filename);
   TexturePtr texture = VideoSystem::current()->new_texture(*surface, sampler);
   surface.reset(nullptr);
   return texture;
@@ -437,7 +831,7 @@ TextureManager::debug_print(std::ostream& out) const
   for(const auto& it : m_surfaces)
   {
     const auto& filename = it.first;
-    const auto& surface = it.second;
+    const auto& surface = it.second.surface;
 
     total_surface_pixels += surface->w * surface->h;
     out << "  surface filename:" << filename << " " << surface->w << "x" << surface->h << std::endl;
@@ -449,6 +843,7 @@ TextureManager::debug_print(std::ostream& out) const
 
   out << "total surface count:" << m_surfaces.size() << std::endl;
   out << "total surface pixels:" << total_surface_pixels << std::endl;
+  out << "total surface bytes:" << m_surfaces_size << " (budget: " << m_surface_budget << ")" << std::endl;
 }
 
 /* EOF */
@@ -18,11 +18,17 @@
 #define HEADER_SUPERTUX_VIDEO_TEXTURE_MANAGER_HPP
 
 #include <config.h>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 #include <optional>
 
@@ -33,6 +39,7 @@
 #include "video/texture.hpp"
 #include "video/texture_ptr.hpp"
 
+class Color;
 class GLTexture;
 class ReaderMapping;
 struct SDL_Surface;
@@ -43,6 +50,7 @@ class TextureManager final : public Currenton<TextureManager>
 
 private:
   static const std::string s_dummy_texture;
+  static const size_t s_default_surface_budget;
 
 public:
   TextureManager();
@@ -55,14 +63,72 @@ public:
                  const Sampler& sampler = Sampler());
   TexturePtr create_dummy_texture();
 
+  /** Returns the texture of the whole image, if the image doesn't have
+      to be decoded first. Otherwise, the image is queued for decoding in
+      the background and a placeholder texture is returned until then. */
+  TexturePtr get_async(const std::string& filename);
+
+  /** Returns true, if getting the texture of the whole image doesn't
+      have to wait for the image to be decoded. */
+  bool is_ready(const std::string& filename);
+
+  /** Queues the given images for decoding in the background, so getting
+      their textures later on doesn't stall. */
+  void prefetch(const std::vector<std::string>& filenames);
+
+  /** Runs the given function in the background and queues the images it
+      returns for decoding, e.g. to find the images used by a level without
+      reading its file on the main thread. */
+  void prefetch_from(std::function<std::vector<std::string> ()> get_filenames);
+
+  /** Returns the average color of the given region of a texture, weighted
+      by the alpha of the pixels. The pixels are read from the image the
+      texture was loaded from, so it's transparent for other textures. */
+  Color get_average_color(const Texture& texture, const Rect& region);
+
+  /** Sets the amount of memory, in bytes, which decoded images may take
+      up. Once exceeded, the least recently used images are dropped. */
+  void set_surface_budget(size_t bytes);
+  size_t get_surface_budget() const { return m_surface_budget; }
+
   void debug_print(std::ostream& out) const;
 
   bool last_load_successful() const { return m_load_successful; }
 
+private:
+  struct SurfaceEntry
+  {
+    SDLSurfacePtr surface;
+    std::list<std::string>::iterator lru_pos;
+  };
+
 private:
   const SDL_Surface& get_surface(const std::string& filename);
   void reap_cache_entry(const Texture::Key& key);
 
+  /** Returns the decoded image, if it's available, marking it as used.
+      If the image is being decoded in the background, waits for it. */
+  const SDL_Surface* find_surface(const std::string& filename);
+
+  /** Removes the decoded image from the cache and returns it,
+      if it's available. */
+  SDLSurfacePtr take_surface(const std::string& filename);
+
+  void add_surface(const std::string& filename, SDLSurfacePtr surface);
+  void evict_surfaces();
+
+  /** Waits for the image, if it's being decoded in the background, or
+      removes it from the queue, if decoding hasn't started yet. */
+  void cancel_decode(const std::string& filename);
+
+  /** Moves images decoded in the background into the cache, and
+      queues images found in the background for decoding. */
+  void collect_decoded();
+
+  void decode_main();
+
+  TexturePtr get_placeholder();
+
   TexturePtr create_image_texture(const std::string& filename, const Rect& rect, const Sampler& sampler);
 
   /** on failure a dummy texture is returned and no exception is thrown */
@@ -74,9 +140,34 @@ private:
 
 private:
   std::map<Texture::Key, std::weak_ptr<Texture> > m_image_textures;
-  std::map<std::string, SDLSurfacePtr> m_surfaces;
+  std::map<std::string, SurfaceEntry> m_surfaces;
+
+  /** Decoded images, most recently used first */
+  std::list<std::string> m_surfaces_lru;
+  size_t m_surfaces_size;
+  size_t m_surface_budget;
+
+  TexturePtr m_placeholder;
   bool m_load_successful;
 
+  /** Background decoding of images, the members below are guarded by m_decode_mutex */
+  std::thread m_decode_thread;
+  std::mutex m_decode_mutex;
+  std::condition_variable m_decode_condition;
+  std::condition_variable m_decoded_condition;
+  std::deque<std::function<std::vector<std::string> ()>> m_find_queue;
+  std::vector<std::string> m_found;
+  std::deque<std::string> m_decode_queue;
+  std::string m_decoding;
+  std::map<std::string, SDLSurfacePtr> m_decoded;
+
+  /** Size of the images in m_decoded. These count towards the surface budget,
+      and no more images are decoded while they exceed it on their own. */
+  size_t m_decoded_size;
+  size_t m_decode_budget;
+  std::set<std::string> m_decode_failures;
+  bool m_decode_quit;
+
 private:
   TextureManager(const TextureManager&) = delete;
   TextureManager& operator=(const TextureManager&) = delete;
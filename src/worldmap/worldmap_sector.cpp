@@ -26,7 +26,6 @@
 #include "object/display_effect.hpp"
 #include "object/music_object.hpp"
 #include "object/tilemap.hpp"
-#include "physfs/ifile_stream.hpp"
 #include "squirrel/squirrel_environment.hpp"
 #include "supertux/constants.hpp"
 #include "supertux/d_scope.hpp"
@@ -138,8 +137,7 @@ WorldMapSector::setup()
   // Run default.nut just before init script
   try
   {
-    IFileStream in(m_parent.get_levels_path() + "default.nut");
-    m_squirrel_environment->run_script(in, "WorldMapSector::default.nut");
+    m_squirrel_environment->run_script_file(m_parent.get_levels_path() + "default.nut", "WorldMapSector::default.nut");
   }
   catch (...)
   {
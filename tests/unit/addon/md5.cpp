@@ -0,0 +1,74 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "addon/md5.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+TEST(MD5, known_digests)
+{
+  MD5 empty;
+  EXPECT_EQ(empty.hex_digest(), "d41d8cd98f00b204e9800998ecf8427e");
+
+  // Test suite of RFC 1321
+  const std::vector<std::pair<std::string, std::string>> vectors = {
+    { "a", "0cc175b9c0f1b6a831c399e269772661" },
+    { "abc", "900150983cd24fb0d6963f7d28e17f72" },
+    { "message digest", "f96b697d7cb7938d525a2f31aaf161d0" },
+    { "abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b" },
+    { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "d174ab98d277d9f5a5611c2c9f419d9f" },
+    { "12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+      "57edf4a22be3c955ac49da2e2107b67a" }
+  };
+  for (const auto& [input, digest] : vectors)
+  {
+    std::istringstream in(input);
+    EXPECT_EQ(MD5(in).hex_digest(), digest) << input;
+  }
+}
+
+TEST(MD5, known_digest_larger_than_chunk)
+{
+  // Streams are read in chunks of 64 KiB, so this spans several of them.
+  std::istringstream in(std::string(1000000, 'a'));
+  EXPECT_EQ(MD5(in).hex_digest(), "7707d6ae4e027c70eea2a935c2296f21");
+}
+
+TEST(MD5, block_sizes)
+{
+  std::vector<uint8_t> data(1000003);
+  for (size_t i = 0; i < data.size(); ++i)
+    data[i] = static_cast<uint8_t>(i * 31 + 7);
+
+  MD5 whole;
+  whole.update(data.data(), data.size());
+
+  // Updates, which don't line up with the 64 byte blocks, must give the same result.
+  MD5 pieces;
+  for (size_t i = 0; i < data.size(); i += 777)
+    pieces.update(data.data() + i, std::min<size_t>(777, data.size() - i));
+
+  EXPECT_EQ(whole.hex_digest(), "a64b1b3256fcffbcf7e81559b180d6dd");
+  EXPECT_EQ(pieces.hex_digest(), whole.hex_digest());
+}
+
+/* EOF */
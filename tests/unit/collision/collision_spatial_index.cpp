@@ -0,0 +1,125 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "collision/collision_spatial_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+
+#include "collision/collision_listener.hpp"
+#include "collision/collision_object.hpp"
+
+namespace {
+
+class DummyListener final : public CollisionListener
+{
+public:
+  void collision_solid(const CollisionHit&) override {}
+  bool collides(GameObject&, const CollisionHit&) const override { return true; }
+  HitResponse collision(GameObject&, const CollisionHit&) override { return CONTINUE; }
+  void collision_tile(uint32_t) override {}
+  bool listener_is_valid() const override { return true; }
+};
+
+class CollisionSpatialIndexTest : public ::testing::Test
+{
+protected:
+  CollisionObject& add(const Rectf& bbox)
+  {
+    m_objects.push_back(std::make_unique<CollisionObject>(COLGROUP_MOVING, m_listener));
+    m_objects.back()->m_bbox = bbox;
+    m_object_ptrs.push_back(m_objects.back().get());
+    m_index.attach(*m_objects.back());
+    return *m_objects.back();
+  }
+
+  std::map<const CollisionObject*, int> query(const Rectf& rect) const
+  {
+    std::map<const CollisionObject*, int> result;
+    m_index.for_each_candidate(rect, [&result](CollisionObject& object) {
+        result[&object] += 1;
+      });
+    return result;
+  }
+
+protected:
+  DummyListener m_listener;
+  std::vector<std::unique_ptr<CollisionObject>> m_objects;
+  std::vector<CollisionObject*> m_object_ptrs;
+  CollisionSpatialIndex m_index;
+};
+
+} // namespace
+
+TEST_F(CollisionSpatialIndexTest, empty)
+{
+  m_index.rebuild(m_object_ptrs);
+  EXPECT_TRUE(query(Rectf(0.0f, 0.0f, 100.0f, 100.0f)).empty());
+}
+
+TEST_F(CollisionSpatialIndexTest, finds_nearby_objects_only)
+{
+  const CollisionObject& near = add(Rectf(10.0f, 10.0f, 42.0f, 42.0f));
+  const CollisionObject& far = add(Rectf(5000.0f, 5000.0f, 5032.0f, 5032.0f));
+  m_index.rebuild(m_object_ptrs);
+
+  const auto result = query(Rectf(0.0f, 0.0f, 64.0f, 64.0f));
+  EXPECT_EQ(result.count(&near), 1u);
+  EXPECT_EQ(result.count(&far), 0u);
+}
+
+TEST_F(CollisionSpatialIndexTest, reports_objects_spanning_cells_once)
+{
+  const CollisionObject& wide = add(Rectf(0.0f, 0.0f, 1000.0f, 300.0f));
+  add(Rectf(2000.0f, 2000.0f, 2032.0f, 2032.0f));
+  m_index.rebuild(m_object_ptrs);
+
+  const auto result = query(Rectf(-100.0f, -100.0f, 1100.0f, 400.0f));
+  ASSERT_EQ(result.count(&wide), 1u);
+  EXPECT_EQ(result.at(&wide), 1);
+}
+
+TEST_F(CollisionSpatialIndexTest, reports_large_objects_always)
+{
+  const CollisionObject& huge = add(Rectf(0.0f, 0.0f, 100000.0f, 100000.0f));
+  add(Rectf(50.0f, 50.0f, 82.0f, 82.0f));
+  m_index.rebuild(m_object_ptrs);
+
+  const auto result = query(Rectf(90000.0f, 90000.0f, 90010.0f, 90010.0f));
+  ASSERT_EQ(result.count(&huge), 1u);
+  EXPECT_EQ(result.at(&huge), 1);
+}
+
+TEST_F(CollisionSpatialIndexTest, finds_teleported_objects)
+{
+  CollisionObject& object = add(Rectf(10.0f, 10.0f, 42.0f, 42.0f));
+  add(Rectf(5000.0f, 5000.0f, 5032.0f, 5032.0f));
+  m_index.rebuild(m_object_ptrs);
+  ASSERT_TRUE(m_index.is_valid());
+
+  object.set_pos(Vector(3000.0f, 3000.0f));
+  EXPECT_FALSE(m_index.is_valid());
+
+  // Like CollisionSystem, rebuild the index before querying it, if it's invalid.
+  if (!m_index.is_valid())
+    m_index.rebuild(m_object_ptrs);
+
+  EXPECT_EQ(query(Rectf(2990.0f, 2990.0f, 3050.0f, 3050.0f)).count(&object), 1u);
+}
+
+/* EOF */
@@ -0,0 +1,64 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "editor/object_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include "object/tilemap.hpp"
+#include "supertux/game_object_manager.hpp"
+#include "supertux/tile_set.hpp"
+
+namespace {
+
+class TestObjectManager final : public GameObjectManager
+{
+public:
+  TestObjectManager() {}
+
+  bool before_object_add(GameObject&) override { return true; }
+  void before_object_remove(GameObject&) override {}
+};
+
+} // namespace
+
+TEST(EditorObjectIndex, renamed_tilemap)
+{
+  TileSet tileset;
+  TestObjectManager manager;
+  TileMap& tilemap = manager.add<TileMap>(&tileset);
+  tilemap.set_name("background");
+  manager.flush_game_objects();
+
+  EditorObjectIndex index;
+  index.set_sector(&manager);
+  ASSERT_EQ(index.find("name:background").size(), 1u);
+
+  tilemap.save_state();
+  tilemap.set_name("foreground");
+  tilemap.check_state();
+
+  EXPECT_TRUE(index.find("name:background").empty());
+
+  const auto found = index.find("name:foreground");
+  ASSERT_EQ(found.size(), 1u);
+  EXPECT_EQ(found[0], &tilemap);
+
+  index.set_sector(nullptr);
+}
+
+/* EOF */
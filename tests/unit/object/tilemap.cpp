@@ -0,0 +1,54 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "object/tilemap.hpp"
+
+#include <gtest/gtest.h>
+
+#include "editor/object_settings.hpp"
+#include "supertux/tile_set.hpp"
+
+namespace {
+
+std::string get_option_value(const ObjectSettings& settings, const std::string& text)
+{
+  for (const auto& option : settings.get_options())
+  {
+    if (option->get_text() == text)
+      return option->to_string();
+  }
+  return {};
+}
+
+} // namespace
+
+TEST(TileMap, cached_settings_after_check_state)
+{
+  TileSet tileset;
+  TileMap tilemap(&tileset);
+  tilemap.resize(2, 2, 0, 0, 0);
+  EXPECT_EQ(get_option_value(tilemap.get_cached_settings(), "Width"), "2");
+
+  tilemap.save_state();
+  tilemap.resize(5, 2, 0, 0, 0);
+  tilemap.check_state();
+
+  // The width option holds a copy, which is only updated when the settings are rebuilt.
+  EXPECT_EQ(get_option_value(tilemap.get_cached_settings(), "Width"), "5");
+}
+
+/* EOF */
@@ -0,0 +1,52 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "object/tilemap_delta.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(TileMapDelta, runs)
+{
+  const std::vector<uint32_t> old_tiles = { 0, 1, 2, 3, 4, 5, 6, 7 };
+  const std::vector<uint32_t> new_tiles = { 0, 9, 9, 3, 4, 5, 9, 9 };
+
+  TileMapDelta delta(old_tiles, new_tiles);
+  EXPECT_FALSE(delta.empty());
+  EXPECT_EQ(delta.get_tile_count(), 4u);
+  EXPECT_EQ(delta.get_size(), old_tiles.size());
+
+  std::vector<uint32_t> tiles = old_tiles;
+  std::vector<size_t> changed;
+  delta.apply(tiles, [&changed](size_t index) { changed.push_back(index); });
+  EXPECT_EQ(tiles, new_tiles);
+  EXPECT_EQ(changed, (std::vector<size_t>{ 1, 2, 6, 7 }));
+
+  delta.invert();
+  delta.apply(tiles, {});
+  EXPECT_EQ(tiles, old_tiles);
+}
+
+TEST(TileMapDelta, unchanged)
+{
+  const std::vector<uint32_t> tiles = { 1, 2, 3 };
+
+  TileMapDelta delta(tiles, tiles);
+  EXPECT_TRUE(delta.empty());
+  EXPECT_EQ(delta.get_tile_count(), 0u);
+}
+
+/* EOF */
@@ -0,0 +1,85 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "physfs/imapped_file_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <physfs.h>
+#include <sstream>
+
+#include "util/reader_document.hpp"
+#include "util/reader_mapping.hpp"
+#include "util/reader_object.hpp"
+
+namespace {
+
+std::string read_native(const std::string& filename)
+{
+  std::ifstream in(filename, std::ios::binary);
+  std::ostringstream out;
+  out << in.rdbuf();
+  return out.str();
+}
+
+} // namespace
+
+TEST(IMappedFileStream, reads_whole_file)
+{
+  PHYSFS_init("imapped_file_stream_test");
+  ASSERT_NE(PHYSFS_mount("../tests/data", nullptr, 1), 0);
+
+  IMappedFileStream in("test.dat");
+  const std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  EXPECT_EQ(content, read_native("../tests/data/test.dat"));
+
+  in.clear();
+  in.seekg(0, std::ios::end);
+  EXPECT_EQ(static_cast<size_t>(in.tellg()), content.size());
+
+  in.seekg(1, std::ios::beg);
+  EXPECT_EQ(in.get(), static_cast<unsigned char>(content[1]));
+
+  PHYSFS_unmount("../tests/data");
+}
+
+TEST(IMappedFileStream, parses_document)
+{
+  PHYSFS_init("imapped_file_stream_test");
+  // Mounting a directory again is ignored, so it might end up on the wrong mount point.
+  PHYSFS_unmount("../tests/data");
+  ASSERT_NE(PHYSFS_mount("../tests/data", "levels", 1), 0);
+
+  // ReaderDocument::from_file() reads through an IMappedFileStream.
+  const auto doc = ReaderDocument::from_file("levels/test.sexp");
+  const auto root = doc.get_root();
+  EXPECT_EQ(root.get_name(), "supertux-test");
+
+  const auto mapping = root.get_mapping();
+  int value = 0;
+  std::string name;
+  EXPECT_TRUE(mapping.get("value", value));
+  EXPECT_TRUE(mapping.get("name", name));
+  EXPECT_EQ(value, 42);
+  EXPECT_EQ(name, "mapped");
+
+  PHYSFS_unmount("../tests/data");
+}
+
+/* EOF */
@@ -0,0 +1,61 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "physfs/mapped_file.hpp"
+
+#include <gtest/gtest.h>
+#include <physfs.h>
+#include <string>
+
+namespace {
+
+void check_mapped(const std::string& mount_point)
+{
+  PHYSFS_init("mapped_file_test");
+  // Mounting a directory again is ignored, e.g. after another test
+  // mounted it without a mount point, so it's unmounted first.
+  PHYSFS_unmount("../tests/data");
+  ASSERT_NE(PHYSFS_mount("../tests/data", mount_point.c_str(), 1), 0);
+
+  const std::string filename = mount_point + "/test.dat";
+  {
+    MappedFile file(filename);
+
+    PHYSFS_Stat stat;
+    ASSERT_NE(PHYSFS_stat(filename.c_str(), &stat), 0);
+    EXPECT_EQ(file.get_size(), static_cast<size_t>(stat.filesize));
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+    EXPECT_TRUE(file.is_mapped());
+#endif
+  }
+
+  PHYSFS_unmount("../tests/data");
+}
+
+} // namespace
+
+TEST(MappedFile, levels)
+{
+  check_mapped("levels");
+}
+
+TEST(MappedFile, scripts)
+{
+  check_mapped("scripts");
+}
+
+/* EOF */
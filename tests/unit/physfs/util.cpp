@@ -0,0 +1,95 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "physfs/util.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <physfs.h>
+#include <sstream>
+
+namespace {
+
+class WriteFileReplacingTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = std::filesystem::temp_directory_path() / "supertux_write_file_replacing_test";
+    std::filesystem::remove_all(m_dir);
+    std::filesystem::create_directories(m_dir);
+
+    PHYSFS_init("write_file_replacing_test");
+    ASSERT_NE(PHYSFS_setWriteDir(m_dir.string().c_str()), 0);
+
+    std::ofstream(m_dir / "savegame.ssg") << "old";
+  }
+
+  void TearDown() override
+  {
+    PHYSFS_setWriteDir(nullptr);
+    std::filesystem::remove_all(m_dir);
+  }
+
+  std::string read(const std::string& filename) const
+  {
+    std::ifstream in(m_dir / filename);
+    std::ostringstream out;
+    out << in.rdbuf();
+    return out.str();
+  }
+
+protected:
+  std::filesystem::path m_dir;
+};
+
+} // namespace
+
+TEST_F(WriteFileReplacingTest, replaces_file)
+{
+  EXPECT_TRUE(physfsutil::write_file_replacing("savegame.ssg", "savegame.ssg.journal",
+                                               [](std::ostream& out) { out << "new"; }));
+  EXPECT_EQ(read("savegame.ssg"), "new");
+  EXPECT_FALSE(std::filesystem::exists(m_dir / "savegame.ssg.journal"));
+}
+
+TEST_F(WriteFileReplacingTest, keeps_file_on_write_failure)
+{
+  // Simulates a full disk, which only shows in the stream state.
+  EXPECT_FALSE(physfsutil::write_file_replacing("savegame.ssg", "savegame.ssg.journal",
+                                                [](std::ostream& out) {
+                                                  out << "truncat";
+                                                  out.setstate(std::ios::badbit);
+                                                }));
+  EXPECT_EQ(read("savegame.ssg"), "old");
+  EXPECT_FALSE(std::filesystem::exists(m_dir / "savegame.ssg.journal"));
+}
+
+TEST_F(WriteFileReplacingTest, keeps_file_on_exception)
+{
+  EXPECT_FALSE(physfsutil::write_file_replacing("savegame.ssg", "savegame.ssg.journal",
+                                                [](std::ostream& out) {
+                                                  out << "truncat";
+                                                  throw std::runtime_error("serialization failed");
+                                                }));
+  EXPECT_EQ(read("savegame.ssg"), "old");
+  EXPECT_FALSE(std::filesystem::exists(m_dir / "savegame.ssg.journal"));
+}
+
+/* EOF */
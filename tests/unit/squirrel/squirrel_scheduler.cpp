@@ -0,0 +1,64 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "squirrel/squirrel_scheduler.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+SquirrelScheduler* s_scheduler = nullptr;
+
+SQInteger wait_one_second(HSQUIRRELVM vm)
+{
+  return s_scheduler->schedule_thread(vm, 1.0f, false);
+}
+
+} // namespace
+
+TEST(SquirrelSchedulerTest, skips_finished_threads)
+{
+  ssq::VM vm(64);
+  SquirrelScheduler scheduler(vm);
+  s_scheduler = &scheduler;
+
+  HSQUIRRELVM handle = vm.getHandle();
+  sq_pushroottable(handle);
+  sq_pushstring(handle, "wait", -1);
+  sq_newclosure(handle, &wait_one_second, 0);
+  sq_newslot(handle, -3, SQFalse);
+  sq_pop(handle, 1);
+
+  ssq::VM thread = vm.newThread(64);
+  thread.run(thread.compileSource("wait();", "test"));
+  ASSERT_EQ(sq_getvmstate(thread.getHandle()), SQ_VMSTATE_SUSPENDED);
+
+  // The thread is woken up otherwise, and finishes before its wait ends.
+  ASSERT_TRUE(SQ_SUCCEEDED(sq_wakeupvm(thread.getHandle(), SQFalse, SQFalse, SQTrue, SQFalse)));
+  ASSERT_EQ(sq_getvmstate(thread.getHandle()), SQ_VMSTATE_IDLE);
+
+  // Waking up the finished thread would fail and set an error.
+  scheduler.update(2.0f);
+  EXPECT_EQ(sq_getvmstate(thread.getHandle()), SQ_VMSTATE_IDLE);
+  sq_getlasterror(thread.getHandle());
+  EXPECT_EQ(sq_gettype(thread.getHandle(), -1), OT_NULL);
+  sq_pop(thread.getHandle(), 1);
+
+  s_scheduler = nullptr;
+}
+
+/* EOF */
@@ -0,0 +1,112 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "squirrel/squirrel_script_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <physfs.h>
+#include <sstream>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+
+namespace {
+
+class SquirrelScriptCacheTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_dir = std::filesystem::temp_directory_path() / "supertux_script_cache_test";
+    std::filesystem::remove_all(m_dir);
+    std::filesystem::create_directories(m_dir);
+
+    PHYSFS_init("script_cache_test");
+    ASSERT_NE(PHYSFS_setWriteDir(m_dir.string().c_str()), 0);
+    ASSERT_NE(PHYSFS_mount(m_dir.string().c_str(), nullptr, 0), 0);
+
+    m_config.cache_compiled_scripts = true;
+    g_config = &m_config;
+  }
+
+  void TearDown() override
+  {
+    g_config = nullptr;
+    PHYSFS_unmount(m_dir.string().c_str());
+    PHYSFS_setWriteDir(nullptr);
+    std::filesystem::remove_all(m_dir);
+  }
+
+  std::vector<std::filesystem::path> get_cache_files() const
+  {
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::directory_iterator(m_dir / "cache" / "scripts"))
+      files.push_back(entry.path());
+    return files;
+  }
+
+protected:
+  std::filesystem::path m_dir;
+  Config m_config;
+};
+
+} // namespace
+
+TEST_F(SquirrelScriptCacheTest, reuses_cache_files)
+{
+  ssq::VM vm(64);
+  {
+    SquirrelScriptCache cache;
+    EXPECT_EQ(vm.run(cache.load(vm, "return 1;", "test")).to<int>(), 1);
+  }
+  ASSERT_EQ(get_cache_files().size(), 1u);
+
+  SquirrelScriptCache cache;
+  EXPECT_EQ(vm.run(cache.load(vm, "return 1;", "test")).to<int>(), 1);
+
+  std::ostringstream stats;
+  cache.debug_print(stats);
+  EXPECT_NE(stats.str().find("file_hits:1 "), std::string::npos) << stats.str();
+}
+
+TEST_F(SquirrelScriptCacheTest, ignores_cache_file_of_other_source)
+{
+  ssq::VM vm(64);
+  {
+    // Both sources have the same size, so only comparing the whole source
+    // tells their cache files apart.
+    SquirrelScriptCache cache;
+    vm.run(cache.load(vm, "return 1;", "test"));
+    const auto first = get_cache_files();
+    ASSERT_EQ(first.size(), 1u);
+
+    vm.run(cache.load(vm, "return 2;", "test"));
+    auto files = get_cache_files();
+    ASSERT_EQ(files.size(), 2u);
+
+    // Simulate a hash collision, by giving the second script the cache file of the first.
+    const auto& second = (files[0] == first[0]) ? files[1] : files[0];
+    std::filesystem::copy_file(first[0], second, std::filesystem::copy_options::overwrite_existing);
+  }
+
+  SquirrelScriptCache cache;
+  EXPECT_EQ(vm.run(cache.load(vm, "return 2;", "test")).to<int>(), 2);
+}
+
+/* EOF */
@@ -0,0 +1,97 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/game_object_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include "supertux/debug.hpp"
+
+namespace {
+
+class TestObjectManager final : public GameObjectManager
+{
+public:
+  TestObjectManager() {}
+
+  bool before_object_add(GameObject&) override { return true; }
+  void before_object_remove(GameObject&) override {}
+};
+
+class OrderObject final : public GameObject
+{
+public:
+  OrderObject(std::vector<std::string>& updates, const std::string& name, bool parallel_safe) :
+    GameObject(name),
+    m_updates(updates),
+    m_parallel_safe(parallel_safe)
+  {}
+
+  void update(float) override { m_updates.push_back(get_name()); }
+  void draw(DrawingContext&) override {}
+  int get_update_access() const override
+  {
+    return m_parallel_safe ? UPDATE_ACCESS_OWN : UPDATE_ACCESS_READ_SHARED | UPDATE_ACCESS_WRITE_SHARED;
+  }
+
+private:
+  std::vector<std::string>& m_updates;
+  bool m_parallel_safe;
+
+private:
+  OrderObject(const OrderObject&) = delete;
+  OrderObject& operator=(const OrderObject&) = delete;
+};
+
+std::vector<std::string> update_objects()
+{
+  std::vector<std::string> updates;
+
+  TestObjectManager manager;
+  manager.add<OrderObject>(updates, "serial1", false);
+  manager.add<OrderObject>(updates, "parallel1", true);
+  manager.add<OrderObject>(updates, "serial2", false);
+  manager.add<OrderObject>(updates, "parallel2", true);
+  manager.add<OrderObject>(updates, "parallel3", true);
+  manager.flush_game_objects();
+
+  manager.update(0.01f);
+  return updates;
+}
+
+} // namespace
+
+TEST(GameObjectManagerTest, parallel_safe_objects_keep_update_order)
+{
+  // Parallel-safe objects are updated in batches between the other objects.
+  const std::vector<std::string> expected = { "serial1", "parallel1", "serial2" };
+  const auto updates = update_objects();
+  ASSERT_EQ(updates.size(), 5u);
+  EXPECT_EQ(std::vector<std::string>(updates.begin(), updates.begin() + 3), expected);
+}
+
+TEST(GameObjectManagerTest, check_mode_updates_in_order)
+{
+  g_debug.check_parallel_update_order = true;
+  const auto updates = update_objects();
+  g_debug.check_parallel_update_order = false;
+
+  const std::vector<std::string> expected = { "serial1", "parallel1", "serial2", "parallel2", "parallel3" };
+  EXPECT_EQ(updates, expected);
+}
+
+/* EOF */
@@ -0,0 +1,52 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "supertux/level_resaver.hpp"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+
+TEST(LevelResaverTest, save_results_replaces_previous_results)
+{
+  const std::filesystem::path filename = std::filesystem::temp_directory_path() / "supertux_level_resaver_test.txt";
+
+  LevelResaver::Result first;
+  first.filename = "levels/first.stl";
+  first.changed = true;
+
+  LevelResaver::Result second;
+  second.filename = "levels/second.stl";
+  second.error = "couldn't parse";
+
+  // Workers save their results again after each level.
+  LevelResaver::save_results(filename.string(), { first });
+  LevelResaver::save_results(filename.string(), { first, second });
+
+  const auto results = LevelResaver::load_results(filename.string());
+  ASSERT_EQ(results.size(), 2u);
+  EXPECT_EQ(results[0].filename, "levels/first.stl");
+  EXPECT_TRUE(results[0].changed);
+  EXPECT_TRUE(results[0].error.empty());
+  EXPECT_EQ(results[1].filename, "levels/second.stl");
+  EXPECT_EQ(results[1].error, "couldn't parse");
+  EXPECT_FALSE(std::filesystem::exists(filename.string() + ".part"));
+
+  std::filesystem::remove(filename);
+}
+
+/* EOF */
@@ -0,0 +1,151 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/timer_wheel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+TEST(TimerWheel, expires_in_order)
+{
+  TimerWheel<int> wheel;
+  wheel.insert(5, 5);
+  wheel.insert(1, 1);
+  wheel.insert(70, 70);
+  wheel.insert(5000, 5000);
+
+  std::vector<int> expired;
+  const auto collect = [&expired](int value) { expired.push_back(value); };
+
+  wheel.advance(4, collect);
+  EXPECT_EQ(expired, std::vector<int>({ 1 }));
+
+  wheel.advance(100, collect);
+  EXPECT_EQ(expired, std::vector<int>({ 1, 5, 70 }));
+  EXPECT_EQ(wheel.size(), 1u);
+
+  wheel.advance(4999, collect);
+  EXPECT_EQ(expired.size(), 3u);
+
+  wheel.advance(5000, collect);
+  EXPECT_EQ(expired, std::vector<int>({ 1, 5, 70, 5000 }));
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, past_ticks_expire_next)
+{
+  TimerWheel<int> wheel(100);
+  wheel.insert(50, 1);
+  wheel.insert(100, 2);
+
+  std::vector<int> expired;
+  wheel.advance(101, [&expired](int value) { expired.push_back(value); });
+  EXPECT_EQ(expired, std::vector<int>({ 1, 2 }));
+}
+
+TEST(TimerWheel, insert_while_advancing)
+{
+  TimerWheel<int> wheel;
+  wheel.insert(1, 1);
+
+  // Values inserted by the callback must not expire in the same advance().
+  int calls = 0;
+  const auto reschedule = [&wheel, &calls](int) {
+    calls += 1;
+    wheel.insert(wheel.get_current_tick(), 0);
+  };
+
+  wheel.advance(10, reschedule);
+  EXPECT_EQ(calls, 1);
+  wheel.advance(20, reschedule);
+  EXPECT_EQ(calls, 2);
+  EXPECT_EQ(wheel.size(), 1u);
+}
+
+TEST(TimerWheel, far_ahead)
+{
+  TimerWheel<int> wheel;
+  const uint64_t far = uint64_t(1) << 30;
+  wheel.insert(far, 1);
+
+  int calls = 0;
+  wheel.advance(far - 1, [&calls](int) { calls += 1; });
+  EXPECT_EQ(calls, 0);
+  wheel.advance(far, [&calls](int) { calls += 1; });
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(TimerWheel, take_all)
+{
+  TimerWheel<int> wheel;
+  for (int i = 0; i < 100; ++i)
+    wheel.insert(static_cast<uint64_t>(i * 97), i);
+
+  int calls = 0;
+  wheel.take_all([&calls](int) { calls += 1; });
+  EXPECT_EQ(calls, 100);
+  EXPECT_TRUE(wheel.empty());
+}
+
+// Thousands of concurrent waits, e.g. from scripted particle or light
+// shows, rescheduling themselves as they expire.
+TEST(TimerWheel, stress)
+{
+  struct Wait
+  {
+    int id;
+    uint64_t tick;
+  };
+
+  std::mt19937 random(1234);
+  std::uniform_int_distribution<uint64_t> duration(0, 20000);
+
+  TimerWheel<Wait> wheel;
+  const int wait_count = 5000;
+  for (int i = 0; i < wait_count; ++i)
+  {
+    const uint64_t tick = 1 + duration(random);
+    wheel.insert(tick, { i, tick });
+  }
+
+  std::vector<int> remaining(wait_count, 3);
+  int expired_count = 0;
+  uint64_t tick = 0;
+  while (!wheel.empty())
+  {
+    const uint64_t previous_tick = tick;
+    tick += 1 + duration(random) % 50;
+    wheel.advance(tick, [&](const Wait& wait) {
+        // Never early, and not in a later advance() than necessary.
+        EXPECT_LE(wait.tick, tick);
+        EXPECT_GT(wait.tick, previous_tick);
+        expired_count += 1;
+
+        if (--remaining[wait.id] > 0)
+        {
+          const uint64_t next = tick + duration(random);
+          wheel.insert(next, { wait.id, std::max(next, tick + 1) });
+        }
+      });
+  }
+
+  EXPECT_EQ(expired_count, wait_count * 3);
+  EXPECT_TRUE(std::all_of(remaining.begin(), remaining.end(), [](int count) { return count == 0; }));
+}
+
+/* EOF */
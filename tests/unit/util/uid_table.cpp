@@ -0,0 +1,103 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+#include "util/uid_table.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(UIDTable, insert_get)
+{
+  UIDTable<int> table;
+  int a = 1, b = 2;
+
+  const UID uid_a = table.insert(&a);
+  const UID uid_b = table.insert(&b);
+
+  EXPECT_TRUE(uid_a);
+  EXPECT_NE(uid_a, uid_b);
+  EXPECT_EQ(table.get(uid_a), &a);
+  EXPECT_EQ(table.get(uid_b), &b);
+  EXPECT_EQ(table.get(UID()), nullptr);
+}
+
+TEST(UIDTable, stale_uid)
+{
+  UIDTable<int> table;
+  int a = 1, b = 2;
+
+  const UID uid_a = table.insert(&a);
+  table.erase(uid_a);
+  EXPECT_EQ(table.get(uid_a), nullptr);
+
+  // The slot is reused, but the old UID must not resolve to the new object.
+  const UID uid_b = table.insert(&b);
+  EXPECT_EQ(uid_b.get_index(), uid_a.get_index());
+  EXPECT_NE(uid_b, uid_a);
+  EXPECT_EQ(table.get(uid_a), nullptr);
+  EXPECT_EQ(table.get(uid_b), &b);
+}
+
+TEST(UIDTable, reinsert_uid)
+{
+  UIDTable<int> table;
+  int a = 1, b = 2;
+
+  const UID uid_a = table.insert(&a);
+  table.erase(uid_a);
+  table.insert(uid_a, &b);
+  EXPECT_EQ(table.get(uid_a), &b);
+
+  // The slot is taken again, so new objects must use another one.
+  int c = 3;
+  const UID uid_c = table.insert(&c);
+  EXPECT_NE(uid_c.get_index(), uid_a.get_index());
+  EXPECT_EQ(table.get(uid_a), &b);
+  EXPECT_EQ(table.get(uid_c), &c);
+}
+
+TEST(UIDTable, clear)
+{
+  UIDTable<int> table;
+  int a = 1, b = 2;
+
+  const UID uid_a = table.insert(&a);
+  table.clear();
+  EXPECT_EQ(table.get(uid_a), nullptr);
+
+  // UIDs from before clearing must not resolve to objects added afterwards.
+  const UID uid_b = table.insert(&b);
+  EXPECT_EQ(uid_b.get_index(), uid_a.get_index());
+  EXPECT_NE(uid_b, uid_a);
+  EXPECT_EQ(table.get(uid_a), nullptr);
+  EXPECT_EQ(table.get(uid_b), &b);
+}
+
+TEST(UIDTable, foreign_uid)
+{
+  UIDTable<int> table;
+  UIDTable<int> other;
+  int a = 1, b = 2;
+
+  const UID uid_a = other.insert(&a);
+  table.insert(uid_a, &a);
+  table.insert(&b);
+  EXPECT_EQ(table.get(uid_a), &a);
+
+  table.erase(uid_a);
+  EXPECT_EQ(table.get(uid_a), nullptr);
+}
+
+/* EOF */
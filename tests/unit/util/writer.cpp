@@ -0,0 +1,92 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "util/writer.hpp"
+
+#include <gtest/gtest.h>
+#include <sstream>
+
+TEST(Writer, values)
+{
+  std::string data;
+  {
+    Writer writer(data);
+    writer.start_list("test");
+    writer.write("int", -42);
+    writer.write("float", 3.14159265f);
+    writer.write("large", 123456789.0f);
+    writer.write("bool", true);
+    writer.write("string", std::string("a \"b\" \\c"), true);
+    writer.end_list("test");
+  }
+
+  EXPECT_EQ(data,
+            "(test\n"
+            "  (int -42)\n"
+            "  (float 3.141593)\n"
+            "  (large 1.234568e+08)\n"
+            "  (bool #t)\n"
+            "  (string (_ \"a \\\"b\\\" \\\\c\"))\n"
+            ")\n");
+}
+
+TEST(Writer, tiles)
+{
+  const std::vector<unsigned int> tiles = { 1, 2, 30, 400, 5000 };
+
+  std::ostringstream stream;
+  {
+    Writer writer(stream);
+    writer.write("tiles", tiles, 2);
+    writer.write("flat", tiles.data(), tiles.size());
+  }
+
+  EXPECT_EQ(stream.str(),
+            "(tiles\n"
+            "1 2\n"
+            "30 400\n"
+            "5000 )\n"
+            "(flat 1 2 30 400 5000)\n");
+}
+
+TEST(Writer, deferred_tiles)
+{
+  const std::vector<unsigned int> tiles = { 1, 2, 3, 4 };
+
+  std::ostringstream expected;
+  std::string data;
+  std::vector<Writer::DeferredTiles> deferred_tiles;
+  {
+    Writer writer(expected);
+    Writer deferred(data);
+    deferred.set_deferred_tiles(&deferred_tiles);
+    for (Writer* w : { &writer, &deferred })
+    {
+      w->start_list("tilemap");
+      w->write("width", 2);
+      w->write("tiles", tiles, 2);
+      w->end_list("tilemap");
+    }
+  }
+  ASSERT_EQ(deferred_tiles.size(), 1u);
+
+  std::ostringstream stream;
+  Writer::write_deferred(stream, data, deferred_tiles);
+  EXPECT_EQ(stream.str(), expected.str());
+}
+
+/* EOF */
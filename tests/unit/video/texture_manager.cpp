@@ -0,0 +1,60 @@
+//  SuperTux
+//  Copyright (C) 2026 Vankata453
+//
+//  This program is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or
+//  (at your option) any later version.
+//
+//  This program is distributed in the hope that it will be useful,
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details.
+//
+//  You should have received a copy of the GNU General Public License
+//  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+
+#include "video/texture_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <physfs.h>
+#include <thread>
+
+#include "supertux/gameconfig.hpp"
+#include "supertux/globals.hpp"
+#include "video/null/null_video_system.hpp"
+
+TEST(TextureManagerTest, get_async_swaps_placeholder)
+{
+  PHYSFS_init("texture_manager_test");
+  PHYSFS_mount("../tests/data", nullptr, 1);
+
+  Config config;
+  g_config = &config;
+  {
+    NullVideoSystem video_system;
+    TextureManager& texture_manager = *TextureManager::current();
+
+    // The image isn't decoded yet, so the placeholder is returned.
+    TexturePtr placeholder = texture_manager.get_async("texture.png");
+    EXPECT_EQ(placeholder->get_image_width(), 1);
+    EXPECT_EQ(placeholder->get_image_height(), 1);
+
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!texture_manager.is_ready("texture.png") && std::chrono::steady_clock::now() < timeout)
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ASSERT_TRUE(texture_manager.is_ready("texture.png"));
+
+    TexturePtr texture = texture_manager.get_async("texture.png");
+    EXPECT_NE(texture, placeholder);
+    EXPECT_EQ(texture->get_image_width(), 4);
+    EXPECT_EQ(texture->get_image_height(), 2);
+    EXPECT_TRUE(texture_manager.last_load_successful());
+  }
+  g_config = nullptr;
+}
+
+/* EOF */